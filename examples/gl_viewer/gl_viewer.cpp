@@ -24,6 +24,7 @@
  * OTHER DEALINGS IN THE SOFTWARE.
  */
 
+#include <array>
 #include <chrono>
 #include <iostream>
 
@@ -419,14 +420,19 @@ bool loadMesh(Viewer* viewer, fastgltf::Mesh& mesh) {
             if (!positionAccessor.bufferViewIndex.has_value())
                 continue;
 
-			// Create the vertex buffer for this primitive, and use the accessor tools to copy directly into the mapped buffer.
+			// Create the vertex buffer for this primitive, and use the accessor tools to write all attributes
+			// directly into the mapped buffer in a single pass. Primitives without texture coordinates get zeros.
+			auto texcoordAttribute = std::string("TEXCOORD_") + std::to_string(baseColorTexcoordIndex);
+			const std::array layout = {
+				fastgltf::makeInterleavedAttribute<fastgltf::math::fvec3>("POSITION", offsetof(Vertex, position)),
+				fastgltf::makeInterleavedAttribute<fastgltf::math::fvec2>(texcoordAttribute, offsetof(Vertex, uv)),
+			};
+
 			glCreateBuffers(1, &primitive.vertexBuffer);
 			glNamedBufferData(primitive.vertexBuffer, positionAccessor.count * sizeof(Vertex), nullptr, GL_STATIC_DRAW);
-			auto* vertices = static_cast<Vertex*>(glMapNamedBuffer(primitive.vertexBuffer, GL_WRITE_ONLY));
-			fastgltf::iterateAccessorWithIndex<fastgltf::math::fvec3>(asset, positionAccessor, [&](fastgltf::math::fvec3 pos, std::size_t idx) {
-				vertices[idx].position = fastgltf::math::fvec3(pos.x(), pos.y(), pos.z());
-				vertices[idx].uv = fastgltf::math::fvec2();
-			});
+			auto* vertices = glMapNamedBuffer(primitive.vertexBuffer, GL_WRITE_ONLY);
+			fastgltf::writeInterleavedVertices(asset, *it,
+				fastgltf::span<const fastgltf::InterleavedAttribute>(layout.data(), layout.size()), sizeof(Vertex), vertices);
 			glUnmapNamedBuffer(primitive.vertexBuffer);
 
             glEnableVertexArrayAttrib(vao, 0);
@@ -437,20 +443,6 @@ bool loadMesh(Viewer* viewer, fastgltf::Mesh& mesh) {
 
 			glVertexArrayVertexBuffer(vao, 0, primitive.vertexBuffer,
 									  0, sizeof(Vertex));
-        }
-
-		auto texcoordAttribute = std::string("TEXCOORD_") + std::to_string(baseColorTexcoordIndex);
-        if (const auto* texcoord = it->findAttribute(texcoordAttribute); texcoord != it->attributes.end()) {
-            // Tex coord
-			auto& texCoordAccessor = asset.accessors[texcoord->accessorIndex];
-            if (!texCoordAccessor.bufferViewIndex.has_value())
-                continue;
-
-			auto* vertices = static_cast<Vertex*>(glMapNamedBuffer(primitive.vertexBuffer, GL_WRITE_ONLY));
-			fastgltf::iterateAccessorWithIndex<fastgltf::math::fvec2>(asset, texCoordAccessor, [&](fastgltf::math::fvec2 uv, std::size_t idx) {
-				vertices[idx].uv = fastgltf::math::fvec2(uv.x(), uv.y());
-			});
-			glUnmapNamedBuffer(primitive.vertexBuffer);
 
 			glEnableVertexArrayAttrib(vao, 1);
             glVertexArrayAttribFormat(vao, 1,
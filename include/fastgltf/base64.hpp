@@ -65,12 +65,24 @@ namespace fastgltf::base64 {
         return (encodedSize / 4) * 3 - padding;
     }
 
+    /**
+     * Calculates the size of the padded base64 string encoding the given amount of bytes.
+     */
+    FASTGLTF_EXPORT [[gnu::always_inline]] constexpr std::size_t getEncodedSize(std::size_t size) noexcept {
+        return ((size + 2) / 3) * 4;
+    }
+
 #if defined(FASTGLTF_IS_X86)
+    /** Checks whether the CPU and OS support AVX-512 with the VBMI extension, which avx512_decode requires. */
+    [[nodiscard]] bool avx512_vbmi_supported();
+
     void sse4_decode_inplace(std::string_view encoded, std::uint8_t* output, std::size_t padding);
     void avx2_decode_inplace(std::string_view encoded, std::uint8_t* output, std::size_t padding);
+    void avx512_decode_inplace(std::string_view encoded, std::uint8_t* output, std::size_t padding);
 
     [[nodiscard]] StaticVector<std::uint8_t> sse4_decode(std::string_view encoded);
     [[nodiscard]] StaticVector<std::uint8_t> avx2_decode(std::string_view encoded);
+    [[nodiscard]] StaticVector<std::uint8_t> avx512_decode(std::string_view encoded);
 #elif defined(FASTGLTF_IS_A64)
     void neon_decode_inplace(std::string_view encoded, std::uint8_t* output, std::size_t padding);
     [[nodiscard]] StaticVector<std::uint8_t> neon_decode(std::string_view encoded);
@@ -78,8 +90,32 @@ namespace fastgltf::base64 {
     void fallback_decode_inplace(std::string_view encoded, std::uint8_t* output, std::size_t padding);
     FASTGLTF_EXPORT void decode_inplace(std::string_view encoded, std::uint8_t* output, std::size_t padding);
 
+    /** The size of the encoded data from which on decode_inplace_parallel splits the data into multiple chunks. */
+    FASTGLTF_EXPORT constexpr std::size_t parallelDecodeThreshold = 4 * 1024 * 1024;
+
+    /**
+     * Decodes the data like decode_inplace, but splits data of at least parallelDecodeThreshold chars into chunks
+     * which are decoded concurrently using executeTasks. Smaller data is decoded on the calling thread.
+     */
+    FASTGLTF_EXPORT void decode_inplace_parallel(std::string_view encoded, std::uint8_t* output, std::size_t padding,
+                                                 TaskExecutorCallback* executor = nullptr, void* userPointer = nullptr);
+
     [[nodiscard]] StaticVector<std::uint8_t> fallback_decode(std::string_view encoded);
     FASTGLTF_EXPORT [[nodiscard]] StaticVector<std::uint8_t> decode(std::string_view encoded);
+
+#if defined(FASTGLTF_IS_X86)
+    void sse4_encode_inplace(const std::uint8_t* data, std::size_t size, char* output);
+    void avx2_encode_inplace(const std::uint8_t* data, std::size_t size, char* output);
+#elif defined(FASTGLTF_IS_A64)
+    void neon_encode_inplace(const std::uint8_t* data, std::size_t size, char* output);
+#endif
+    void fallback_encode_inplace(const std::uint8_t* data, std::size_t size, char* output);
+
+    /**
+     * Encodes the given data into output, which has to point to at least getEncodedSize(size) chars.
+     * The output is padded and is not null-terminated.
+     */
+    FASTGLTF_EXPORT void encode_inplace(const std::uint8_t* data, std::size_t size, char* output);
 } // namespace fastgltf::base64
 
 #ifdef _MSC_VER
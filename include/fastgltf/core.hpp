@@ -27,13 +27,19 @@
 #pragma once
 
 #if !defined(FASTGLTF_USE_STD_MODULE) || !FASTGLTF_USE_STD_MODULE
+#include <chrono>
 #include <fstream>
+#include <future>
 #include <memory>
 #include <tuple>
 #endif
 
 #include <fastgltf/types.hpp>
 
+#ifndef FASTGLTF_ENABLE_PROFILING
+#define FASTGLTF_ENABLE_PROFILING 0
+#endif
+
 #ifdef _MSC_VER
 #pragma warning(push)
 #pragma warning(disable : 5030) // attribute 'x' is not recognized
@@ -85,12 +91,15 @@ namespace fastgltf {
 		 * @note This is only used internally.
 		 */
 		MissingField = 8,
-		MissingExternalBuffer = 9, ///< With Options::LoadExternalBuffers, an external buffer was not found.
+		MissingExternalBuffer = 9, ///< With Options::LoadExternalBuffers or Options::MapExternalBuffers, an external buffer was not found.
 		UnsupportedVersion = 10, ///< The glTF version is not supported by fastgltf.
 		InvalidURI = 11, ///< A URI from a buffer or image failed to be parsed.
 		InvalidFileData = 12, ///< The file data is invalid, or the file type could not be determined.
 		FailedWritingFiles = 13, ///< The exporter failed to write some files (buffers/images) to disk.
 		FileBufferAllocationFailed = 14, ///< The constructor of GltfDataBuffer failed to allocate a sufficiently large buffer.
+		DecompressionFailed = 15, ///< Decompressing data, for example from EXT_meshopt_compression or KHR_draco_mesh_compression, failed or is not supported by this build.
+		InvalidCache = 16, ///< An asset cache is damaged, was written by an incompatible build, or does not belong to the source file.
+		UnreadableMappedBuffer = 17, ///< A buffer filled through the BufferMapCallback had to be read, for example to decompress it.
     };
 
 	FASTGLTF_EXPORT constexpr std::string_view getErrorName(Error error) {
@@ -110,6 +119,9 @@ namespace fastgltf {
             case Error::InvalidFileData: return "InvalidFileData";
             case Error::FailedWritingFiles: return "FailedWritingFiles";
 			case Error::FileBufferAllocationFailed: return "FileBufferAllocationFailed";
+			case Error::DecompressionFailed: return "DecompressionFailed";
+			case Error::InvalidCache: return "InvalidCache";
+			case Error::UnreadableMappedBuffer: return "UnreadableMappedBuffer";
 			default: FASTGLTF_UNREACHABLE
 		}
 	}
@@ -131,6 +143,9 @@ namespace fastgltf {
             case Error::InvalidFileData: return "The file data is invalid, or the file type could not be determined.";
             case Error::FailedWritingFiles: return "The exporter failed to write some files (buffers/images) to disk.";
 			case Error::FileBufferAllocationFailed: return "The constructor of GltfDataBuffer failed to allocate a sufficiently large buffer.";
+			case Error::DecompressionFailed: return "Decompressing data failed, or is not supported by this build.";
+			case Error::InvalidCache: return "The asset cache is invalid, or does not belong to the source file.";
+			case Error::UnreadableMappedBuffer: return "A buffer filled through the BufferMapCallback cannot be read by fastgltf.";
 			default: FASTGLTF_UNREACHABLE
 		}
 	}
@@ -279,11 +294,110 @@ namespace fastgltf {
         LoadExternalImages              = 1 << 7,
 
 		/**
-		 * Lets fastgltf generate indices for all mesh primitives without indices. This currently
-		 * does not de-duplicate the vertices. This is entirely for compatibility and simplifying the
-		 * loading process.
+		 * Lets fastgltf generate indices for all mesh primitives without indices. This does not de-duplicate
+		 * the vertices, unless Options::WeldVertices is also specified. This is entirely for compatibility
+		 * and simplifying the loading process. The generated indices of all primitives are placed in a single
+		 * new buffer, with one buffer view per primitive.
 		 */
 		GenerateMeshIndices             = 1 << 8,
+
+		/**
+		 * Defers loading of external files requested through LoadExternalBuffers and LoadExternalImages
+		 * until all buffers and images have been parsed, and then loads all of them concurrently. By default,
+		 * this spawns threads using executeTasks, but a custom executor can be specified using Parser::setTaskExecutorCallback.
+		 * When this option is used, the BufferMapCallback and BufferUnmapCallback callbacks may be called from
+		 * multiple threads at once and therefore need to be thread-safe. If loading multiple files fails,
+		 * the error of the file that was referenced first is returned.
+		 */
+		LoadExternalFilesInParallel     = 1 << 9,
+
+		/**
+		 * Instead of copying the GLB binary chunk, the first buffer will be a sources::ByteView which
+		 * points directly into the memory of the GltfDataGetter. This only works with data getters which
+		 * keep the entire file in memory, like GltfDataBuffer and MappedGltfFile, and falls back to copying
+		 * the chunk otherwise. The data getter has to outlive the Asset, which is taken care of when passing
+		 * it as a std::shared_ptr to Parser::loadGltf or Parser::loadGltfBinary.
+		 */
+		ReferenceGLBBuffer              = 1 << 10,
+
+		/**
+		 * Doesn't read the GLB binary chunk at all. The first buffer will instead be a sources::URI with an
+		 * empty URI, whose fileByteOffset specifies where the buffer starts within the GLB file. This is useful
+		 * for APIs like DirectStorage or Metal IO, which can then stream the data to the GPU themselves.
+		 */
+		SkipGLBBuffer                   = 1 << 11,
+
+		/**
+		 * Memory-maps all external buffers instead of reading them into memory, as long as MappedGltfFile is
+		 * available on the target platform. The buffers will then be a read-only sources::ByteView, and their
+		 * bytes are only paged in once they are actually accessed. The mappings are owned by the Asset.
+		 * This can be used instead of LoadExternalBuffers, and falls back to it on platforms without mmap.
+		 */
+		MapExternalBuffers              = 1 << 12,
+
+		/**
+		 * Parses the top-level arrays of the glTF, like accessors, materials, or nodes, concurrently.
+		 * Every category gets its own memory resource, so that the threads do not have to synchronize their allocations.
+		 * This uses the same threads or executor as LoadExternalFilesInParallel. All callbacks set on the Parser may
+		 * then be called from multiple threads at once and therefore need to be thread-safe.
+		 */
+		ParseCategoriesInParallel       = 1 << 13,
+
+		/**
+		 * Decodes every buffer view compressed with EXT_meshopt_compression while parsing, using the same threads or
+		 * executor as LoadExternalFilesInParallel. The decoded data is placed in a new buffer, which the buffer views are
+		 * then changed to point into, so that tools like iterateAccessor see the decoded bytes. The compressed buffers
+		 * need to be loaded, and fastgltf needs to be built with FASTGLTF_ENABLE_MESHOPT, otherwise parsing
+		 * returns Error::DecompressionFailed. Buffers filled through the BufferMapCallback are not supported, as
+		 * fastgltf cannot read them back, and make parsing return Error::UnreadableMappedBuffer.
+		 */
+		DecompressMeshopt               = 1 << 14,
+
+		/**
+		 * Makes Options::GenerateMeshIndices weld vertices which are identical across all attributes, including
+		 * morph targets, instead of generating sequential indices. The welded attributes are written into the
+		 * buffer with the generated indices and get new accessors, which the primitive's attributes are changed to
+		 * point to. Primitives whose attributes are sparse or have not been loaded keep sequential indices.
+		 * This has no effect without Options::GenerateMeshIndices.
+		 */
+		WeldVertices                    = 1 << 15,
+
+		/**
+		 * Performs the checks of fastgltf::validate while parsing. Every category is validated right after it has
+		 * been parsed, element by element for accessors, meshes, and nodes, as long as all the categories it references
+		 * have already been parsed. All others are validated once every category has been parsed, in parallel when
+		 * Options::ParseCategoriesInParallel is also specified. If the asset is invalid, parsing returns
+		 * Error::InvalidGltf. Note that data added by post-processing options like Options::GenerateMeshIndices
+		 * is not validated.
+		 */
+		Validate                        = 1 << 16,
+
+		/**
+		 * Keeps the JSON document alive in the asset if some of its categories were not requested when loading,
+		 * so that they can be parsed later on using fastgltf::ensureCategories, without reading the file again.
+		 * The options, callbacks, and directory of the Parser are retained as well, and therefore the user pointer
+		 * and callbacks need to stay valid for as long as categories can be parsed. The document is released once
+		 * every category has been parsed, or when the asset is destroyed.
+		 */
+		LazyCategories                  = 1 << 17,
+
+		/**
+		 * Splits the JSON into its top-level members in a single forward pass using simdjson's On-Demand API, and then
+		 * only builds the DOM of a single member at a time, instead of the DOM of the entire document. This produces the
+		 * same asset, but the peak memory of the JSON parser then depends on the largest member, like the accessors
+		 * or nodes, instead of the entire JSON. The members of categories which are not requested are not parsed at all.
+		 * This option has no effect together with Options::ParseCategoriesInParallel or Options::LazyCategories,
+		 * which need the DOM of the entire document.
+		 */
+		OnDemandParsing                 = 1 << 18,
+
+		/**
+		 * Decodes base64 data URIs of at least base64::parallelDecodeThreshold chars in multiple chunks concurrently,
+		 * using the executor specified with Parser::setTaskExecutorCallback, or threads spawned by executeTasks by default.
+		 * The data is still decoded directly into the memory returned by the BufferMapCallback. This has no effect
+		 * when a custom Base64DecodeCallback has been set.
+		 */
+		DecodeDataUrisInParallel        = 1 << 19,
     };
 
     FASTGLTF_EXPORT enum class ExportOptions : std::uint64_t {
@@ -298,6 +412,26 @@ namespace fastgltf {
          * Pretty-prints the outputted JSON. This option is ignored for binary glTFs.
          */
         PrettyPrintJson                 = 1 << 2,
+
+        /**
+         * Embeds all buffers and images which hold their data in memory as base64 data URIs, instead of
+         * writing them to separate files. When exporting a GLB, the first buffer is still written to the BIN chunk.
+         */
+        EmbedDataUris                   = 1 << 3,
+
+        /**
+         * Merges all buffers which hold their data in memory into the BIN chunk when exporting a GLB, instead of
+         * only embedding the first buffer. The buffer views are changed to point into the merged buffer, and each
+         * buffer starts at a 16-byte aligned offset. This option is ignored for glTF JSON exports.
+         */
+        MergeBuffersIntoBinaryChunk     = 1 << 4,
+
+        /**
+         * Writes the JSON of the different asset categories on multiple threads, using the same executor as the
+         * Parser, which can be changed with Exporter::setTaskExecutorCallback. The output is identical to the
+         * sequential export. Note that the extras write callback may then be called concurrently.
+         */
+        WriteCategoriesInParallel       = 1 << 5,
     };
     // clang-format on
 
@@ -530,6 +664,70 @@ namespace fastgltf {
 	FASTGLTF_EXPORT using ExtrasParseCallback = void(simdjson::dom::object* extras, std::size_t objectIndex, Category objectType, void* userPointer);
 	FASTGLTF_EXPORT using ExtrasWriteCallback = std::optional<std::string>(std::size_t objectIndex, Category objectType, void* userPointer);
 
+	/**
+	 * A destination for data decoded from a KHR_draco_mesh_compression primitive. The data has to be written tightly
+	 * packed, with accessor->count elements in the format described by the accessor's type and component type.
+	 */
+	FASTGLTF_EXPORT struct DracoDecodeTarget {
+		/** The name of the attribute, for example "POSITION", or empty for the indices. */
+		std::string_view name;
+		/** The unique ID of the attribute within the Draco data, as specified in the extension's attribute map. */
+		std::size_t dracoAttributeId;
+		const Accessor* accessor;
+		span<std::byte> data;
+	};
+
+	FASTGLTF_EXPORT struct DracoDecodeInfo {
+		std::size_t meshIndex;
+		std::size_t primitiveIndex;
+		/** The bytes of the buffer view referenced by the extension, which hold the compressed Draco data. */
+		span<const std::byte> compressedData;
+		/** The target for the decoded indices, or nullptr if the primitive has no indices accessor. */
+		const DracoDecodeTarget* indices;
+		span<const DracoDecodeTarget> attributes;
+	};
+
+	/**
+	 * Decodes a single Draco compressed primitive into the given targets, and returns false if decoding failed.
+	 * This is called concurrently for multiple primitives, so the callback has to be thread-safe.
+	 */
+	FASTGLTF_EXPORT using DracoDecodeCallback = bool(const DracoDecodeInfo& info, void* userPointer);
+
+#if FASTGLTF_ENABLE_PROFILING
+	/** The stages of loading a glTF, which are reported to the ProfilingCallback. */
+	FASTGLTF_EXPORT enum class ParseStage : std::uint8_t {
+		Load,              ///< All of Parser::loadGltfJson or Parser::loadGltfBinary, enclosing every other stage.
+		ReadJson,          ///< Reading the JSON, or the JSON chunk of a GLB, from the data getter.
+		ParseJson,         ///< Parsing the JSON document with simdjson.
+		ReadBinaryChunk,   ///< Reading or referencing the BIN chunk of a GLB.
+		ParseCategory,     ///< Parsing the array of a single category, with one element per object.
+		DecodeDataUri,     ///< Decoding a base64 data URI, where the bytes are the decoded size.
+		LoadExternalFile,  ///< Reading or mapping a single external buffer or image.
+		DecompressMeshopt, ///< Decompressing the EXT_meshopt_compression buffer views.
+		DecodeDraco,       ///< Decoding the KHR_draco_mesh_compression primitives through the DracoDecodeCallback.
+		GenerateIndices,   ///< Generating the indices for Options::GenerateMeshIndices.
+	};
+
+	FASTGLTF_EXPORT struct ProfilingEvent {
+		ParseStage stage;
+		/** The category which was parsed, or Category::None for stages other than ParseStage::ParseCategory. */
+		Category category;
+		std::chrono::steady_clock::time_point begin;
+		std::chrono::steady_clock::time_point end;
+		/** The number of bytes the stage processed, or zero if it does not process any bytes itself. */
+		std::size_t byteCount;
+		/** The number of elements the stage processed, like objects of a category, or zero if not applicable. */
+		std::size_t elementCount;
+	};
+
+	/**
+	 * Called once a stage has finished. Stages are reported in the order they finish, so that a stage enclosing
+	 * other stages is reported after them. With Options::ParseCategoriesInParallel or
+	 * Options::LoadExternalFilesInParallel this is called concurrently, so the callback has to be thread-safe.
+	 */
+	FASTGLTF_EXPORT using ProfilingCallback = void(const ProfilingEvent& event, void* userPointer);
+#endif
+
 	/**
 	 * This interface defines how the parser can read the bytes making up a glTF or GLB file.
 	 */
@@ -559,6 +757,23 @@ namespace fastgltf {
 
 		[[nodiscard]] virtual std::size_t bytesRead() = 0;
 		[[nodiscard]] virtual std::size_t totalSize() = 0;
+
+		/**
+		 * Returns all bytes of the file, if they stay in memory at the same address until this object is destroyed.
+		 * This is used by Options::ReferenceGLBBuffer to avoid copying the GLB binary chunk.
+		 * The default implementation returns an empty span, meaning that the data has to be copied.
+		 */
+		[[nodiscard]] virtual span<const std::byte> persistentBytes() {
+			return {};
+		}
+
+		/**
+		 * Returns an error if some of the bytes returned by the read functions could not actually be read, since the
+		 * read functions have no way of reporting one. The parser checks this before it uses the data it has read.
+		 */
+		[[nodiscard]] virtual Error readError() {
+			return Error::None;
+		}
 	};
 
 	FASTGLTF_EXPORT class GltfDataBuffer : public GltfDataGetter {
@@ -624,6 +839,8 @@ namespace fastgltf {
 
 		[[nodiscard]] std::size_t totalSize() override;
 
+		[[nodiscard]] span<const std::byte> persistentBytes() override;
+
 		[[nodiscard]] explicit operator span<std::byte>() {
 			return span<std::byte>(buffer.get(), dataSize);
 		}
@@ -681,6 +898,8 @@ namespace fastgltf {
 
 		[[nodiscard]] std::size_t totalSize() override;
 
+		[[nodiscard]] span<const std::byte> persistentBytes() override;
+
 		[[nodiscard]] explicit operator span<std::byte>() {
 			return span<std::byte>(static_cast<std::byte*>(mappedFile), fileSize);
 		}
@@ -710,6 +929,67 @@ namespace fastgltf {
 		[[nodiscard]] std::size_t totalSize() override;
 	};
 
+	/**
+	 * Reads a file on a background thread. The read functions only block until the requested range is available.
+	 * With GLB files, this allows simdjson to parse the JSON chunk while the rest of the file is still being read.
+	 * The glTF itself is only parsed once the BIN chunk has been read completely, and Options::ReferenceGLBBuffer
+	 * always waits for the entire file. For .gltf files the entire file has to be read before parsing can start.
+	 */
+	FASTGLTF_EXPORT class AsyncGltfFile : public GltfDataGetter {
+		struct LoadState;
+		std::unique_ptr<LoadState> state;
+
+		std::size_t idx = 0;
+
+		Error error = Error::None;
+		bool readFailed = false;
+
+		explicit AsyncGltfFile(const std::filesystem::path& path) noexcept;
+
+		void waitForBytes(std::size_t byteCount);
+
+	public:
+		explicit AsyncGltfFile() noexcept;
+		AsyncGltfFile(const AsyncGltfFile& other) = delete;
+		AsyncGltfFile& operator=(const AsyncGltfFile& other) = delete;
+		AsyncGltfFile(AsyncGltfFile&& other) noexcept;
+		AsyncGltfFile& operator=(AsyncGltfFile&& other) noexcept;
+		~AsyncGltfFile() noexcept override;
+
+		/** Opens the file and starts reading it on a background thread. */
+		static Expected<AsyncGltfFile> FromPath(const std::filesystem::path& path) noexcept {
+			AsyncGltfFile file(path);
+			if (file.error != fastgltf::Error::None) {
+				return file.error;
+			}
+			return std::move(file);
+		}
+
+		/**
+		 * Blocks until the entire file has been read.
+		 *
+		 * @return Error::InvalidFileData if reading the file failed, in which case all bytes that could not be read are zero,
+		 * or if this object has been default-constructed or moved from.
+		 */
+		Error wait();
+
+		void read(void* ptr, std::size_t count) override;
+
+		[[nodiscard]] span<std::byte> read(std::size_t count, std::size_t padding) override;
+
+		void reset() override;
+
+		[[nodiscard]] std::size_t bytesRead() override;
+
+		[[nodiscard]] std::size_t totalSize() override;
+
+		/** Blocks until the entire file has been read. */
+		[[nodiscard]] span<const std::byte> persistentBytes() override;
+
+		/** Returns Error::InvalidFileData if any of the bytes returned by the read functions could not be read. */
+		[[nodiscard]] Error readError() override;
+	};
+
     #if defined(__ANDROID__)
 	FASTGLTF_EXPORT void setAndroidAssetManager(AAssetManager* assetManager) noexcept;
 
@@ -764,6 +1044,38 @@ namespace fastgltf {
 	*/
 	FASTGLTF_EXPORT [[nodiscard]] Error validate(const Asset& asset);
 
+	/**
+	 * Performs the same checks as fastgltf::validate, but checks the categories of the asset concurrently.
+	 * The categories are validated on the given executor, or on threads spawned by executeTasks if it is nullptr.
+	 * The returned error does not depend on the order in which the tasks are executed.
+	 */
+	FASTGLTF_EXPORT [[nodiscard]] Error validateInParallel(const Asset& asset, TaskExecutorCallback* executorCallback = nullptr, void* userPointer = nullptr);
+
+	/**
+	 * Parses the given categories of an asset loaded with Options::LazyCategories, if they have not been parsed yet.
+	 * The categories they depend on are parsed as well, just like when loading. The post-processing requested by the
+	 * options used for loading, like Options::GenerateMeshIndices, is applied to the new data. Assets which were not
+	 * loaded with Options::LazyCategories, or whose categories have all been parsed, are left untouched.
+	 * @note This function is not thread-safe, and must not be called concurrently for the same asset.
+	 */
+	FASTGLTF_EXPORT Error ensureCategories(Asset& asset, Category categories);
+
+	/**
+	 * Computes a hash of the data from the data getter, which identifies the source file of an asset cache.
+	 * The data getter is reset before and after reading.
+	 */
+	FASTGLTF_EXPORT [[nodiscard]] std::uint64_t hashGltfData(GltfDataGetter& data);
+
+	/**
+	 * Serializes a parsed asset into a binary cache, which Parser::loadAssetCache loads without having to parse
+	 * any JSON. Buffers and images which are embedded in the asset are stored within the cache, while external
+	 * files are kept as URIs. The cache is only valid for builds of fastgltf with the same configuration on the
+	 * same platform, which is checked when loading it.
+	 *
+	 * @param sourceHash the hash of the source file, usually from hashGltfData, which has to match when loading.
+	 */
+	FASTGLTF_EXPORT [[nodiscard]] std::vector<std::byte> writeAssetCache(const Asset& asset, std::uint64_t sourceHash);
+
     /**
      * Some internals the parser passes on to each glTF instance.
      */
@@ -772,6 +1084,11 @@ namespace fastgltf {
         BufferUnmapCallback* unmapCallback = nullptr;
         Base64DecodeCallback* decodeCallback = nullptr;
 		ExtrasParseCallback* extrasCallback = nullptr;
+		TaskExecutorCallback* executorCallback = nullptr;
+		DracoDecodeCallback* dracoCallback = nullptr;
+#if FASTGLTF_ENABLE_PROFILING
+		ProfilingCallback* profilingCallback = nullptr;
+#endif
 
         void* userPointer = nullptr;
         Extensions extensions = Extensions::None;
@@ -791,11 +1108,19 @@ namespace fastgltf {
 		ParserInternalConfig config = {};
 		DataSource glbBuffer;
 #if !FASTGLTF_DISABLE_CUSTOM_MEMORY_POOL
-		std::shared_ptr<std::pmr::monotonic_buffer_resource> resourceAllocator;
+		std::shared_ptr<ChunkMemoryResource> resourceAllocator;
+		std::pmr::memory_resource* upstreamResource = nullptr;
 #endif
 		std::filesystem::path directory;
 		Options options = Options::None;
 
+		// External files whose loading was deferred because of Options::LoadExternalFilesInParallel.
+		std::vector<std::pair<Category, std::size_t>> deferredFileLoads;
+		// Whether the category currently being parsed is validated while parsing, see Options::Validate.
+		bool validateWhileParsing = false;
+
+		friend Error ensureCategories(Asset& asset, Category categories);
+
 		static auto getMimeTypeFromString(std::string_view mime) -> MimeType;
 		static void fillCategories(Category& inputCategories) noexcept;
 
@@ -804,11 +1129,19 @@ namespace fastgltf {
 
 		[[nodiscard]] auto decodeDataUri(URIView& uri) const noexcept -> Expected<DataSource>;
 		[[nodiscard]] auto loadFileFromUri(URIView& uri) const noexcept -> Expected<DataSource>;
+		[[nodiscard]] auto mapFileFromUri(URIView& uri, Asset& asset) const noexcept -> Expected<DataSource>;
 #if defined(__ANDROID__)
 		[[nodiscard]] auto loadFileFromApk(const std::filesystem::path& filepath) const noexcept -> Expected<DataSource>;
 #endif
+		[[nodiscard]] Error loadDeferredFiles(Asset& asset) const;
+		void executeTasks(std::size_t taskCount, TaskFunction* task, void* taskData) const;
+
+		Error processParsedCategories(Asset& asset, Category parsedCategories);
+		static Error parseRetainedCategories(Asset& asset, Category categories);
 
 		Error generateMeshIndices(Asset& asset) const;
+		Error decompressMeshoptBufferViews(Asset& asset) const;
+		Error decodeDracoPrimitives(Asset& asset) const;
 
 		Error parseAccessors(simdjson::dom::array& array, Asset& asset);
 		Error parseAnimations(simdjson::dom::array& array, Asset& asset);
@@ -822,12 +1155,17 @@ namespace fastgltf {
 		Error parseMaterials(simdjson::dom::array& array, Asset& asset);
 		Error parsePrimitiveExtensions(simdjson::dom::object& object, Primitive& primitive);
 		Error parseMeshes(simdjson::dom::array& array, Asset& asset);
+		Error parseNodeExtensions(simdjson::dom::object& object, Node& node);
 		Error parseNodes(simdjson::dom::array& array, Asset& asset);
 		Error parseSamplers(simdjson::dom::array& array, Asset& asset);
 		Error parseScenes(simdjson::dom::array& array, Asset& asset);
 		Error parseSkins(simdjson::dom::array& array, Asset& asset);
 		Error parseTextures(simdjson::dom::array& array, Asset& asset);
-		Expected<Asset> parse(simdjson::dom::object root, Category categories);
+		Error parseCategory(Category category, simdjson::dom::array& array, Asset& asset);
+		Asset createAsset(std::size_t expectedSize);
+		template <typename JsonRoot>
+		Expected<Asset> parse(JsonRoot& root, std::size_t jsonSize, Category categories);
+		Expected<Asset> parseAssetCache(span<const std::byte> bytes, bool referenceData, std::uint64_t sourceHash);
 
     public:
         explicit Parser(Extensions extensionsToLoad = Extensions::None) noexcept;
@@ -861,6 +1199,44 @@ namespace fastgltf {
 		 */
 		[[nodiscard]] Expected<Asset> loadGltfBinary(GltfDataGetter& buffer, std::filesystem::path directory, Options options = Options::None, Category categories = Category::All);
 
+		/**
+		 * Same as Parser::loadGltf, but the returned Asset shares ownership of the data getter. This is required
+		 * to safely use Options::ReferenceGLBBuffer, as the first buffer then points into the memory of the data getter.
+		 */
+		[[nodiscard]] Expected<Asset> loadGltf(std::shared_ptr<GltfDataGetter> buffer, std::filesystem::path directory, Options options = Options::None, Category categories = Category::All);
+
+		/**
+		 * Same as Parser::loadGltfBinary, but the returned Asset shares ownership of the data getter. This is required
+		 * to safely use Options::ReferenceGLBBuffer, as the first buffer then points into the memory of the data getter.
+		 */
+		[[nodiscard]] Expected<Asset> loadGltfBinary(std::shared_ptr<GltfDataGetter> buffer, std::filesystem::path directory, Options options = Options::None, Category categories = Category::All);
+
+		/**
+		 * Loads an asset from a cache written by writeAssetCache. The embedded buffers and images are copied out of
+		 * the cache into sources::Array. Like when parsing JSON, only the asset's pmr containers are allocated from the
+		 * parser's memory resource, while members like std::vector or std::unique_ptr use the default heap.
+		 *
+		 * @param sourceHash the hash of the source file, usually from hashGltfData.
+		 * @return Error::InvalidCache if the cache is damaged, was written by an incompatible build, or its source
+		 * hash does not match.
+		 */
+		[[nodiscard]] Expected<Asset> loadAssetCache(GltfDataGetter& data, std::uint64_t sourceHash);
+
+		/**
+		 * Same as Parser::loadAssetCache, but the returned Asset shares ownership of the data getter. If the data
+		 * getter keeps all of its data in memory, like GltfDataBuffer or MappedGltfFile, the embedded buffers and
+		 * images are not copied and are returned as sources::ByteView into the cache instead.
+		 */
+		[[nodiscard]] Expected<Asset> loadAssetCache(std::shared_ptr<GltfDataGetter> data, std::uint64_t sourceHash);
+
+		/**
+		 * Loads a glTF file on a separate thread, and returns a future to the resulting asset. When used with an
+		 * AsyncGltfFile and a GLB file, the JSON chunk is parsed by simdjson while the rest of the file is still being read.
+		 *
+		 * @note The parser must not be used or destroyed until the returned future is ready.
+		 */
+		[[nodiscard]] std::future<Expected<Asset>> loadGltfAsync(std::shared_ptr<GltfDataGetter> buffer, std::filesystem::path directory, Options options = Options::None, Category categories = Category::All);
+
         /**
          * This function can be used to set callbacks so that you can control memory allocation for
          * large buffers and images that are loaded from a glTF file. For example, one could use
@@ -893,9 +1269,149 @@ namespace fastgltf {
 
 		void setExtrasParseCallback(ExtrasParseCallback* extrasCallback) noexcept;
 
+		/**
+		 * Allows setting a callback which is used to execute work concurrently, for example with
+		 * Options::LoadExternalFilesInParallel. The callback has to invoke the task function once for every
+		 * index in [0, taskCount) with the given task data, and may only return once all tasks have finished.
+		 * This can be used to schedule fastgltf's work on your own job system instead of fastgltf spawning threads.
+		 * Using Parser::setUserPointer you can also set a user pointer to access your own class or other data you may need.
+		 *
+		 * @param executorCallback function called when the parser has work that can be executed concurrently,
+		 * or nullptr to use fastgltf's own threads.
+		 */
+		void setTaskExecutorCallback(TaskExecutorCallback* executorCallback) noexcept;
+
+		/**
+		 * Allows setting a callback which decodes primitives compressed with KHR_draco_mesh_compression, as fastgltf
+		 * does not include a Draco decoder itself. When set, the parser invokes the callback for every Draco primitive
+		 * concurrently, using the same threads or executor as Options::LoadExternalFilesInParallel. The decoded data
+		 * is placed in a new buffer, and the primitive's accessors are changed to point into it, so that tools like
+		 * iterateAccessor can read the decoded data. Afterwards, Primitive::dracoCompression is reset.
+		 * The buffers need to be loaded, and a failed decode makes parsing return Error::DecompressionFailed.
+		 * Buffers filled through the BufferMapCallback cannot be decoded and make parsing return Error::UnreadableMappedBuffer.
+		 *
+		 * @param dracoCallback function called to decode a Draco compressed primitive, or nullptr to leave them compressed.
+		 */
+		void setDracoDecodeCallback(DracoDecodeCallback* dracoCallback) noexcept;
+
+#if FASTGLTF_ENABLE_PROFILING
+		/**
+		 * Allows setting a callback which receives the timestamps, byte counts, and element counts of every stage
+		 * of loading a glTF, for example to forward them to a tracing system. This is only available when fastgltf
+		 * is built with FASTGLTF_ENABLE_PROFILING, as all instrumentation is compiled out otherwise.
+		 * Using Parser::setUserPointer you can also set a user pointer to access your own class or other data you may need.
+		 *
+		 * @param profilingCallback function called when a stage has finished, or nullptr to not report any stages.
+		 */
+		void setProfilingCallback(ProfilingCallback* profilingCallback) noexcept;
+#endif
+
         void setUserPointer(void* pointer) noexcept;
+
+#if !FASTGLTF_DISABLE_CUSTOM_MEMORY_POOL
+		/**
+		 * Sets the memory resource from which the memory of every asset is allocated in a few large chunks, sized
+		 * from the size of the JSON. By default, std::pmr::get_default_resource() is used. The memory of an asset is
+		 * reused for the next asset once it has been destroyed, so that repeated loads skip the allocations.
+		 * The resource has to outlive all assets loaded with this parser, and has to be thread-safe when using
+		 * Options::ParseCategoriesInParallel.
+		 *
+		 * @param resource the upstream memory resource, or nullptr to use the default resource.
+		 */
+		void setUpstreamMemoryResource(std::pmr::memory_resource* resource) noexcept;
+#endif
+
+		/**
+		 * Allocates the JSON parser's internal buffers for documents of up to the given size in bytes, so that
+		 * loading such documents does not need to grow them first.
+		 */
+		void reserveJsonBuffers(std::size_t capacity);
+
+		/**
+		 * The JSON parser's internal buffers only ever grow to fit the largest document loaded so far. This releases
+		 * them if they have grown past maxCapacity bytes, and allocates them again for documents of up to that size.
+		 */
+		void shrinkJsonBuffers(std::size_t maxCapacity);
     };
 
+	/**
+	 * A pool of parsers which loads batches of glTF files concurrently, with every parser loading one file at a time.
+	 * Each parser keeps its JSON buffers between files, which are allocated upfront for documents up to the retained
+	 * capacity. When a larger document grows them, they're shrunk back to the retained capacity after that file.
+	 *
+	 * @note A single pool is not thread-safe, but multiple pools can be used concurrently.
+	 */
+	class ParserPool {
+		std::vector<Parser> parsers;
+		std::size_t retainedJsonCapacity;
+
+		TaskExecutorCallback* executorCallback = nullptr;
+		void* userPointer = nullptr;
+
+		struct LoadTaskData;
+		std::vector<Expected<Asset>> load(LoadTaskData& data);
+
+	public:
+		static constexpr std::size_t defaultRetainedJsonCapacity = 1024 * 1024;
+
+		/**
+		 * @param parserCount the number of parsers and therefore the maximum number of files loaded concurrently,
+		 * or 0 to use one parser per hardware thread.
+		 * @param retainedJsonCapacity the size in bytes of the documents each parser's JSON buffers are kept for.
+		 * The buffers themselves take up a small multiple of this.
+		 */
+		explicit ParserPool(Extensions extensionsToLoad = Extensions::None, std::size_t parserCount = 0,
+				std::size_t retainedJsonCapacity = defaultRetainedJsonCapacity);
+
+		/**
+		 * Loads every data getter with Parser::loadGltf, using the directory with the same index. The data getters are
+		 * only read by one thread at a time, and have to stay alive until this returns.
+		 *
+		 * @return The assets or errors, in the same order as the data getters.
+		 */
+		[[nodiscard]] std::vector<Expected<Asset>> loadGltfs(span<GltfDataGetter* const> data,
+				span<const std::filesystem::path> directories, Options options = Options::None, Category categories = Category::All);
+
+		/**
+		 * Reads and loads every file, using the parent directory of each path for external resources.
+		 * Where available, the files are memory-mapped.
+		 *
+		 * @return The assets or errors, in the same order as the paths.
+		 */
+		[[nodiscard]] std::vector<Expected<Asset>> loadGltfs(span<const std::filesystem::path> paths,
+				Options options = Options::None, Category categories = Category::All);
+
+		[[nodiscard]] std::size_t parserCount() const noexcept {
+			return parsers.size();
+		}
+
+		/** Sets the buffer allocation callbacks of every parser. See Parser::setBufferAllocationCallback. */
+		void setBufferAllocationCallback(BufferMapCallback* mapCallback, BufferUnmapCallback* unmapCallback = nullptr) noexcept;
+
+		/** Sets the base64 decode callback of every parser. See Parser::setBase64DecodeCallback. */
+		void setBase64DecodeCallback(Base64DecodeCallback* decodeCallback) noexcept;
+
+		/** Sets the extras parse callback of every parser, which is then called concurrently. */
+		void setExtrasParseCallback(ExtrasParseCallback* extrasCallback) noexcept;
+
+		/** Sets the Draco decode callback of every parser. See Parser::setDracoDecodeCallback. */
+		void setDracoDecodeCallback(DracoDecodeCallback* dracoCallback) noexcept;
+
+#if FASTGLTF_ENABLE_PROFILING
+		/** Sets the profiling callback of every parser, which is then called concurrently. See Parser::setProfilingCallback. */
+		void setProfilingCallback(ProfilingCallback* profilingCallback) noexcept;
+#endif
+
+		/**
+		 * Sets the executor used to run the parsers concurrently, which every parser also uses for its own concurrent
+		 * work. See Parser::setTaskExecutorCallback.
+		 */
+		void setTaskExecutorCallback(TaskExecutorCallback* executorCallback) noexcept;
+
+		/** Sets the user pointer passed to all callbacks. */
+		void setUserPointer(void* pointer) noexcept;
+	};
+
     /**
      * This converts a compacted JSON string into a more readable pretty format.
      */
@@ -906,6 +1422,13 @@ namespace fastgltf {
      */
     std::string escapeString(std::string_view string);
 
+    /**
+     * Function receiving the consecutive byte ranges of a streamed GLB. The ranges either point to data owned by the
+     * exporter or directly into the asset's buffers, and are only valid during the call, which may happen multiple times.
+     * Returning false aborts the export with Error::FailedWritingFiles.
+     */
+    FASTGLTF_EXPORT using BinaryWriteCallback = bool(span<const span<const std::byte>> ranges, void* userPointer);
+
     FASTGLTF_EXPORT template <typename T>
     struct ExportResult {
         T output;
@@ -914,6 +1437,8 @@ namespace fastgltf {
         std::vector<std::optional<std::filesystem::path>> imagePaths;
     };
 
+	class JsonOutput;
+
     /**
      * A exporter for serializing one or more glTF assets into JSON and GLB forms.
      *
@@ -932,31 +1457,50 @@ namespace fastgltf {
 
 		void* userPointer = nullptr;
 		ExtrasWriteCallback* extrasWriteCallback = nullptr;
+		TaskExecutorCallback* executorCallback = nullptr;
 
         std::vector<std::optional<std::filesystem::path>> bufferPaths;
         std::vector<std::optional<std::filesystem::path>> imagePaths;
 
-        void writeAccessors(const Asset& asset, std::string& json);
-        void writeAnimations(const Asset& asset, std::string& json);
-        void writeBuffers(const Asset& asset, std::string& json);
-        void writeBufferViews(const Asset& asset, std::string& json);
-        void writeCameras(const Asset& asset, std::string& json);
-        void writeImages(const Asset& asset, std::string& json);
-        void writeLights(const Asset& asset, std::string& json);
-        void writeMaterials(const Asset& asset, std::string& json);
-        void writeMeshes(const Asset& asset, std::string& json);
-        void writeNodes(const Asset& asset, std::string& json);
-        void writeSamplers(const Asset& asset, std::string& json);
-        void writeScenes(const Asset& asset, std::string& json);
-        void writeSkins(const Asset& asset, std::string& json);
-        void writeTextures(const Asset& asset, std::string& json);
-        void writeExtensions(const Asset& asset, std::string& json);
+		/**
+		 * The index and byte offset every buffer has in the exported asset, which only differ from the asset's when
+		 * buffers are merged into the BIN chunk. Empty if no buffers are merged.
+		 */
+		std::vector<std::size_t> bufferIndices;
+		std::vector<std::size_t> bufferOffsets;
+		std::size_t mergedBufferLength = 0;
+
+        void writeAccessors(const Asset& asset, JsonOutput& json);
+        void writeAnimations(const Asset& asset, JsonOutput& json);
+        void writeBuffers(const Asset& asset, JsonOutput& json);
+        void writeBufferViews(const Asset& asset, JsonOutput& json);
+        void writeCameras(const Asset& asset, JsonOutput& json);
+        void writeImages(const Asset& asset, JsonOutput& json);
+        void writeLights(const Asset& asset, JsonOutput& json);
+        void writeMaterials(const Asset& asset, JsonOutput& json);
+        void writeMeshes(const Asset& asset, JsonOutput& json);
+        void writeNodes(const Asset& asset, JsonOutput& json);
+        void writeSamplers(const Asset& asset, JsonOutput& json);
+        void writeScenes(const Asset& asset, JsonOutput& json);
+        void writeSkins(const Asset& asset, JsonOutput& json);
+        void writeTextures(const Asset& asset, JsonOutput& json);
+        void writeExtensions(const Asset& asset, JsonOutput& json);
+
+        [[nodiscard]] std::size_t getExportedBufferIndex(std::size_t bufferIndex) const noexcept;
+        [[nodiscard]] std::size_t getExportedBufferOffset(std::size_t bufferIndex) const noexcept;
 
         std::filesystem::path getBufferFilePath(const Asset& asset, std::size_t index);
         std::filesystem::path getImageFilePath(const Asset& asset, std::size_t index, MimeType mimeType);
 
         std::string writeJson(const Asset& asset);
 
+		/**
+		 * Writes the JSON of a GLB and collects the byte ranges making up the file into ranges. Besides the json
+		 * string and the headers array, these point directly into the asset's buffers. Returns the total size.
+		 */
+		Expected<std::size_t> writeBinaryRanges(const Asset& asset, ExportOptions options, std::string& json,
+				std::array<std::byte, 28>& headers, std::vector<span<const std::byte>>& ranges);
+
     public:
         /**
          * Sets the relative base path for buffer URIs.
@@ -973,6 +1517,11 @@ namespace fastgltf {
 
 		void setExtrasWriteCallback(ExtrasWriteCallback* callback) noexcept;
 
+		/**
+		 * Sets the executor used by ExportOptions::WriteCategoriesInParallel. See Parser::setTaskExecutorCallback.
+		 */
+		void setTaskExecutorCallback(TaskExecutorCallback* executorCallback) noexcept;
+
 		void setUserPointer(void* pointer) noexcept;
 
         /**
@@ -987,6 +1536,19 @@ namespace fastgltf {
          * it will be embedded into the binary. Note that the returned vector might therefore get quite large.
          */
         Expected<ExportResult<std::vector<std::byte>>> writeGltfBinary(const Asset& asset, ExportOptions options = ExportOptions::None);
+
+        /**
+         * Streams a glTF binary (GLB) from the given asset to the callback, without assembling the file in memory.
+         * The embedded buffers are passed to the callback directly from the asset. The output holds the size of the GLB.
+         */
+        Expected<ExportResult<std::size_t>> writeGltfBinary(const Asset& asset, BinaryWriteCallback* callback,
+				void* callbackUserPointer, ExportOptions options = ExportOptions::None);
+
+        /**
+         * Streams a glTF binary (GLB) from the given asset into the stream, without assembling the file in memory.
+         * The output holds the size of the GLB.
+         */
+        Expected<ExportResult<std::size_t>> writeGltfBinary(const Asset& asset, std::ostream& stream, ExportOptions options = ExportOptions::None);
     };
 
 	/**
@@ -1012,7 +1574,8 @@ namespace fastgltf {
          * Exporter::setImagePath.
          *
 		 * If the first buffer holds a sources::Vector, a sources::Array, a or sources::ByteView and the byte length is smaller than 2^32 (4.2GB),
-         * it will be embedded into the binary.
+         * it will be embedded into the binary. The file is streamed straight from the asset's buffers, using
+         * scatter-gather writes where the platform supports it.
          *
 		 * \see Exporter::writeGltfBinary
 		 */
@@ -35,6 +35,28 @@
 
 #include <fastgltf/util.hpp>
 
+// The SIMD kernels are chosen at compile time, as the math functions are all inline. SSE2 and Neon are part of
+// the baseline of x86-64 and AArch64. FASTGLTF_DISABLE_MATH_SIMD can be defined to always use the scalar code.
+#if !defined(FASTGLTF_DISABLE_MATH_SIMD)
+#if defined(FASTGLTF_IS_X86) && (defined(__SSE2__) || defined(_M_AMD64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#include <emmintrin.h>
+#define FASTGLTF_MATH_SSE 1
+#elif defined(FASTGLTF_IS_A64)
+#include <arm_neon.h>
+#define FASTGLTF_MATH_NEON 1
+#endif
+#endif
+
+#if FASTGLTF_CPP_20
+#define FASTGLTF_IS_CONSTANT_EVALUATED() std::is_constant_evaluated()
+#define FASTGLTF_HAS_CONSTANT_EVALUATED 1
+#elif FASTGLTF_HAS_BUILTIN(__builtin_is_constant_evaluated) || (defined(__GNUC__) && __GNUC__ >= 9) || (defined(_MSC_VER) && _MSC_VER >= 1925)
+#define FASTGLTF_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+#define FASTGLTF_HAS_CONSTANT_EVALUATED 1
+#else
+#define FASTGLTF_HAS_CONSTANT_EVALUATED 0
+#endif
+
 /**
  * The fastgltf::math namespace contains all math functions and types which are needed for working with glTF assets.
  */
@@ -69,6 +91,64 @@ namespace fastgltf::math {
 	FASTGLTF_EXPORT template <typename T, std::size_t N, std::size_t M>
 	class mat;
 
+	namespace internal {
+		/**
+		 * The SIMD kernels for 4x4 float matrices, operating on column-major arrays of 16 floats. They perform the
+		 * same operations in the same order as the scalar code, without fused multiply-adds, so the results are
+		 * bit-identical to the scalar implementations.
+		 */
+#if FASTGLTF_MATH_SSE
+		FASTGLTF_FORCEINLINE void multiplyMat4(const float* a, const float* b, float* result) noexcept {
+			const auto c0 = _mm_loadu_ps(a + 0);
+			const auto c1 = _mm_loadu_ps(a + 4);
+			const auto c2 = _mm_loadu_ps(a + 8);
+			const auto c3 = _mm_loadu_ps(a + 12);
+			for (std::size_t i = 0; i < 4; ++i) {
+				// The scalar code starts with a zero matrix, which matters for the sign of zero results.
+				auto column = _mm_add_ps(_mm_setzero_ps(), _mm_mul_ps(c0, _mm_set1_ps(b[i * 4 + 0])));
+				column = _mm_add_ps(column, _mm_mul_ps(c1, _mm_set1_ps(b[i * 4 + 1])));
+				column = _mm_add_ps(column, _mm_mul_ps(c2, _mm_set1_ps(b[i * 4 + 2])));
+				column = _mm_add_ps(column, _mm_mul_ps(c3, _mm_set1_ps(b[i * 4 + 3])));
+				_mm_storeu_ps(result + i * 4, column);
+			}
+		}
+
+		/** Computes the last column of a matrix translated by the given vector */
+		FASTGLTF_FORCEINLINE void translateMat4(const float* m, const float* translation, float* result) noexcept {
+			auto column = _mm_mul_ps(_mm_loadu_ps(m + 0), _mm_set1_ps(translation[0]));
+			column = _mm_add_ps(column, _mm_mul_ps(_mm_loadu_ps(m + 4), _mm_set1_ps(translation[1])));
+			column = _mm_add_ps(column, _mm_mul_ps(_mm_loadu_ps(m + 8), _mm_set1_ps(translation[2])));
+			column = _mm_add_ps(column, _mm_loadu_ps(m + 12));
+			_mm_storeu_ps(result, column);
+		}
+#elif FASTGLTF_MATH_NEON
+		FASTGLTF_FORCEINLINE void multiplyMat4(const float* a, const float* b, float* result) noexcept {
+			const auto c0 = vld1q_f32(a + 0);
+			const auto c1 = vld1q_f32(a + 4);
+			const auto c2 = vld1q_f32(a + 8);
+			const auto c3 = vld1q_f32(a + 12);
+			for (std::size_t i = 0; i < 4; ++i) {
+				// The scalar code starts with a zero matrix, which matters for the sign of zero results.
+				// vmlaq_f32 is not used, as it may be compiled into a fused multiply-add.
+				auto column = vaddq_f32(vdupq_n_f32(0.f), vmulq_n_f32(c0, b[i * 4 + 0]));
+				column = vaddq_f32(column, vmulq_n_f32(c1, b[i * 4 + 1]));
+				column = vaddq_f32(column, vmulq_n_f32(c2, b[i * 4 + 2]));
+				column = vaddq_f32(column, vmulq_n_f32(c3, b[i * 4 + 3]));
+				vst1q_f32(result + i * 4, column);
+			}
+		}
+
+		/** Computes the last column of a matrix translated by the given vector */
+		FASTGLTF_FORCEINLINE void translateMat4(const float* m, const float* translation, float* result) noexcept {
+			auto column = vmulq_n_f32(vld1q_f32(m + 0), translation[0]);
+			column = vaddq_f32(column, vmulq_n_f32(vld1q_f32(m + 4), translation[1]));
+			column = vaddq_f32(column, vmulq_n_f32(vld1q_f32(m + 8), translation[2]));
+			column = vaddq_f32(column, vld1q_f32(m + 12));
+			vst1q_f32(result, column);
+		}
+#endif
+	} // namespace internal
+
 	FASTGLTF_EXPORT template <typename T, std::size_t N>
 	class vec {
 		static_assert(N >= 2 && N <= 4);
@@ -566,9 +646,10 @@ namespace fastgltf::math {
 	[[nodiscard]] auto slerp(quat<T> a, quat<T> b, T interpolation) noexcept {
 		auto d = dot(a, b);
 
+		// Take the shorter path by negating one of the quaternions, which represents the same rotation.
 		if (d < T(0)) {
-			a = -a;
 			b = -b;
+			d = -d;
 		}
 
 		if (d > T(0.9995)) // Simple linear interpolation when both quats are close to each other
@@ -744,6 +825,15 @@ namespace fastgltf::math {
 
 		template <std::size_t P, std::size_t Q, std::enable_if_t<M == P, bool> = true>
 		constexpr auto operator*(const mat<T, P, Q>& other) const noexcept {
+#if (FASTGLTF_MATH_SSE || FASTGLTF_MATH_NEON) && FASTGLTF_HAS_CONSTANT_EVALUATED
+			if constexpr (std::is_same_v<T, float> && N == 4 && M == 4 && Q == 4) {
+				if (!FASTGLTF_IS_CONSTANT_EVALUATED()) {
+					mat<T, N, Q> ret;
+					internal::multiplyMat4(data(), other.data(), ret.data());
+					return ret;
+				}
+			}
+#endif
 			mat<T, N, Q> ret(0.f);
 			for (std::size_t i = 0; i < other.columns(); ++i)
 				for (std::size_t j = 0; j < rows(); ++j)
@@ -815,6 +905,12 @@ namespace fastgltf::math {
 	FASTGLTF_EXPORT template <typename T>
 	[[nodiscard]] auto translate(const mat<T, 4, 4>& m, const vec<T, 3>& translation) noexcept {
 		mat<T, 4, 4> ret = m;
+#if FASTGLTF_MATH_SSE || FASTGLTF_MATH_NEON
+		if constexpr (std::is_same_v<T, float>) {
+			internal::translateMat4(m.data(), translation.data(), ret.col(3).data());
+			return ret;
+		}
+#endif
 		ret.col(3) = m.col(0) * translation.x() + m.col(1) * translation.y() + m.col(2) * translation.z() + m.col(3);
 		return ret;
 	}
@@ -836,6 +932,22 @@ namespace fastgltf::math {
 		return m * mat<T, 4, 4>(asMatrix(rot));
 	}
 
+	/**
+	 * Computes the transform matrix of the given translation, rotation, and scale, which is equal to
+	 * translate(T) * rotate(R) * scale(S), but computed directly from the rotation matrix.
+	 */
+	FASTGLTF_EXPORT template <typename T>
+	[[nodiscard]] auto composeTransformMatrix(const vec<T, 3>& translation, const quat<T>& rotation, const vec<T, 3>& scale) noexcept {
+		const auto rotationMatrix = asMatrix(rotation);
+		mat<T, 4, 4> ret;
+		for (std::size_t i = 0; i < 3; ++i) {
+			const auto& column = rotationMatrix.col(i);
+			ret.col(i) = vec<T, 4>(column.x() * scale[i], column.y() * scale[i], column.z() * scale[i], T(0));
+		}
+		ret.col(3) = vec<T, 4>(translation.x(), translation.y(), translation.z(), T(1));
+		return ret;
+	}
+
 	FASTGLTF_EXPORT template <std::size_t N, std::size_t M> using fmat = mat<float, N, M>;
 	FASTGLTF_EXPORT using fmat2x2 = fmat<2, 2>;
 	FASTGLTF_EXPORT using fmat3x3 = fmat<3, 3>;
@@ -399,7 +399,8 @@ bool findSparseIndex(const std::byte* indices, std::size_t indexCount, std::size
 		auto step = count / 2;
 		auto index = resultIndex + step;
 
-		if (deserializeComponent<ElementType>(indices, index) < static_cast<ElementType>(desiredIndex)) {
+		// We compare in std::size_t, as casting desiredIndex to the index type could wrap around.
+		if (static_cast<std::size_t>(deserializeComponent<ElementType>(indices, index)) < desiredIndex) {
 			resultIndex = index + 1;
 			count -= step + 1;
 		} else {
@@ -407,7 +408,7 @@ bool findSparseIndex(const std::byte* indices, std::size_t indexCount, std::size
 		}
 	}
 
-	return resultIndex < indexCount && deserializeComponent<ElementType>(indices, resultIndex) == static_cast<ElementType>(desiredIndex);
+	return resultIndex < indexCount && static_cast<std::size_t>(deserializeComponent<ElementType>(indices, resultIndex)) == desiredIndex;
 }
 
 // Finds the index of the nearest sparse index to the desired index
@@ -435,6 +436,206 @@ inline bool findSparseIndex(ComponentType componentType, const std::byte* bytes,
 	return false;
 }
 
+/**
+ * Signature of the bulk conversion kernels, which convert componentCount tightly packed
+ * components from source into tightly packed components at destination.
+ */
+using ComponentConversionFunction = void(const std::byte* source, void* destination, std::size_t componentCount);
+
+/**
+ * Returns a vectorized kernel converting from sourceType to destinationType, chosen at runtime
+ * depending on the available SSE4/AVX2/NEON instructions, the same way the base64 decoder does.
+ * Returns nullptr if there is no kernel for that combination of component types.
+ */
+ComponentConversionFunction* getComponentConversionFunction(ComponentType sourceType, ComponentType destinationType, bool normalized);
+
+/**
+ * Converts count elements using the given kernel. Elements which are not tightly packed in the
+ * source or destination are gathered into or scattered out of a small stack buffer, so that the
+ * kernel always operates on contiguous components.
+ */
+inline void convertElements(ComponentConversionFunction* convert, std::size_t componentCount, std::size_t count,
+		const std::byte* src, std::size_t srcStride, std::size_t srcElementSize,
+		std::byte* dst, std::size_t dstStride, std::size_t dstElementSize) {
+	if (srcStride == srcElementSize && dstStride == dstElementSize) {
+		convert(src, dst, componentCount * count);
+		return;
+	}
+
+	// The kernels only exist for up to four 32-bit components per element.
+	constexpr std::size_t chunkSize = 64;
+	constexpr std::size_t maxElementSize = 4 * sizeof(std::uint32_t);
+	assert(srcElementSize <= maxElementSize && dstElementSize <= maxElementSize);
+
+	alignas(32) std::byte srcChunk[chunkSize * maxElementSize];
+	alignas(32) std::byte dstChunk[chunkSize * maxElementSize];
+	for (std::size_t base = 0; base < count; base += chunkSize) {
+		const auto chunkCount = min(chunkSize, count - base);
+
+		const auto* chunkSrc = src + base * srcStride;
+		if (srcStride != srcElementSize) {
+			for (std::size_t i = 0; i < chunkCount; ++i) {
+				std::memcpy(srcChunk + i * srcElementSize, chunkSrc + i * srcStride, srcElementSize);
+			}
+			chunkSrc = srcChunk;
+		}
+
+		if (dstStride == dstElementSize) {
+			convert(chunkSrc, dst + base * dstStride, chunkCount * componentCount);
+		} else {
+			convert(chunkSrc, dstChunk, chunkCount * componentCount);
+			for (std::size_t i = 0; i < chunkCount; ++i) {
+				std::memcpy(dst + (base + i) * dstStride, dstChunk + i * dstElementSize, dstElementSize);
+			}
+		}
+	}
+}
+
+/** Decodes count sparse indices of the given component type into 32-bit integers. */
+inline void decodeSparseIndices(ComponentType indexType, const std::byte* indices, std::size_t count, std::uint32_t* dst) {
+	if (indexType == ComponentType::UnsignedInt) {
+		for (std::size_t i = 0; i < count; ++i) {
+			dst[i] = deserializeComponent<std::uint32_t>(indices, i);
+		}
+	} else if (auto* convert = getComponentConversionFunction(indexType, ComponentType::UnsignedInt, false); convert != nullptr) {
+		convert(indices, dst, count);
+	} else {
+		for (std::size_t i = 0; i < count; ++i) {
+			dst[i] = getAccessorComponentAt<std::uint32_t>(indexType, AccessorType::Scalar, indices, i);
+		}
+	}
+}
+
+template <typename SourceType, bool Normalized>
+struct ComponentSource {
+	using type = SourceType;
+	static constexpr bool normalized = Normalized;
+};
+
+template <typename SourceType, typename Functor>
+void visitComponentSource(bool normalized, Functor& func) {
+	if (normalized) {
+		func(ComponentSource<SourceType, true> {});
+	} else {
+		func(ComponentSource<SourceType, false> {});
+	}
+}
+
+/**
+ * Resolves the component type and normalization of an accessor to a ComponentSource tag once, so
+ * that the functor can instantiate loops specialized for that exact source type, instead of
+ * switching on the component type for every element.
+ * Returns false without invoking the functor if the component type is invalid.
+ */
+template <typename Functor>
+bool visitComponentSource(ComponentType componentType, bool normalized, Functor&& func) {
+	switch (componentType) {
+		case ComponentType::Byte:
+			visitComponentSource<std::int8_t>(normalized, func);
+			return true;
+		case ComponentType::UnsignedByte:
+			visitComponentSource<std::uint8_t>(normalized, func);
+			return true;
+		case ComponentType::Short:
+			visitComponentSource<std::int16_t>(normalized, func);
+			return true;
+		case ComponentType::UnsignedShort:
+			visitComponentSource<std::uint16_t>(normalized, func);
+			return true;
+		case ComponentType::Int:
+			visitComponentSource<std::int32_t>(normalized, func);
+			return true;
+		case ComponentType::UnsignedInt:
+			visitComponentSource<std::uint32_t>(normalized, func);
+			return true;
+		case ComponentType::Float:
+			visitComponentSource<float>(normalized, func);
+			return true;
+		case ComponentType::Double:
+			visitComponentSource<double>(normalized, func);
+			return true;
+		case ComponentType::Invalid:
+		default:
+			return false;
+	}
+}
+
+/** Converts a single element from the given source component type, without any runtime dispatch. */
+template <typename ElementType, typename SourceType, bool Normalized,
+		typename Seq = std::make_index_sequence<getNumComponents(ElementTraits<ElementType>::type)>>
+ElementType convertElement(const std::byte* bytes) {
+	return convertAccessorElement<ElementType, SourceType>(bytes, Normalized, Seq{});
+}
+
+template <typename ElementType>
+using ElementConversionFunction = ElementType(const std::byte* bytes);
+
+template <typename ElementType>
+ElementType defaultElement(const std::byte*) {
+	if constexpr (std::is_aggregate_v<ElementType>) {
+		return ElementType {};
+	} else {
+		return ElementType();
+	}
+}
+
+/**
+ * Returns the element conversion function for the given source component type. Just like
+ * getAccessorElementAt, invalid component types produce default constructed elements.
+ */
+template <typename ElementType>
+ElementConversionFunction<ElementType>* getElementConversionFunction(ComponentType componentType, bool normalized) {
+	ElementConversionFunction<ElementType>* function = defaultElement<ElementType>;
+	visitComponentSource(componentType, normalized, [&](auto source) {
+		using Source = decltype(source);
+		function = convertElement<ElementType, typename Source::type, Source::normalized>;
+	});
+	return function;
+}
+
+constexpr std::size_t sparseChunkSize = 64;
+
+/**
+ * Walks the sparse indices and values of the accessor that target elements in [firstElement, lastElement),
+ * in chunks of up to sparseChunkSize elements. The functor receives the decoded indices next to the still unconverted, tightly packed values,
+ * so that the values can be converted in bulk before being scattered into the destination.
+ */
+template <typename BufferDataAdapter, typename Functor>
+void iterateSparseChunks(const Asset& asset, const Accessor& accessor, const BufferDataAdapter& adapter,
+		std::size_t firstElement, std::size_t lastElement, Functor&& func) {
+	const auto& sparse = *accessor.sparse;
+	auto indicesBytes = adapter(asset, sparse.indicesBufferView).subspan(sparse.indicesByteOffset);
+	auto indexSize = getElementByteSize(AccessorType::Scalar, sparse.indexComponentType);
+
+	// "The index of the bufferView with sparse values. The referenced buffer view MUST NOT
+	// have its target or byteStride properties defined."
+	auto valuesBytes = adapter(asset, sparse.valuesBufferView).subspan(sparse.valuesByteOffset);
+	auto valueSize = getElementByteSize(accessor.type, accessor.componentType);
+
+	// As the sparse indices are sorted, we can binary search for the first one inside the range.
+	std::size_t start = 0;
+	if (firstElement != 0) {
+		findSparseIndex(sparse.indexComponentType, indicesBytes.data(), sparse.count, firstElement, start);
+	}
+
+	std::array<std::uint32_t, sparseChunkSize> indices;
+	for (std::size_t base = start; base < sparse.count; base += sparseChunkSize) {
+		const auto count = min(sparseChunkSize, sparse.count - base);
+		decodeSparseIndices(sparse.indexComponentType, indicesBytes.data() + base * indexSize, count, indices.data());
+
+		// Cut the chunk off at the first index past the range.
+		std::size_t inRange = 0;
+		while (inRange < count && indices[inRange] < lastElement)
+			++inRange;
+
+		if (inRange != 0) {
+			std::invoke(func, indices.data(), valuesBytes.data() + base * valueSize, valueSize, inRange);
+		}
+		if (inRange != count)
+			break;
+	}
+}
+
 } // namespace internal
 
 FASTGLTF_EXPORT struct DefaultBufferDataAdapter {
@@ -492,8 +693,7 @@ public:
 			: accessor(accessor), idx(idx) {
 		if (accessor->accessor.sparse.has_value()) {
 			// Get the first sparse index.
-			nextSparseIndex = internal::getAccessorElementAt<std::uint32_t>(accessor->indexComponentType,
-			                                                                &accessor->indicesBytes[accessor->indexStride * sparseIdx]);
+			nextSparseIndex = accessor->convertIndex(&accessor->indicesBytes[accessor->indexStride * sparseIdx]);
 		}
 	}
 
@@ -529,23 +729,18 @@ public:
 		if (accessor->accessor.sparse.has_value()) {
 			if (idx == nextSparseIndex) {
 				// Get the sparse value for this index
-				auto value = internal::getAccessorElementAt<ElementType>(accessor->componentType,
-																		 &accessor->valuesBytes[accessor->valueStride * sparseIdx],
-																		 accessor->accessor.normalized);
+				auto value = accessor->convertElement(&accessor->valuesBytes[accessor->valueStride * sparseIdx]);
 
 				// Find the next sparse index.
 				++sparseIdx;
 				if (sparseIdx < accessor->sparseCount) {
-					nextSparseIndex = internal::getAccessorElementAt<std::uint32_t>(accessor->indexComponentType,
-					                                                                &accessor->indicesBytes[accessor->indexStride * sparseIdx]);
+					nextSparseIndex = accessor->convertIndex(&accessor->indicesBytes[accessor->indexStride * sparseIdx]);
 				}
 				return value;
 			}
 		}
 
-		return internal::getAccessorElementAt<ElementType>(accessor->componentType,
-														   &accessor->bufferBytes[idx * accessor->stride],
-														   accessor->accessor.normalized);
+		return accessor->convertElement(&accessor->bufferBytes[idx * accessor->stride]);
 	}
 };
 
@@ -564,6 +759,11 @@ class IterableAccessor {
 	std::size_t stride;
 	fastgltf::ComponentType componentType;
 
+	// The conversion functions are resolved once here, so that dereferencing doesn't need to
+	// switch on the component types for every element.
+	internal::ElementConversionFunction<ElementType>* convertElement;
+	internal::ElementConversionFunction<std::uint32_t>* convertIndex = nullptr;
+
 	// Data needed for sparse accessors
 	fastgltf::ComponentType indexComponentType;
 	span<const std::byte> indicesBytes;
@@ -578,6 +778,7 @@ public:
 	explicit IterableAccessor(const Asset& asset, const Accessor& accessor, const BufferDataAdapter& adapter) : asset(asset), accessor(accessor) {
 		assert(accessor.type == ElementTraits<ElementType>::type && "The destination type needs to have the same AccessorType as the accessor.");
 		componentType = accessor.componentType;
+		convertElement = internal::getElementConversionFunction<ElementType>(accessor.componentType, accessor.normalized);
 
 		const auto& view = asset.bufferViews[*accessor.bufferViewIndex];
 		stride = view.byteStride ? *view.byteStride : getElementByteSize(accessor.type, accessor.componentType);
@@ -596,6 +797,7 @@ public:
 			valueStride = getElementByteSize(accessor.type, accessor.componentType);
 
 			indexComponentType = accessor.sparse->indexComponentType;
+			convertIndex = internal::getElementConversionFunction<std::uint32_t>(indexComponentType, false);
 			sparseCount = accessor.sparse->count;
 		}
 	}
@@ -672,6 +874,81 @@ IterableAccessor<ElementType, BufferDataAdapter> iterateAccessor(const Asset& as
 	return IterableAccessor<ElementType, BufferDataAdapter>(asset, accessor, adapter);
 }
 
+namespace internal {
+
+/**
+ * Invokes func with every element in [first, last) of the accessor and its index, applying the
+ * sparse values which fall into that range.
+ */
+template <typename ElementType, typename BufferDataAdapter, typename Functor>
+void iterateAccessorRange(const Asset& asset, const Accessor& accessor, const BufferDataAdapter& adapter,
+		std::size_t first, std::size_t last, Functor&& func) {
+	span<const std::byte> srcBytes;
+	std::size_t srcStride = 0;
+
+	// 5.1.1. accessor.bufferView
+	// The index of the buffer view. When undefined, the accessor MUST be initialized with zeros; sparse
+	// property or extensions MAY override zeros with actual values.
+	if (accessor.bufferViewIndex) {
+		auto& view = asset.bufferViews[*accessor.bufferViewIndex];
+		srcBytes = adapter(asset, *accessor.bufferViewIndex).subspan(accessor.byteOffset);
+		srcStride = view.byteStride.value_or(getElementByteSize(accessor.type, accessor.componentType));
+	}
+
+	// The component type and normalization are resolved once, which gives us a loop specialized
+	// for the exact source type that the compiler is able to optimize.
+	const auto resolved = visitComponentSource(accessor.componentType, accessor.normalized, [&](auto source) {
+		using Source = decltype(source);
+		auto convert = [](const std::byte* bytes) {
+			return convertElement<ElementType, typename Source::type, Source::normalized>(bytes);
+		};
+
+		auto iterateDense = [&](std::size_t denseFirst, std::size_t denseLast) {
+			if (!accessor.bufferViewIndex) {
+				for (std::size_t i = denseFirst; i < denseLast; ++i) {
+					std::invoke(func, defaultElement<ElementType>(nullptr), i);
+				}
+				return;
+			}
+
+			const auto* bytes = srcBytes.data();
+			for (std::size_t i = denseFirst; i < denseLast; ++i) {
+				std::invoke(func, convert(bytes + i * srcStride), i);
+			}
+		};
+
+		if (!accessor.sparse || accessor.sparse->count == 0) {
+			iterateDense(first, last);
+			return;
+		}
+
+		// The dense elements between two sparse indices are iterated as one run, so that we don't need
+		// to compare each element index against the next sparse index.
+		std::size_t next = first;
+		iterateSparseChunks(asset, accessor, adapter, first, last, [&](const std::uint32_t* indices,
+				const std::byte* values, std::size_t valueStride, std::size_t count) {
+			for (std::size_t i = 0; i < count; ++i) {
+				// Sparse indices MUST strictly increase, so any other index is ignored.
+				if (indices[i] < next)
+					continue;
+
+				iterateDense(next, indices[i]);
+				std::invoke(func, convert(values + i * valueStride), static_cast<std::size_t>(indices[i]));
+				next = indices[i] + 1;
+			}
+		});
+		iterateDense(next, last);
+	});
+
+	if (!resolved) {
+		for (std::size_t i = first; i < last; ++i) {
+			std::invoke(func, defaultElement<ElementType>(nullptr), i);
+		}
+	}
+}
+
+} // namespace internal
+
 FASTGLTF_EXPORT template <typename ElementType, typename Functor, typename BufferDataAdapter = DefaultBufferDataAdapter>
 #if FASTGLTF_HAS_CONCEPTS
 requires Element<ElementType> && std::is_invocable_v<Functor, ElementType>
@@ -687,92 +964,253 @@ void iterateAccessor(const Asset& asset, const Accessor& accessor, Functor&& fun
 
 	assert(accessor.type == Traits::type && "The destination type needs to have the same AccessorType as the accessor.");
 
-	if (accessor.sparse && accessor.sparse->count > 0) {
-		auto indicesBytes = adapter(asset, accessor.sparse->indicesBufferView).subspan(accessor.sparse->indicesByteOffset);
-		auto indexStride = getElementByteSize(AccessorType::Scalar, accessor.sparse->indexComponentType);
+	internal::iterateAccessorRange<ElementType>(asset, accessor, adapter, 0, accessor.count, [&](auto&& element, std::size_t) {
+		std::invoke(func, std::forward<ElementType>(element));
+	});
+}
 
-		auto valuesBytes = adapter(asset, accessor.sparse->valuesBufferView).subspan(accessor.sparse->valuesByteOffset);
-		// "The index of the bufferView with sparse values. The referenced buffer view MUST NOT
-		// have its target or byteStride properties defined."
-		auto valueStride = getElementByteSize(accessor.type, accessor.componentType);
+FASTGLTF_EXPORT template <typename ElementType, typename Functor, typename BufferDataAdapter = DefaultBufferDataAdapter>
+#if FASTGLTF_HAS_CONCEPTS
+requires Element<ElementType> && std::is_invocable_v<Functor, ElementType, std::size_t>
+#endif
+void iterateAccessorWithIndex(const Asset& asset, const Accessor& accessor, Functor&& func,
+                     const BufferDataAdapter& adapter = {}) {
+	assert(accessor.type == ElementTraits<ElementType>::type && "The destination type needs to have the same AccessorType as the accessor.");
 
-		span<const std::byte> srcBytes;
-		std::size_t srcStride = 0;
+	internal::iterateAccessorRange<ElementType>(asset, accessor, adapter, 0, accessor.count, [&](auto&& element, std::size_t index) {
+		std::invoke(func, std::forward<ElementType>(element), index);
+	});
+}
 
-		// 5.1.1. accessor.bufferView
-		// The index of the buffer view. When undefined, the accessor MUST be initialized with zeros; sparse
-		// property or extensions MAY override zeros with actual values.
-		if (accessor.bufferViewIndex) {
-			auto& view = asset.bufferViews[*accessor.bufferViewIndex];
-			srcBytes = adapter(asset, *accessor.bufferViewIndex).subspan(accessor.byteOffset);
-            srcStride = view.byteStride.value_or(getElementByteSize(accessor.type, accessor.componentType));
-        }
+namespace internal {
 
-		auto nextSparseIndex = internal::getAccessorElementAt<std::uint32_t>(
-				accessor.sparse->indexComponentType, indicesBytes.data());
-		std::size_t sparseIndexCount = 0;
+/**
+ * Copies count elements from srcBytes into dstBytes, converting them if the component type
+ * or normalization differ from the element type.
+ */
+template <typename ElementType, std::size_t TargetStride>
+void copyElements(const Accessor& accessor, const std::byte* srcBytes, std::size_t srcStride, std::size_t count, std::byte* dstBytes) {
+	using Traits = ElementTraits<ElementType>;
+	auto elemSize = getElementByteSize(accessor.type, accessor.componentType);
+
+    // If the data is normalized or the component/accessor type is different, we have to convert each element and can't memcpy.
+	if (std::is_trivially_copyable_v<ElementType> && !accessor.normalized && accessor.componentType == Traits::enum_component_type && !isMatrix(accessor.type)) {
+		if (srcStride == elemSize && srcStride == TargetStride) {
+			std::memcpy(dstBytes, srcBytes, elemSize * count);
+		} else {
+			for (std::size_t i = 0; i < count; ++i) {
+				std::memcpy(dstBytes + TargetStride * i, srcBytes + srcStride * i, elemSize);
+			}
+		}
+		return;
+	}
 
-		for (std::size_t i = 0; i < accessor.count; ++i) {
-			if (i == nextSparseIndex) {
-				auto element = internal::getAccessorElementAt<ElementType>(accessor.componentType,
-						&valuesBytes[valueStride * sparseIndexCount],
-						accessor.normalized);
+	// Element types which are just an array of components can use the vectorized conversion kernels.
+	if constexpr (std::is_trivially_copyable_v<ElementType>
+			&& sizeof(ElementType) == getNumComponents(Traits::type) * sizeof(typename Traits::component_type)) {
+		auto* convert = getComponentConversionFunction(accessor.componentType, Traits::enum_component_type, accessor.normalized);
+		if (convert != nullptr && !isMatrix(accessor.type)) {
+			convertElements(convert, getNumComponents(accessor.type), count,
+				srcBytes, srcStride, elemSize, dstBytes, TargetStride, sizeof(ElementType));
+			return;
+		}
+	}
 
-				std::invoke(func, element);
+	const auto resolved = visitComponentSource(accessor.componentType, accessor.normalized, [&](auto source) {
+		using Source = decltype(source);
+		for (std::size_t i = 0; i < count; ++i) {
+			auto* pDest = reinterpret_cast<ElementType*>(dstBytes + TargetStride * i);
+			*pDest = convertElement<ElementType, typename Source::type, Source::normalized>(srcBytes + srcStride * i);
+		}
+	});
 
-				++sparseIndexCount;
+	if (!resolved) {
+		for (std::size_t i = 0; i < count; ++i) {
+			*reinterpret_cast<ElementType*>(dstBytes + TargetStride * i) = defaultElement<ElementType>(nullptr);
+		}
+	}
+}
 
-				if (sparseIndexCount < accessor.sparse->count) {
-					nextSparseIndex = internal::getAccessorElementAt<std::uint32_t>(
-							accessor.sparse->indexComponentType, &indicesBytes[indexStride * sparseIndexCount]);
-				}
-			} else if (accessor.bufferViewIndex) {
-				auto element = internal::getAccessorElementAt<ElementType>(accessor.componentType,
-						&srcBytes[srcStride * i],
-						accessor.normalized);
+/**
+ * Copies the components of count elements from srcBytes into dstBytes, converting them if necessary.
+ * Each element is written as a tightly packed list of components, dstStride bytes apart.
+ */
+template <typename DestComponent>
+void copyComponents(const Accessor& accessor, const std::byte* srcBytes, std::size_t srcStride, std::size_t count,
+		std::byte* dstBytes, std::size_t dstStride) {
+	constexpr auto DestType = ComponentTypeConverter<DestComponent>::type;
 
-				std::invoke(func, element);
-			} else {
-				std::invoke(func, ElementType {});
+	auto elemSize = getElementByteSize(accessor.type, accessor.componentType);
+	auto componentCount = getNumComponents(accessor.type);
+
+	if (accessor.componentType == DestType && !accessor.normalized && !isMatrix(accessor.type)) {
+		if (srcStride == elemSize && dstStride == elemSize) {
+			std::memcpy(dstBytes, srcBytes, elemSize * count);
+		} else {
+			for (std::size_t i = 0; i < count; ++i) {
+				std::memcpy(dstBytes + dstStride * i, srcBytes + srcStride * i, elemSize);
 			}
 		}
+		return;
+	}
 
+	auto* convert = getComponentConversionFunction(accessor.componentType, DestType, accessor.normalized);
+	if (convert != nullptr && !isMatrix(accessor.type)) {
+		convertElements(convert, componentCount, count, srcBytes, srcStride, elemSize,
+			dstBytes, dstStride, componentCount * sizeof(DestComponent));
 		return;
 	}
 
+	for (std::size_t i = 0; i < count; ++i) {
+		for (std::size_t j = 0; j < componentCount; ++j) {
+			auto component = getAccessorComponentAt<DestComponent>(
+				accessor.componentType, accessor.type, srcBytes + i * srcStride, j, accessor.normalized);
+			std::memcpy(dstBytes + dstStride * i + sizeof(DestComponent) * j, &component, sizeof(DestComponent));
+		}
+	}
+}
+
+/** Copies the elements in [first, last) of the accessor into dstBytes, including the sparse values inside that range. */
+template <typename ElementType, std::size_t TargetStride, typename BufferDataAdapter>
+void copyFromAccessorRange(const Asset& asset, const Accessor& accessor, std::byte* dstBytes,
+		const BufferDataAdapter& adapter, std::size_t first, std::size_t last) {
+	auto* rangeBytes = dstBytes + TargetStride * first;
+	const auto count = last - first;
+
 	// 5.1.1. accessor.bufferView
 	// The index of the buffer view. When undefined, the accessor MUST be initialized with zeros; sparse
 	// property or extensions MAY override zeros with actual values.
 	if (!accessor.bufferViewIndex) {
-		for (std::size_t i = 0; i < accessor.count; ++i) {
-			std::invoke(func, ElementType {});
+		if constexpr (std::is_trivially_copyable_v<ElementType>) {
+			if (TargetStride == sizeof(ElementType)) {
+				std::memset(rangeBytes, 0, sizeof(ElementType) * count);
+			} else {
+				for (std::size_t i = 0; i < count; ++i) {
+					std::memset(rangeBytes + i * TargetStride, 0, sizeof(ElementType));
+				}
+			}
+		} else {
+			for (std::size_t i = 0; i < count; ++i) {
+				*reinterpret_cast<ElementType*>(rangeBytes + TargetStride * i) = defaultElement<ElementType>(nullptr);
+			}
 		}
 	} else {
+		auto elemSize = getElementByteSize(accessor.type, accessor.componentType);
 		auto& view = asset.bufferViews[*accessor.bufferViewIndex];
-        auto stride = view.byteStride.value_or(getElementByteSize(accessor.type, accessor.componentType));
+		auto srcStride = view.byteStride.value_or(elemSize);
 
-		auto bytes = adapter(asset, *accessor.bufferViewIndex).subspan(accessor.byteOffset);
+		auto srcBytes = adapter(asset, *accessor.bufferViewIndex).subspan(accessor.byteOffset);
+		copyElements<ElementType, TargetStride>(accessor, srcBytes.data() + srcStride * first, srcStride, count, rangeBytes);
+	}
 
-		for (std::size_t i = 0; i < accessor.count; ++i) {
-			auto element = internal::getAccessorElementAt<ElementType>(
-				accessor.componentType, &bytes[i * stride], accessor.normalized);
-			std::invoke(func, element);
-		}
+	// The sparse values are converted a chunk at a time and then scattered over the dense data.
+	if (accessor.sparse && accessor.sparse->count > 0) {
+		iterateSparseChunks(asset, accessor, adapter, first, last, [&](const std::uint32_t* indices,
+				const std::byte* values, std::size_t valueStride, std::size_t sparseCount) {
+			std::array<ElementType, sparseChunkSize> elements;
+			copyElements<ElementType, sizeof(ElementType)>(accessor, values, valueStride, sparseCount,
+				reinterpret_cast<std::byte*>(elements.data()));
+
+			for (std::size_t i = 0; i < sparseCount; ++i) {
+				if (indices[i] < first)
+					continue;
+				auto* pDest = reinterpret_cast<ElementType*>(dstBytes + TargetStride * indices[i]);
+				*pDest = std::move(elements[i]);
+			}
+		});
 	}
 }
 
-FASTGLTF_EXPORT template <typename ElementType, typename Functor, typename BufferDataAdapter = DefaultBufferDataAdapter>
-#if FASTGLTF_HAS_CONCEPTS
-requires Element<ElementType> && std::is_invocable_v<Functor, ElementType, std::size_t>
-#endif
-void iterateAccessorWithIndex(const Asset& asset, const Accessor& accessor, Functor&& func,
-                     const BufferDataAdapter& adapter = {}) {
-	std::size_t idx = 0;
-	iterateAccessor<ElementType>(asset, accessor, [&](auto&& elementType) {
-		std::invoke(func, std::forward<ElementType>(elementType), idx++);
-	}, adapter);
+/** Copies the components of the elements in [first, last) of the accessor into dstBytes, including the sparse values inside that range. */
+template <typename DestComponent, typename BufferDataAdapter>
+void copyComponentsFromAccessorRange(const Asset& asset, const Accessor& accessor, std::byte* dstBytes,
+		const BufferDataAdapter& adapter, std::size_t first, std::size_t last) {
+	auto componentCount = getNumComponents(accessor.type);
+	auto dstElementSize = componentCount * sizeof(DestComponent);
+	const auto count = last - first;
+
+	// 5.1.1. accessor.bufferView
+	// The index of the buffer view. When undefined, the accessor MUST be initialized with zeros; sparse
+	// property or extensions MAY override zeros with actual values.
+	if (!accessor.bufferViewIndex) {
+		std::memset(dstBytes + dstElementSize * first, 0, dstElementSize * count);
+	} else {
+		auto elemSize = getElementByteSize(accessor.type, accessor.componentType);
+		auto& view = asset.bufferViews[*accessor.bufferViewIndex];
+		auto srcStride = view.byteStride.value_or(elemSize);
+
+		auto srcBytes = adapter(asset, *accessor.bufferViewIndex).subspan(accessor.byteOffset);
+		copyComponents<DestComponent>(accessor, srcBytes.data() + srcStride * first, srcStride, count,
+			dstBytes + dstElementSize * first, dstElementSize);
+	}
+
+	if (accessor.sparse && accessor.sparse->count > 0) {
+		iterateSparseChunks(asset, accessor, adapter, first, last, [&](const std::uint32_t* indices,
+				const std::byte* values, std::size_t valueStride, std::size_t sparseCount) {
+			// Matrices have up to 16 components per element.
+			std::array<DestComponent, sparseChunkSize * 16> components;
+			copyComponents<DestComponent>(accessor, values, valueStride, sparseCount,
+				reinterpret_cast<std::byte*>(components.data()), dstElementSize);
+
+			for (std::size_t i = 0; i < sparseCount; ++i) {
+				if (indices[i] < first)
+					continue;
+				std::memcpy(dstBytes + dstElementSize * indices[i], &components[i * componentCount], dstElementSize);
+			}
+		});
+	}
+}
+
+// The parallel overloads process chunks touching roughly this many bytes of destination memory, so
+// that each one fits into a core's cache while still having enough of them to occupy every thread.
+constexpr std::size_t parallelChunkBytes = 256 * 1024;
+
+constexpr std::size_t getParallelChunkSize(std::size_t elementSize) {
+	return max<std::size_t>(parallelChunkBytes / max<std::size_t>(elementSize, 1), 1);
+}
+
+// Spawning threads costs more than processing a few chunks, so with the default executor fewer
+// chunks than this are processed on the calling thread.
+constexpr std::size_t parallelChunkThreshold = 4;
+
+/**
+ * Splits [0, count) into ranges of chunkSize elements and invokes func(first, last) for each of
+ * them through the executor.
+ */
+template <typename Functor>
+void executeChunks(TaskExecutorCallback* executor, void* userPointer, std::size_t count, std::size_t chunkSize, Functor& func) {
+	struct ChunkData {
+		Functor* func;
+		std::size_t count;
+		std::size_t chunkSize;
+	} data { &func, count, chunkSize };
+
+	const auto chunkCount = (count + chunkSize - 1) / chunkSize;
+	if (executor == nullptr && chunkCount < parallelChunkThreshold) {
+		if (chunkCount != 0)
+			func(0, count);
+		return;
+	}
+
+	executeTasks(chunkCount, [](std::size_t taskIndex, void* taskData) {
+		auto& chunk = *static_cast<ChunkData*>(taskData);
+		const auto first = taskIndex * chunk.chunkSize;
+		(*chunk.func)(first, min(first + chunk.chunkSize, chunk.count));
+	}, &data, executor, userPointer);
 }
 
+} // namespace internal
+
+/**
+ * An executor for the parallel overloads of the accessor tools, passed as the first argument just
+ * like a standard execution policy. With no callback, threads are spawned for each call using executeTasks,
+ * and accessors spanning only a few chunks are processed on the calling thread.
+ */
+FASTGLTF_EXPORT struct TaskExecutor {
+	TaskExecutorCallback* callback = nullptr;
+	void* userPointer = nullptr;
+};
+
 FASTGLTF_EXPORT template <typename ElementType, std::size_t TargetStride = sizeof(ElementType),
     typename BufferDataAdapter = DefaultBufferDataAdapter>
 #if FASTGLTF_HAS_CONCEPTS
@@ -789,65 +1227,35 @@ void copyFromAccessor(const Asset& asset, const Accessor& accessor, void* dest,
 
 	assert(accessor.type == Traits::type && "The destination type needs to have the same AccessorType as the accessor.");
 
-	auto* dstBytes = static_cast<std::byte*>(dest);
-
-	if (accessor.sparse && accessor.sparse->count > 0) {
-		return iterateAccessorWithIndex<ElementType>(asset, accessor, [&](auto&& value, std::size_t index) {
-			auto* pDest = reinterpret_cast<ElementType*>(dstBytes + TargetStride * index);
-			*pDest = std::forward<ElementType>(value);
-		}, adapter);
-	}
-
-	auto elemSize = getElementByteSize(accessor.type, accessor.componentType);
-
-	// 5.1.1. accessor.bufferView
-	// The index of the buffer view. When undefined, the accessor MUST be initialized with zeros; sparse
-	// property or extensions MAY override zeros with actual values.
-	if (!accessor.bufferViewIndex) {
-		if constexpr (std::is_trivially_copyable_v<ElementType>) {
-			if (TargetStride == elemSize) {
-				std::memset(dest, 0, elemSize * accessor.count);
-			} else {
-				for (std::size_t i = 0; i < accessor.count; ++i) {
-					std::memset(dstBytes + i * TargetStride, 0, elemSize);
-				}
-			}
-		} else {
-			for (std::size_t i = 0; i < accessor.count; ++i) {
-				auto* pDest = reinterpret_cast<ElementType*>(dstBytes + TargetStride * i);
-
-				if constexpr (std::is_aggregate_v<ElementType>) {
-					*pDest = ElementType {};
-				} else {
-					*pDest = ElementType();
-				}
-			}
-		}
-
-		return;
-	}
+	internal::copyFromAccessorRange<ElementType, TargetStride>(asset, accessor, static_cast<std::byte*>(dest), adapter, 0, accessor.count);
+}
 
-	auto& view = asset.bufferViews[*accessor.bufferViewIndex];
-	auto srcStride = view.byteStride.value_or(elemSize);
+/**
+ * Parallel version of copyFromAccessor, which splits the accessor into cache-sized chunks that are
+ * copied concurrently through the given executor. Returns once all elements have been copied.
+ */
+FASTGLTF_EXPORT template <typename ElementType, std::size_t TargetStride = sizeof(ElementType),
+    typename BufferDataAdapter = DefaultBufferDataAdapter>
+#if FASTGLTF_HAS_CONCEPTS
+requires Element<ElementType>
+#endif
+void copyFromAccessor(const TaskExecutor& executor, const Asset& asset, const Accessor& accessor, void* dest,
+		const BufferDataAdapter& adapter = {}) {
+	using Traits = ElementTraits<ElementType>;
+	static_assert(Traits::type != AccessorType::Invalid, "Accessor traits must provide a valid accessor type");
+	static_assert(Traits::enum_component_type != ComponentType::Invalid, "Accessor traits must provide a valid component type");
+	static_assert(std::is_default_constructible_v<ElementType>, "Element type must be default constructible");
+	static_assert(std::is_constructible_v<ElementType>, "Element type must be constructible");
+	static_assert(std::is_move_assignable_v<ElementType>, "Element type must be move-assignable");
 
-	auto srcBytes = adapter(asset, *accessor.bufferViewIndex).subspan(accessor.byteOffset);
+	assert(accessor.type == Traits::type && "The destination type needs to have the same AccessorType as the accessor.");
 
-    // If the data is normalized or the component/accessor type is different, we have to convert each element and can't memcpy.
-	if (std::is_trivially_copyable_v<ElementType> && !accessor.normalized && accessor.componentType == Traits::enum_component_type && !isMatrix(accessor.type)) {
-		if (srcStride == elemSize && srcStride == TargetStride) {
-			std::memcpy(dest, srcBytes.data(), elemSize * accessor.count);
-		} else {
-			for (std::size_t i = 0; i < accessor.count; ++i) {
-				std::memcpy(dstBytes + TargetStride * i, &srcBytes[srcStride * i], elemSize);
-			}
-		}
-	} else {
-		for (std::size_t i = 0; i < accessor.count; ++i) {
-			auto* pDest = reinterpret_cast<ElementType*>(dstBytes + TargetStride * i);
-			*pDest = internal::getAccessorElementAt<ElementType>(
-                    accessor.componentType, &srcBytes[srcStride * i]);
-		}
-	}
+	auto* dstBytes = static_cast<std::byte*>(dest);
+	auto copyRange = [&](std::size_t first, std::size_t last) {
+		internal::copyFromAccessorRange<ElementType, TargetStride>(asset, accessor, dstBytes, adapter, first, last);
+	};
+	internal::executeChunks(executor.callback, executor.userPointer, accessor.count,
+		internal::getParallelChunkSize(TargetStride), copyRange);
 }
 
 /**
@@ -858,37 +1266,186 @@ void copyFromAccessor(const Asset& asset, const Accessor& accessor, void* dest,
  */
 FASTGLTF_EXPORT template <typename ComponentType, typename BufferDataAdapter = DefaultBufferDataAdapter>
 void copyComponentsFromAccessor(const Asset& asset, const Accessor& accessor, void* dest, const BufferDataAdapter& adapter = {}) {
-	constexpr auto DestType = ComponentTypeConverter<ComponentType>::type;
-
-	assert((!bool(accessor.sparse) || accessor.sparse->count == 0) && "copyComponentsFromAccessor currently does not support sparse accessors.");
+	internal::copyComponentsFromAccessorRange<ComponentType>(asset, accessor, static_cast<std::byte*>(dest), adapter, 0, accessor.count);
+}
 
+/**
+ * Parallel version of copyComponentsFromAccessor, which splits the accessor into cache-sized chunks
+ * that are copied concurrently through the given executor.
+ */
+FASTGLTF_EXPORT template <typename ComponentType, typename BufferDataAdapter = DefaultBufferDataAdapter>
+void copyComponentsFromAccessor(const TaskExecutor& executor, const Asset& asset, const Accessor& accessor, void* dest,
+		const BufferDataAdapter& adapter = {}) {
 	auto* dstBytes = static_cast<std::byte*>(dest);
+	auto copyRange = [&](std::size_t first, std::size_t last) {
+		internal::copyComponentsFromAccessorRange<ComponentType>(asset, accessor, dstBytes, adapter, first, last);
+	};
+	internal::executeChunks(executor.callback, executor.userPointer, accessor.count,
+		internal::getParallelChunkSize(getNumComponents(accessor.type) * sizeof(ComponentType)), copyRange);
+}
 
-	auto elemSize = getElementByteSize(accessor.type, accessor.componentType);
-	auto componentCount = getNumComponents(accessor.type);
+/**
+ * Parallel version of iterateAccessorWithIndex. The functor is invoked concurrently from multiple
+ * threads and elements are not visited in order, so it needs to be safe to call like that.
+ */
+FASTGLTF_EXPORT template <typename ElementType, typename Functor, typename BufferDataAdapter = DefaultBufferDataAdapter>
+#if FASTGLTF_HAS_CONCEPTS
+requires Element<ElementType> && std::is_invocable_v<Functor, ElementType, std::size_t>
+#endif
+void iterateAccessorWithIndex(const TaskExecutor& executor, const Asset& asset, const Accessor& accessor, Functor&& func,
+		const BufferDataAdapter& adapter = {}) {
+	assert(accessor.type == ElementTraits<ElementType>::type && "The destination type needs to have the same AccessorType as the accessor.");
 
-	auto& view = asset.bufferViews[*accessor.bufferViewIndex];
-	auto srcStride = view.byteStride.value_or(elemSize);
+	auto iterateRange = [&](std::size_t first, std::size_t last) {
+		internal::iterateAccessorRange<ElementType>(asset, accessor, adapter, first, last, [&](auto&& element, std::size_t index) {
+			std::invoke(func, std::forward<ElementType>(element), index);
+		});
+	};
+	internal::executeChunks(executor.callback, executor.userPointer, accessor.count,
+		internal::getParallelChunkSize(sizeof(ElementType)), iterateRange);
+}
 
-	auto srcBytes = adapter(asset, *accessor.bufferViewIndex).subspan(accessor.byteOffset);
+/**
+ * Describes where and in which format an attribute of a primitive is written to within an interleaved vertex,
+ * for use with writeInterleavedVertices.
+ */
+FASTGLTF_EXPORT struct InterleavedAttribute {
+	/** The name of the primitive's attribute, for example "POSITION". */
+	std::string_view name;
+	/** The offset of the attribute from the start of each vertex, in bytes. */
+	std::size_t offset;
+	AccessorType type;
+	ComponentType componentType;
+};
 
-	if (accessor.componentType == DestType && !accessor.normalized && !isMatrix(accessor.type)) {
-		if (srcStride == elemSize) {
-			std::memcpy(dest, srcBytes.data(), elemSize * accessor.count);
-		} else {
-			for (std::size_t i = 0; i < accessor.count; ++i) {
-				std::memcpy(dstBytes + elemSize * i, &srcBytes[srcStride * i], elemSize);
-			}
+/** Creates an InterleavedAttribute with the format of ElementType, as described by its ElementTraits. */
+FASTGLTF_EXPORT template <typename ElementType>
+constexpr InterleavedAttribute makeInterleavedAttribute(std::string_view name, std::size_t offset) {
+	using Traits = ElementTraits<ElementType>;
+	return InterleavedAttribute { name, offset, Traits::type, Traits::enum_component_type };
+}
+
+/**
+ * Can be specialized to describe the layout of a vertex struct at compile time, which allows using
+ * writeInterleavedVertices without passing the layout. The specialization needs to provide a static
+ * constexpr container of InterleavedAttribute called attributes, for example a std::array.
+ */
+FASTGLTF_EXPORT template <typename Vertex>
+struct InterleavedVertexTraits;
+
+namespace internal {
+
+/** The number of vertices of which all attributes are written before moving on to the next vertices. */
+static constexpr std::size_t interleavedChunkSize = 256;
+
+/** Writes the vertices in [first, last) of a single attribute into the interleaved vertex buffer. */
+template <typename DestComponent, typename BufferDataAdapter>
+void writeInterleavedAttribute(const Asset& asset, const Accessor* accessor, const InterleavedAttribute& attribute,
+		std::byte* dstBytes, std::size_t vertexStride, const BufferDataAdapter& adapter, std::size_t first, std::size_t last) {
+	auto dstElementSize = getNumComponents(attribute.type) * sizeof(DestComponent);
+	auto* attributeBytes = dstBytes + attribute.offset;
+
+	// 5.1.1. accessor.bufferView
+	// The index of the buffer view. When undefined, the accessor MUST be initialized with zeros; sparse
+	// property or extensions MAY override zeros with actual values.
+	if (accessor == nullptr || !accessor->bufferViewIndex) {
+		for (auto i = first; i < last; ++i) {
+			std::memset(attributeBytes + vertexStride * i, 0, dstElementSize);
 		}
 	} else {
-		for (std::size_t i = 0; i < accessor.count; ++i) {
-			for (std::size_t j = 0; j < componentCount; ++j) {
-				auto* pDest = reinterpret_cast<ComponentType*>(dstBytes + elemSize * i) + j;
-				*pDest = internal::getAccessorComponentAt<ComponentType>(
-					accessor.componentType, accessor.type, &srcBytes[i * srcStride], j, accessor.normalized);
+		auto elemSize = getElementByteSize(accessor->type, accessor->componentType);
+		auto& view = asset.bufferViews[*accessor->bufferViewIndex];
+		auto srcStride = view.byteStride.value_or(elemSize);
+
+		auto srcBytes = adapter(asset, *accessor->bufferViewIndex).subspan(accessor->byteOffset);
+		copyComponents<DestComponent>(*accessor, srcBytes.data() + srcStride * first, srcStride, last - first,
+			attributeBytes + vertexStride * first, vertexStride);
+	}
+
+	if (accessor != nullptr && accessor->sparse && accessor->sparse->count > 0) {
+		iterateSparseChunks(asset, *accessor, adapter, first, last, [&](const std::uint32_t* indices,
+				const std::byte* values, std::size_t valueStride, std::size_t sparseCount) {
+			// Matrices have up to 16 components per element.
+			std::array<DestComponent, sparseChunkSize * 16> components;
+			copyComponents<DestComponent>(*accessor, values, valueStride, sparseCount,
+				reinterpret_cast<std::byte*>(components.data()), dstElementSize);
+
+			for (std::size_t i = 0; i < sparseCount; ++i) {
+				if (indices[i] < first)
+					continue;
+				std::memcpy(attributeBytes + vertexStride * indices[i], &components[i * getNumComponents(attribute.type)], dstElementSize);
+			}
+		});
+	}
+}
+
+} // namespace internal
+
+/**
+ * Writes the attributes of a primitive into an interleaved vertex buffer in a single pass. The vertices are
+ * processed in small chunks, and all attributes of a chunk are written before moving on to the next one, so that
+ * the destination memory is only touched while it is in the cache. The attributes are converted into the format
+ * given by the layout, with the same conversions as copyComponentsFromAccessor. Attributes which the primitive
+ * does not have, or which do not have the same number of components as the layout, are filled with zeros.
+ * Bytes not covered by the layout are never written or read, which makes this suitable for writing directly
+ * into mapped GPU memory, for example memory from a BufferMapCallback.
+ *
+ * @return The number of vertices written, which is the count of the POSITION accessor, or of the first
+ * attribute if the primitive has no positions. dest needs to hold that many vertices of vertexStride bytes.
+ */
+FASTGLTF_EXPORT template <typename BufferDataAdapter = DefaultBufferDataAdapter>
+std::size_t writeInterleavedVertices(const Asset& asset, const Primitive& primitive, span<const InterleavedAttribute> layout,
+		std::size_t vertexStride, void* dest, const BufferDataAdapter& adapter = {}) {
+	const auto* positionAttribute = primitive.findAttribute("POSITION");
+	if (positionAttribute == primitive.attributes.end())
+		positionAttribute = primitive.attributes.begin();
+	if (positionAttribute == primitive.attributes.end())
+		return 0;
+	const auto vertexCount = asset.accessors[positionAttribute->accessorIndex].count;
+
+	std::vector<const Accessor*> accessors(layout.size());
+	for (std::size_t i = 0; i < layout.size(); ++i) {
+		const auto* attribute = primitive.findAttribute(layout[i].name);
+		if (attribute == primitive.attributes.end())
+			continue;
+
+		const auto& accessor = asset.accessors[attribute->accessorIndex];
+		if (accessor.count == vertexCount && getNumComponents(accessor.type) == getNumComponents(layout[i].type))
+			accessors[i] = &accessor;
+	}
+
+	auto* dstBytes = static_cast<std::byte*>(dest);
+	for (std::size_t first = 0; first < vertexCount; first += internal::interleavedChunkSize) {
+		const auto last = (std::min)(first + internal::interleavedChunkSize, vertexCount);
+		for (std::size_t i = 0; i < layout.size(); ++i) {
+			auto write = [&](auto component) {
+				internal::writeInterleavedAttribute<decltype(component)>(asset, accessors[i], layout[i], dstBytes, vertexStride, adapter, first, last);
+			};
+			switch (layout[i].componentType) {
+				case ComponentType::Byte: write(std::int8_t()); break;
+				case ComponentType::UnsignedByte: write(std::uint8_t()); break;
+				case ComponentType::Short: write(std::int16_t()); break;
+				case ComponentType::UnsignedShort: write(std::uint16_t()); break;
+				case ComponentType::Int: write(std::int32_t()); break;
+				case ComponentType::UnsignedInt: write(std::uint32_t()); break;
+				case ComponentType::Float: write(float()); break;
+				case ComponentType::Double: write(double()); break;
+				default: break;
 			}
 		}
 	}
+	return vertexCount;
+}
+
+/**
+ * Writes the attributes of a primitive into an array of interleaved vertices, using the layout described
+ * by the InterleavedVertexTraits specialization for Vertex.
+ */
+FASTGLTF_EXPORT template <typename Vertex, typename BufferDataAdapter = DefaultBufferDataAdapter>
+std::size_t writeInterleavedVertices(const Asset& asset, const Primitive& primitive, Vertex* dest, const BufferDataAdapter& adapter = {}) {
+	const auto& layout = InterleavedVertexTraits<Vertex>::attributes;
+	return writeInterleavedVertices(asset, primitive, span<const InterleavedAttribute>(std::data(layout), std::size(layout)),
+		sizeof(Vertex), dest, adapter);
 }
 
 /**
@@ -934,4 +1491,326 @@ void iterateSceneNodes(AssetType&& asset, std::size_t sceneIndex, math::fmat4x4
 	}
 }
 
+/**
+ * A flattened copy of the node hierarchy of a scene, which computes the world transforms of all nodes in a single
+ * linear pass, instead of recursing through Node::children like iterateSceneNodes. The nodes are stored in breadth
+ * first order, so that every parent comes before its children, and the local transforms are stored in separate
+ * arrays of translations, rotations, and scales. Changing a local transform marks the node as dirty, after which
+ * updateWorldMatrices only recomputes the world matrices of the dirty nodes and their descendants.
+ */
+FASTGLTF_EXPORT class FlattenedScene {
+public:
+	static constexpr std::size_t noParent = std::numeric_limits<std::size_t>::max();
+
+	FlattenedScene() = default;
+
+	/**
+	 * Flattens the given scene and computes the world matrices of all its nodes, relative to the base matrix.
+	 * Nodes which are reachable more than once, which is invalid glTF, are only added the first time.
+	 */
+	explicit FlattenedScene(const Asset& asset, std::size_t sceneIndex, const math::fmat4x4& base = math::fmat4x4());
+
+	[[nodiscard]] std::size_t size() const noexcept {
+		return nodeIndices.size();
+	}
+
+	/** Returns the index into Asset::nodes of every flattened node. */
+	[[nodiscard]] span<const std::size_t> getNodeIndices() const noexcept {
+		return span(nodeIndices.data(), nodeIndices.size());
+	}
+
+	/** Returns the flattened index of the parent of every flattened node, or noParent for the root nodes. */
+	[[nodiscard]] span<const std::size_t> getParents() const noexcept {
+		return span(parents.data(), parents.size());
+	}
+
+	/** Returns the flattened index of the node with the given index in Asset::nodes, or noParent if it is not part of the scene. */
+	[[nodiscard]] std::size_t getFlattenedIndex(std::size_t nodeIndex) const noexcept {
+		return nodeIndex < flattenedIndices.size() ? flattenedIndices[nodeIndex] : noParent;
+	}
+
+	[[nodiscard]] span<const math::fvec3> getTranslations() const noexcept {
+		return span(translations.data(), translations.size());
+	}
+	[[nodiscard]] span<const math::fquat> getRotations() const noexcept {
+		return span(rotations.data(), rotations.size());
+	}
+	[[nodiscard]] span<const math::fvec3> getScales() const noexcept {
+		return span(scales.data(), scales.size());
+	}
+
+	/**
+	 * Returns the world matrix of every flattened node. These are only up to date after updateWorldMatrices
+	 * has been called following changes to local transforms.
+	 */
+	[[nodiscard]] span<const math::fmat4x4> getWorldMatrices() const noexcept {
+		return span(worldMatrices.data(), worldMatrices.size());
+	}
+
+	/**
+	 * These set a single component of the local transform of a flattened node. If the node's local transform was
+	 * a matrix, the decomposed translation, rotation, and scale are used from then on.
+	 */
+	void setTranslation(std::size_t index, const math::fvec3& translation) noexcept;
+	void setRotation(std::size_t index, const math::fquat& rotation) noexcept;
+	void setScale(std::size_t index, const math::fvec3& scale) noexcept;
+
+	/** Sets the local transform of a flattened node to a matrix, which is used as-is. */
+	void setLocalMatrix(std::size_t index, const math::fmat4x4& matrix) noexcept;
+
+	/** Sets the matrix which the world matrices of the root nodes are relative to. */
+	void setBaseMatrix(const math::fmat4x4& base) noexcept;
+
+	/** Recomputes the world matrices of all nodes marked dirty, and of all their descendants. */
+	void updateWorldMatrices() noexcept;
+
+private:
+	enum NodeFlags : std::uint8_t {
+		/** The local matrix needs to be recomputed from the translation, rotation, and scale. */
+		LocalDirty = 1 << 0,
+		/** The world matrix needs to be recomputed, which also requires recomputing those of the children. */
+		WorldDirty = 1 << 1,
+		/** The local matrix was specified directly and is not computed from the translation, rotation, and scale. */
+		LocalMatrix = 1 << 2,
+	};
+
+	std::vector<std::size_t> nodeIndices;
+	std::vector<std::size_t> parents;
+	std::vector<std::size_t> flattenedIndices;
+
+	std::vector<math::fvec3> translations;
+	std::vector<math::fquat> rotations;
+	std::vector<math::fvec3> scales;
+	std::vector<std::uint8_t> flags;
+
+	std::vector<math::fmat4x4> localMatrices;
+	std::vector<math::fmat4x4> worldMatrices;
+	math::fmat4x4 baseMatrix;
+
+	/** All nodes before this index are known to not be dirty, as parents always come before their children. */
+	std::size_t firstDirty = 0;
+
+	void markDirty(std::size_t index, std::uint8_t dirtyFlags) noexcept;
+};
+
+/**
+ * The samplers and channels of an animation, with all keyframe times and values decoded into contiguous float arrays.
+ * This holds no playback state, so that a single instance can be shared by any number of AnimationEvaluators.
+ * Samplers which share an input accessor also share the decoded keyframe times.
+ */
+FASTGLTF_EXPORT class DecodedAnimation {
+public:
+	struct Sampler {
+		std::size_t timesOffset;
+		std::size_t valuesOffset;
+		std::size_t keyframeCount;
+		std::size_t inputAccessor;
+		AnimationInterpolation interpolation;
+		/** The number of floats per keyframe value, disregarding the tangents of cubic spline samplers. */
+		std::uint8_t componentCount;
+	};
+
+	struct Channel {
+		std::size_t samplerIndex;
+		std::size_t nodeIndex;
+		AnimationPath path;
+	};
+
+	DecodedAnimation() = default;
+
+	/**
+	 * Decodes the given animation. Channels without a target node, and channels targeting morph target weights,
+	 * are skipped, as there is nothing in a FlattenedScene they could be written to.
+	 */
+	template <typename BufferDataAdapter = DefaultBufferDataAdapter>
+	explicit DecodedAnimation(const Asset& asset, std::size_t animationIndex, const BufferDataAdapter& adapter = {}) {
+		assert(asset.animations.size() > animationIndex);
+		const auto& animation = asset.animations[animationIndex];
+
+		std::vector<std::size_t> samplerMap(animation.samplers.size(), std::numeric_limits<std::size_t>::max());
+		for (const auto& channel : animation.channels) {
+			if (!channel.nodeIndex || channel.path == AnimationPath::Weights)
+				continue;
+			assert(animation.samplers.size() > channel.samplerIndex);
+
+			auto& samplerIndex = samplerMap[channel.samplerIndex];
+			if (samplerIndex == std::numeric_limits<std::size_t>::max()) {
+				samplerIndex = samplers.size();
+				addSampler(asset, animation.samplers[channel.samplerIndex], channel.path, adapter);
+			}
+			channels.emplace_back(Channel { samplerIndex, *channel.nodeIndex, channel.path });
+		}
+	}
+
+	[[nodiscard]] span<const Sampler> getSamplers() const noexcept {
+		return span(samplers.data(), samplers.size());
+	}
+	[[nodiscard]] span<const Channel> getChannels() const noexcept {
+		return span(channels.data(), channels.size());
+	}
+	[[nodiscard]] span<const float> getTimes() const noexcept {
+		return span(times.data(), times.size());
+	}
+	[[nodiscard]] span<const float> getValues() const noexcept {
+		return span(values.data(), values.size());
+	}
+
+	/** Returns the time of the last keyframe of any sampler. */
+	[[nodiscard]] float getDuration() const noexcept {
+		return duration;
+	}
+
+private:
+	std::vector<Sampler> samplers;
+	std::vector<Channel> channels;
+	std::vector<float> times;
+	std::vector<float> values;
+	float duration = 0.0f;
+
+	template <typename BufferDataAdapter>
+	void addSampler(const Asset& asset, const AnimationSampler& sampler, AnimationPath path, const BufferDataAdapter& adapter) {
+		assert(asset.accessors.size() > sampler.inputAccessor && asset.accessors.size() > sampler.outputAccessor);
+		const auto& input = asset.accessors[sampler.inputAccessor];
+		const auto& output = asset.accessors[sampler.outputAccessor];
+
+		Sampler decoded {};
+		decoded.keyframeCount = input.count;
+		decoded.inputAccessor = sampler.inputAccessor;
+		decoded.interpolation = sampler.interpolation;
+		decoded.componentCount = path == AnimationPath::Rotation ? 4 : 3;
+
+		decoded.timesOffset = times.size();
+		for (const auto& other : samplers) {
+			if (other.inputAccessor == sampler.inputAccessor) {
+				decoded.timesOffset = other.timesOffset;
+				break;
+			}
+		}
+		if (decoded.timesOffset == times.size()) {
+			times.resize(times.size() + input.count);
+			copyFromAccessor<float>(asset, input, times.data() + decoded.timesOffset, adapter);
+		}
+		if (input.count != 0)
+			duration = max(duration, times[decoded.timesOffset + input.count - 1]);
+
+		// Cubic spline samplers store an in-tangent, the value, and an out-tangent for every keyframe.
+		decoded.valuesOffset = values.size();
+		values.resize(values.size() + output.count * decoded.componentCount);
+		if (path == AnimationPath::Rotation) {
+			copyFromAccessor<math::fvec4>(asset, output, values.data() + decoded.valuesOffset, adapter);
+		} else {
+			copyFromAccessor<math::fvec3>(asset, output, values.data() + decoded.valuesOffset, adapter);
+		}
+
+		const auto valuesPerKeyframe = sampler.interpolation == AnimationInterpolation::CubicSpline ? 3U : 1U;
+		decoded.keyframeCount = min(decoded.keyframeCount, output.count / valuesPerKeyframe);
+		samplers.emplace_back(decoded);
+	}
+};
+
+/**
+ * Evaluates a DecodedAnimation into the local transforms of a FlattenedScene. Every channel keeps a cursor to the
+ * keyframe it was last evaluated at, which makes playing an animation forwards or backwards O(1) per channel.
+ * Jumps are resolved with a binary search.
+ */
+FASTGLTF_EXPORT class AnimationEvaluator {
+public:
+	AnimationEvaluator() = default;
+
+	/** The animation has to outlive the evaluator and the scene must have been flattened from the same asset. */
+	AnimationEvaluator(const DecodedAnimation& animation, const FlattenedScene& scene);
+
+	/**
+	 * Samples all channels at the given time and writes the results to the scene.
+	 * Times outside of a sampler's keyframes are clamped to its first or last keyframe.
+	 */
+	void evaluate(float time, FlattenedScene& scene) noexcept;
+
+	/** Moves all cursors back to the first keyframe. */
+	void resetCursors() noexcept;
+
+private:
+	const DecodedAnimation* animation = nullptr;
+	std::vector<std::size_t> targets;
+	std::vector<std::size_t> cursors;
+};
+
+/** Specifies how precisely a ReadRequestList determines the ranges which need to be read for an accessor. */
+FASTGLTF_EXPORT enum class ReadGranularity : std::uint8_t {
+	/** Reads the entire buffer view of every accessor. */
+	BufferView,
+	/** Only reads the bytes of the buffer view which are actually covered by the accessor. */
+	Accessor,
+};
+
+/** A single contiguous read from the file of a buffer whose source is a sources::URI. */
+FASTGLTF_EXPORT struct ReadRequest {
+	/**
+	 * The index into Asset::buffers of the buffer this reads from. The file is specified by the buffer's
+	 * sources::URI, where an empty URI refers to the GLB file itself, as with Options::SkipGLBBuffer.
+	 */
+	std::size_t bufferIndex;
+	/** The offset within the file, which already includes the fileByteOffset of the sources::URI. */
+	std::size_t fileOffset;
+	std::size_t size;
+	/** The offset within the destination, which holds the bytes of all requests back to back. */
+	std::size_t destinationOffset;
+};
+
+/**
+ * Turns the buffer views and accessors used by meshes into a list of file reads, for buffers which have not been
+ * loaded and are still a sources::URI. These can be handed to APIs like DirectStorage, io_uring, or Metal IO, so that
+ * only the geometry which is actually used is read, directly into a single destination buffer. Buffer views
+ * compressed with EXT_meshopt_compression and KHR_draco_mesh_compression are read in their compressed form.
+ * References to buffers with any other source, or to invalid indices, are ignored.
+ */
+FASTGLTF_EXPORT class ReadRequestList {
+public:
+	/** The asset has to outlive the list. */
+	explicit ReadRequestList(const Asset& asset, ReadGranularity granularity = ReadGranularity::BufferView)
+			: asset(&asset), granularity(granularity) {}
+
+	void addBufferView(std::size_t bufferViewIndex);
+	/** Adds the bytes of the accessor, including those of its sparse indices and values. */
+	void addAccessor(std::size_t accessorIndex);
+	/** Adds the indices, attributes, and morph targets of the primitive. */
+	void addPrimitive(const Primitive& primitive);
+	void addMesh(std::size_t meshIndex);
+	void addAllMeshes();
+
+	/**
+	 * Sorts all ranges added so far and merges those which overlap or are at most mergeDistance bytes apart.
+	 * With an alignment other than one, the file offsets, sizes, and destination offsets are all aligned to it,
+	 * as required for unbuffered I/O. The last request of a file may then extend past the end of the file.
+	 * More ranges can be added afterwards, which requires calling this again.
+	 */
+	void coalesce(std::size_t alignment = 1, std::size_t mergeDistance = 0);
+
+	[[nodiscard]] span<const ReadRequest> getRequests() const noexcept {
+		return span(requests.data(), requests.size());
+	}
+
+	/** Returns the number of bytes the destination of all requests needs to hold. */
+	[[nodiscard]] std::size_t getDestinationSize() const noexcept {
+		return destinationSize;
+	}
+
+	/** Returns where the byte at the given offset within a buffer ends up in the destination, if it is read at all. */
+	[[nodiscard]] Optional<std::size_t> getDestinationOffset(std::size_t bufferIndex, std::size_t byteOffset) const noexcept;
+
+	/** Returns where the first element of the accessor ends up in the destination, unless its buffer view is compressed. */
+	[[nodiscard]] Optional<std::size_t> getDestinationOffset(const Accessor& accessor) const noexcept;
+
+private:
+	const Asset* asset;
+	ReadGranularity granularity;
+	std::vector<ReadRequest> requests;
+	std::size_t destinationSize = 0;
+	/** Whether the requests are sorted and do not overlap, which allows searching them. */
+	bool coalesced = true;
+
+	void addRange(std::size_t bufferIndex, std::size_t byteOffset, std::size_t byteLength);
+	void addBufferViewRange(std::size_t bufferViewIndex, std::size_t byteOffset, std::size_t byteLength);
+};
+
 } // namespace fastgltf
@@ -29,6 +29,7 @@
 #if !defined(FASTGLTF_USE_STD_MODULE) || !FASTGLTF_USE_STD_MODULE
 #include <cassert>
 #include <filesystem>
+#include <new>
 #include <optional>
 #include <string>
 #include <utility>
@@ -2179,6 +2180,8 @@ namespace fastgltf {
     };
 
 	class ChunkMemoryResource;
+	class RetainedDocument;
+	FASTGLTF_EXPORT class GltfDataGetter;
 	FASTGLTF_EXPORT class Parser;
 
 	FASTGLTF_EXPORT class Asset {
@@ -2187,9 +2190,25 @@ namespace fastgltf {
 #if !FASTGLTF_DISABLE_CUSTOM_MEMORY_POOL
 		// This has to be first in this struct so that it gets destroyed last, leaving all allocations
 		// alive until the end.
-		std::shared_ptr<std::pmr::monotonic_buffer_resource> memoryResource;
+		std::shared_ptr<ChunkMemoryResource> memoryResource;
+
+		// Additional memory resources used by each category with Options::ParseCategoriesInParallel.
+		std::vector<std::shared_ptr<ChunkMemoryResource>> categoryMemoryResources;
+
+		// Creates an asset whose containers all allocate from the given memory resource.
+		explicit Asset(std::shared_ptr<ChunkMemoryResource> resource);
 #endif
 
+		// The data getter the asset was loaded from, if ownership was shared with the parser. This keeps
+		// data referenced through Options::ReferenceGLBBuffer alive.
+		std::shared_ptr<GltfDataGetter> dataGetter;
+
+		// The memory mappings of all external buffers loaded with Options::MapExternalBuffers.
+		std::vector<std::shared_ptr<GltfDataGetter>> mappedFiles;
+
+		// The JSON document of the categories which have not been parsed yet with Options::LazyCategories.
+		std::shared_ptr<RetainedDocument> retainedDocument;
+
 	public:
         /**
          * This will only ever have no value if #Options::DontRequireValidAssetMember was specified.
@@ -2199,20 +2218,20 @@ namespace fastgltf {
 		FASTGLTF_STD_PMR_NS::vector<FASTGLTF_STD_PMR_NS::string> extensionsRequired;
 
         Optional<std::size_t> defaultScene;
-        std::vector<Accessor> accessors;
-        std::vector<Animation> animations;
-        std::vector<Buffer> buffers;
-        std::vector<BufferView> bufferViews;
-        std::vector<Camera> cameras;
-        std::vector<Image> images;
-        std::vector<Light> lights;
-        std::vector<Material> materials;
-        std::vector<Mesh> meshes;
-        std::vector<Node> nodes;
-        std::vector<Sampler> samplers;
-        std::vector<Scene> scenes;
-        std::vector<Skin> skins;
-        std::vector<Texture> textures;
+        FASTGLTF_STD_PMR_NS::vector<Accessor> accessors;
+        FASTGLTF_STD_PMR_NS::vector<Animation> animations;
+        FASTGLTF_STD_PMR_NS::vector<Buffer> buffers;
+        FASTGLTF_STD_PMR_NS::vector<BufferView> bufferViews;
+        FASTGLTF_STD_PMR_NS::vector<Camera> cameras;
+        FASTGLTF_STD_PMR_NS::vector<Image> images;
+        FASTGLTF_STD_PMR_NS::vector<Light> lights;
+        FASTGLTF_STD_PMR_NS::vector<Material> materials;
+        FASTGLTF_STD_PMR_NS::vector<Mesh> meshes;
+        FASTGLTF_STD_PMR_NS::vector<Node> nodes;
+        FASTGLTF_STD_PMR_NS::vector<Sampler> samplers;
+        FASTGLTF_STD_PMR_NS::vector<Scene> scenes;
+        FASTGLTF_STD_PMR_NS::vector<Skin> skins;
+        FASTGLTF_STD_PMR_NS::vector<Texture> textures;
 
 		std::vector<std::string> materialVariants;
 
@@ -2224,7 +2243,11 @@ namespace fastgltf {
         Asset(Asset&& other) noexcept :
 #if !FASTGLTF_DISABLE_CUSTOM_MEMORY_POOL
 				memoryResource(std::move(other.memoryResource)),
+				categoryMemoryResources(std::move(other.categoryMemoryResources)),
 #endif
+				dataGetter(std::move(other.dataGetter)),
+				mappedFiles(std::move(other.mappedFiles)),
+				retainedDocument(std::move(other.retainedDocument)),
 				assetInfo(std::move(other.assetInfo)),
 				extensionsUsed(std::move(other.extensionsUsed)),
 				extensionsRequired(std::move(other.extensionsRequired)),
@@ -2248,34 +2271,29 @@ namespace fastgltf {
 
 		Asset& operator=(const Asset& other) = delete;
 		Asset& operator=(Asset&& other) noexcept {
-			assetInfo = std::move(other.assetInfo);
-			extensionsUsed = std::move(other.extensionsUsed);
-			extensionsRequired = std::move(other.extensionsRequired);
-			defaultScene = other.defaultScene;
-			accessors = std::move(other.accessors);
-			animations = std::move(other.animations);
-			buffers = std::move(other.buffers);
-			bufferViews = std::move(other.bufferViews);
-			cameras = std::move(other.cameras);
-			images = std::move(other.images);
-			lights = std::move(other.lights);
-			materials = std::move(other.materials);
-			meshes = std::move(other.meshes);
-			nodes = std::move(other.nodes);
-			samplers = std::move(other.samplers);
-			scenes = std::move(other.scenes);
-			skins = std::move(other.skins);
-			textures = std::move(other.textures);
-			materialVariants = std::move(other.materialVariants);
-			availableCategories = other.availableCategories;
-#if !FASTGLTF_DISABLE_CUSTOM_MEMORY_POOL
-			// This needs to be last to not destroy the old memoryResource for the current data.
-			memoryResource = std::move(other.memoryResource);
-#endif
+			// Move-assigning the containers would move the elements into memory owned by this asset's
+			// memory resource if it differs from the other one's, which is destroyed right after.
+			// Reconstructing the asset instead takes over the other asset's memory and containers directly.
+			if (this != &other) {
+				this->~Asset();
+				new (this) Asset(std::move(other));
+			}
 			return *this;
 		}
     };
 #pragma endregion
+
+	FASTGLTF_EXPORT using TaskFunction = void(std::size_t taskIndex, void* taskData);
+	FASTGLTF_EXPORT using TaskExecutorCallback = void(std::size_t taskCount, TaskFunction* task, void* taskData, void* userPointer);
+
+	/**
+	 * Runs all tasks through the given executor callback. When no callback is given, threads are spawned
+	 * for the duration of the call, which take tasks together with the calling thread. All calls share a
+	 * limit of one thread per hardware thread, so nested or concurrent calls may run on fewer threads, and
+	 * if no thread can be created the calling thread runs every task. This only returns once every task has finished.
+	 */
+	FASTGLTF_EXPORT void executeTasks(std::size_t taskCount, TaskFunction* task, void* taskData,
+			TaskExecutorCallback* executor = nullptr, void* userPointer = nullptr);
 } // namespace fastgltf
 
 #ifdef _MSC_VER
@@ -46,6 +46,9 @@
 #include <smmintrin.h>
 #include <avxintrin.h>
 #include <avx2intrin.h>
+#include <avx512fintrin.h>
+#include <avx512bwintrin.h>
+#include <avx512vbmiintrin.h>
 #else
 #include <intrin.h>
 #endif
@@ -64,10 +67,42 @@ namespace fg = fastgltf;
 namespace fastgltf::base64 {
     using DecodeFunctionInplace = std::function<void(std::string_view, std::uint8_t*, std::size_t)>;
     using DecodeFunction = std::function<fg::StaticVector<std::uint8_t>(std::string_view)>;
+    using EncodeFunctionInplace = std::function<void(const std::uint8_t*, std::size_t, char*)>;
+
+#if defined(FASTGLTF_IS_X86)
+    bool avx512_vbmi_supported() {
+        // simdjson's icelake implementation also requires VBMI2, which would exclude CPUs that support VBMI but not
+        // VBMI2, therefore the CPU features are checked manually here.
+#if defined(__clang__) || defined(__GNUC__)
+        // These also check that the OS saves the AVX-512 registers.
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw") && __builtin_cpu_supports("avx512vbmi");
+#elif defined(_MSC_VER)
+        std::array<int, 4> info {};
+        __cpuid(info.data(), 0);
+        if (info[0] < 7)
+            return false;
+
+        // The OS has to save the opmask and ZMM registers, which requires OSXSAVE.
+        __cpuid(info.data(), 1);
+        if ((info[2] & (1 << 27)) == 0 || (_xgetbv(0) & 0xe6) != 0xe6)
+            return false;
+
+        __cpuidex(info.data(), 7, 0);
+        const bool avx512f = (info[1] & (1 << 16)) != 0;
+        const bool avx512bw = (info[1] & (1 << 30)) != 0;
+        const bool avx512vbmi = (info[2] & (1 << 1)) != 0;
+        return avx512f && avx512bw && avx512vbmi;
+#else
+        return false;
+#endif
+    }
+#endif
 
     struct DecodeFunctionGetter {
         DecodeFunction func;
         DecodeFunctionInplace inplace;
+        EncodeFunctionInplace encode;
 
         explicit DecodeFunctionGetter() {
             // We use simdjson's helper functions to determine which SIMD intrinsics are available at runtime.
@@ -75,12 +110,19 @@ namespace fastgltf::base64 {
             // they load multiple at once.
             const auto& impls = simdjson::get_available_implementations();
 #if defined(FASTGLTF_IS_X86)
-            if (const auto* avx2 = impls["haswell"]; avx2 != nullptr && avx2->supported_by_runtime_system()) {
+            if (avx512_vbmi_supported()) {
+                // Every CPU with AVX-512 also supports AVX2, which is still used for encoding.
+                func = avx512_decode;
+                inplace = avx512_decode_inplace;
+                encode = avx2_encode_inplace;
+            } else if (const auto* avx2 = impls["haswell"]; avx2 != nullptr && avx2->supported_by_runtime_system()) {
                 func = avx2_decode;
                 inplace = avx2_decode_inplace;
+                encode = avx2_encode_inplace;
             } else if (const auto* sse4 = impls["westmere"]; sse4 != nullptr && sse4->supported_by_runtime_system()) {
                 func = sse4_decode;
                 inplace = sse4_decode_inplace;
+                encode = sse4_encode_inplace;
             }
 #elif defined(FASTGLTF_IS_A64)
             // _M_ARM64 always guarantees 64-bit ARM processors that support NEON, defined by MSVC.
@@ -89,6 +131,7 @@ namespace fastgltf::base64 {
             if (const auto* neon = impls["arm64"]; neon && neon->supported_by_runtime_system()) {
                 func = neon_decode;
                 inplace = neon_decode_inplace;
+                encode = neon_encode_inplace;
             }
 #else
             if (false) {}
@@ -96,6 +139,7 @@ namespace fastgltf::base64 {
             else {
                 func = fallback_decode;
                 inplace = fallback_decode_inplace;
+                encode = fallback_encode_inplace;
             }
         }
 
@@ -104,9 +148,92 @@ namespace fastgltf::base64 {
             return &getter;
         }
     };
+
+    // base64 value -> ASCII value LUT
+    [[gnu::aligned(16)]] static constexpr std::array<char, 64> base64chars = {
+        'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H', 'I', 'J', 'K', 'L', 'M', 'N', 'O', 'P',
+        'Q', 'R', 'S', 'T', 'U', 'V', 'W', 'X', 'Y', 'Z', 'a', 'b', 'c', 'd', 'e', 'f',
+        'g', 'h', 'i', 'j', 'k', 'l', 'm', 'n', 'o', 'p', 'q', 'r', 's', 't', 'u', 'v',
+        'w', 'x', 'y', 'z', '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', '+', '/',
+    };
 } // namespace fastgltf::base64
 
+// clang-format off
+// ASCII value -> base64 value LUT
+static constexpr std::array<std::uint8_t, 128> base64lut = {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,62,0,0,0,63,
+    52, 53, 54, 55, 56, 57, 58, 59, 60, 61,
+    0,0,0,0,0,0,0,
+    0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,
+    0,0,0,0,0,0,
+    26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,
+    0,0,0,0,0,
+};
+// clang-format on
+
 #if defined(FASTGLTF_IS_X86)
+// The AVX-512 decoding function is based on http://0x80.pl/notesen/2016-04-03-avx512-base64.html, using the
+// VBMI byte permutations to do the lookup and the packing with a single instruction each.
+[[gnu::target("avx512f,avx512bw,avx512vbmi")]] void fg::base64::avx512_decode_inplace(std::string_view encoded, std::uint8_t* output, std::size_t padding) {
+    constexpr auto dataSetSize = 64;
+    constexpr auto dataOutputSize = 48;
+
+    if (encoded.size() < dataSetSize) {
+        fallback_decode_inplace(encoded, output, padding);
+        return;
+    }
+
+    // The lower seven bits of every char index into the 128 entry LUT, which is split over two registers.
+    const auto lutLow = _mm512_loadu_si512(base64lut.data());
+    const auto lutHigh = _mm512_loadu_si512(base64lut.data() + 64);
+
+    // Takes the three bytes of every 32-bit integer in big-endian order.
+    alignas(64) static constexpr std::array<std::uint8_t, 64> packData = [] {
+        std::array<std::uint8_t, 64> data {};
+        for (std::size_t i = 0; i < 16; ++i) {
+            data[i * 3 + 0] = static_cast<std::uint8_t>(i * 4 + 2);
+            data[i * 3 + 1] = static_cast<std::uint8_t>(i * 4 + 1);
+            data[i * 3 + 2] = static_cast<std::uint8_t>(i * 4 + 0);
+        }
+        return data;
+    }();
+    const auto pack = _mm512_load_si512(packData.data());
+
+    // The masked store only writes the 48 decoded bytes, so nothing past the output is ever written.
+    constexpr __mmask64 storeMask = (__mmask64(1) << dataOutputSize) - 1;
+
+    // At least one block of four chars is always left for the fallback decoder to handle the padding.
+    const auto encodedSize = encoded.size();
+    auto* out = output;
+    std::size_t pos = 0;
+    while ((pos + dataSetSize) < encodedSize) {
+        const auto in = _mm512_loadu_si512(&encoded[pos]);
+        const auto values = _mm512_permutex2var_epi8(lutLow, in, lutHigh);
+        const auto merged = _mm512_maddubs_epi16(values, _mm512_set1_epi32(0x01400140));
+        const auto packed = _mm512_madd_epi16(merged, _mm512_set1_epi32(0x00011000));
+        // The zero-masking permute with a full mask is the same instruction, but unlike _mm512_permutexvar_epi8
+        // doesn't use _mm512_undefined_epi32, for which GCC emits a false -Wmaybe-uninitialized (GCC bug 105593).
+        const auto shuffled = _mm512_maskz_permutexvar_epi8(~__mmask64(0), pack, packed);
+        _mm512_mask_storeu_epi8(out, storeMask, shuffled);
+
+        out += dataOutputSize;
+        pos += dataSetSize;
+    }
+
+    // Decode the last chunk traditionally
+    fallback_decode_inplace(encoded.substr(pos, encodedSize - pos), out, padding);
+}
+
+[[gnu::target("avx512f,avx512bw,avx512vbmi")]] fg::StaticVector<std::uint8_t> fg::base64::avx512_decode(std::string_view encoded) {
+    const auto encodedSize = encoded.size();
+    const auto padding = getPadding(encoded);
+
+    fg::StaticVector<std::uint8_t> ret(getOutputSize(encodedSize, padding));
+    avx512_decode_inplace(encoded, ret.data(), padding);
+
+    return ret;
+}
+
 // The AVX and SSE decoding functions are based on http://0x80.pl/notesen/2016-01-17-sse-base64-decoding.html.
 // It covers various methods of en-/decoding base64 using SSE and AVX and also shows their
 // performance metrics.
@@ -141,11 +268,9 @@ namespace fastgltf::base64 {
         return;
     }
 
-    // We align the size to the highest size divisible by 32. By doing this, we don't need to
-    // allocate any new memory to hold the encoded data and let the fallback decoder decode the
-    // remaining data.
+    // The stores write 4 bytes past the decoded block. The loop therefore always leaves at least 8 chars, which
+    // decode to at least 4 bytes, for the fallback decoder, so that nothing is written past the end of the output.
     const auto encodedSize = encoded.size();
-    const auto alignedSize = encodedSize - (encodedSize % dataOutputSize);
     auto* out = output;
 
     // _mm256_setr_epi8 accepts only 'char' but 0xff would overflow a signed char, which makes some compilers unhappy.
@@ -166,7 +291,7 @@ namespace fastgltf::base64 {
     std::memcpy(&shuffle, shuffleData.data(), shuffleData.size());
 
     std::size_t pos = 0;
-    while ((pos + dataSetSize) < alignedSize) {
+    while (pos + dataSetSize + 8 <= encodedSize) {
         auto in = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&encoded[pos]));
         auto values = avx2_lookup_pshufb_bitmask(in);
         const auto merged = avx2_pack_ints(values);
@@ -222,11 +347,9 @@ namespace fastgltf::base64 {
         return;
     }
 
-    // We align the size to the highest size divisible by 16. By doing this, we don't need to
-    // allocate any new memory to hold the encoded data and let the fallback decoder decode the
-    // remaining data.
-	const auto encodedSize = encoded.size();
-	const auto alignedSize = encodedSize - (encodedSize % dataOutputSize);
+    // The stores write 4 bytes past the decoded block. The loop therefore always leaves at least 8 chars, which
+    // decode to at least 4 bytes, for the fallback decoder, so that nothing is written past the end of the output.
+    const auto encodedSize = encoded.size();
     auto* out = output;
 
     // _mm_setr_epi8 accepts only 'char' but 0xff would overflow a signed char, which makes some compilers unhappy.
@@ -242,7 +365,7 @@ namespace fastgltf::base64 {
     std::memcpy(&shuffle, shuffleData.data(), shuffleData.size());
 
     std::size_t pos = 0;
-    while ((pos + dataSetSize) < alignedSize) {
+    while (pos + dataSetSize + 8 <= encodedSize) {
         auto in = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&encoded[pos]));
         auto values = sse4_lookup_pshufb_bitmask(in);
         const auto merged = sse4_pack_ints(values);
@@ -268,6 +391,103 @@ namespace fastgltf::base64 {
 
     return ret;
 }
+
+// The AVX and SSE encoding functions are based on http://0x80.pl/notesen/2016-01-12-sse-base64-encoding.html.
+[[gnu::target("avx2")]] FASTGLTF_FORCEINLINE auto avx2_unpack_ints(const __m256i input) {
+    // Every lane holds 12 bytes, which are split into 16 6-bit values, each in its own byte.
+    const auto shuffled = _mm256_shuffle_epi8(input, _mm256_setr_epi8(
+        1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10,
+        1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10));
+
+    const auto t0 = _mm256_and_si256(shuffled, _mm256_set1_epi32(0x0fc0fc00));
+    const auto t1 = _mm256_mulhi_epu16(t0, _mm256_set1_epi32(0x04000040));
+    const auto t2 = _mm256_and_si256(shuffled, _mm256_set1_epi32(0x003f03f0));
+    const auto t3 = _mm256_mullo_epi16(t2, _mm256_set1_epi32(0x01000010));
+    return _mm256_or_si256(t1, t3);
+}
+
+[[gnu::target("avx2")]] FASTGLTF_FORCEINLINE auto avx2_lookup_pshufb_encode(const __m256i input) {
+    // Reduces the 6-bit values to an index into the LUT of offsets to add to them.
+    auto result = _mm256_subs_epu8(input, _mm256_set1_epi8(51));
+    const auto less = _mm256_cmpgt_epi8(_mm256_set1_epi8(26), input);
+    result = _mm256_or_si256(result, _mm256_and_si256(less, _mm256_set1_epi8(13)));
+
+    const auto shiftLUT = _mm256_setr_epi8(
+        'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+        '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0,
+
+        'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+        '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0);
+
+    return _mm256_add_epi8(_mm256_shuffle_epi8(shiftLUT, result), input);
+}
+
+[[gnu::target("avx2")]] void fg::base64::avx2_encode_inplace(const std::uint8_t* data, std::size_t size, char* output) {
+    constexpr auto dataSetSize = 24;
+    constexpr auto dataOutputSize = 32;
+
+    // Both 16 byte loads read 4 bytes past the 12 bytes each lane encodes, which the loop condition accounts for.
+    std::size_t pos = 0;
+    auto* out = output;
+    while (pos + dataSetSize + 4 <= size) {
+        const auto lo = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + pos));
+        const auto hi = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + pos + dataSetSize / 2));
+        const auto in = _mm256_inserti128_si256(_mm256_castsi128_si256(lo), hi, 1);
+
+        const auto chars = avx2_lookup_pshufb_encode(avx2_unpack_ints(in));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out), chars);
+
+        out += dataOutputSize;
+        pos += dataSetSize;
+    }
+
+    // Encode the last chunk, including the padding, traditionally
+    fallback_encode_inplace(data + pos, size - pos, out);
+}
+
+[[gnu::target("sse4.1")]] FASTGLTF_FORCEINLINE auto sse4_unpack_ints(const __m128i input) {
+    // Splits 12 bytes into 16 6-bit values, each in its own byte.
+    const auto shuffled = _mm_shuffle_epi8(input, _mm_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10));
+
+    const auto t0 = _mm_and_si128(shuffled, _mm_set1_epi32(0x0fc0fc00));
+    const auto t1 = _mm_mulhi_epu16(t0, _mm_set1_epi32(0x04000040));
+    const auto t2 = _mm_and_si128(shuffled, _mm_set1_epi32(0x003f03f0));
+    const auto t3 = _mm_mullo_epi16(t2, _mm_set1_epi32(0x01000010));
+    return _mm_or_si128(t1, t3);
+}
+
+[[gnu::target("sse4.1")]] FASTGLTF_FORCEINLINE auto sse4_lookup_pshufb_encode(const __m128i input) {
+    // Reduces the 6-bit values to an index into the LUT of offsets to add to them.
+    auto result = _mm_subs_epu8(input, _mm_set1_epi8(51));
+    const auto less = _mm_cmpgt_epi8(_mm_set1_epi8(26), input);
+    result = _mm_or_si128(result, _mm_and_si128(less, _mm_set1_epi8(13)));
+
+    const auto shiftLUT = _mm_setr_epi8(
+        'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+        '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0);
+
+    return _mm_add_epi8(_mm_shuffle_epi8(shiftLUT, result), input);
+}
+
+[[gnu::target("sse4.1")]] void fg::base64::sse4_encode_inplace(const std::uint8_t* data, std::size_t size, char* output) {
+    constexpr auto dataSetSize = 12;
+    constexpr auto dataOutputSize = 16;
+
+    // The 16 byte load reads 4 bytes past the 12 bytes being encoded, which the loop condition accounts for.
+    std::size_t pos = 0;
+    auto* out = output;
+    while (pos + dataSetSize + 4 <= size) {
+        const auto in = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + pos));
+        const auto chars = sse4_lookup_pshufb_encode(sse4_unpack_ints(in));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out), chars);
+
+        out += dataOutputSize;
+        pos += dataSetSize;
+    }
+
+    // Encode the last chunk, including the padding, traditionally
+    fallback_encode_inplace(data + pos, size - pos, out);
+}
 #elif defined(FASTGLTF_IS_A64)
 FASTGLTF_FORCEINLINE int8x16_t neon_lookup_pshufb_bitmask(const uint8x16_t input) {
     // clang-format off
@@ -322,17 +542,15 @@ void fg::base64::neon_decode_inplace(std::string_view encoded, std::uint8_t* out
         return;
     }
 
-    // We align the size to the highest size divisible by 16. By doing this, we don't need to
-    // allocate any new memory to hold the encoded data and let the fallback decoder decode the
-    // remaining data.
+    // The stores write 4 bytes past the decoded block. The loop therefore always leaves at least 8 chars, which
+    // decode to at least 4 bytes, for the fallback decoder, so that nothing is written past the end of the output.
     const auto encodedSize = encoded.size();
-    const auto alignedSize = encodedSize - (encodedSize % dataSetSize);
     auto* out = output;
 
     // Decode the first 16 long chunks with Neon intrinsics
     const auto shuffle = vld1q_u8(shuffleData.data());
     std::size_t pos = 0;
-    while ((pos + dataSetSize) < alignedSize) {
+    while (pos + dataSetSize + 8 <= encodedSize) {
         // Load 16 8-bit values into a 128-bit register.
         auto in = vld1q_u8(reinterpret_cast<const std::uint8_t*>(&encoded[pos]));
         auto values = neon_lookup_pshufb_bitmask(in);
@@ -360,20 +578,39 @@ fg::StaticVector<std::uint8_t> fg::base64::neon_decode(std::string_view encoded)
 
     return ret;
 }
-#endif
 
-// clang-format off
-// ASCII value -> base64 value LUT
-static constexpr std::array<std::uint8_t, 128> base64lut = {
-    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,62,0,0,0,63,
-    52, 53, 54, 55, 56, 57, 58, 59, 60, 61,
-    0,0,0,0,0,0,0,
-    0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,
-    0,0,0,0,0,0,
-    26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,
-    0,0,0,0,0,
-};
-// clang-format on
+void fg::base64::neon_encode_inplace(const std::uint8_t* data, std::size_t size, char* output) {
+    constexpr auto dataSetSize = 48;
+    constexpr auto dataOutputSize = 64;
+
+    // The whole 64 char alphabet fits into four registers, which vqtbl4q_u8 can look up directly.
+    const auto* chars = reinterpret_cast<const std::uint8_t*>(base64chars.data());
+    const uint8x16x4_t lut = {{ vld1q_u8(chars), vld1q_u8(chars + 16), vld1q_u8(chars + 32), vld1q_u8(chars + 48) }};
+    const auto mask = vdupq_n_u8(0x3F);
+
+    std::size_t pos = 0;
+    auto* out = reinterpret_cast<std::uint8_t*>(output);
+    while (pos + dataSetSize <= size) {
+        // Deinterleave 16 blocks of 3 bytes, and split them into four 6-bit values.
+        const auto in = vld3q_u8(data + pos);
+        uint8x16x4_t values;
+        values.val[0] = vshrq_n_u8(in.val[0], 2);
+        values.val[1] = vandq_u8(vorrq_u8(vshlq_n_u8(in.val[0], 4), vshrq_n_u8(in.val[1], 4)), mask);
+        values.val[2] = vandq_u8(vorrq_u8(vshlq_n_u8(in.val[1], 2), vshrq_n_u8(in.val[2], 6)), mask);
+        values.val[3] = vandq_u8(in.val[2], mask);
+
+        for (auto& value : values.val)
+            value = vqtbl4q_u8(lut, value);
+        vst4q_u8(out, values);
+
+        out += dataOutputSize;
+        pos += dataSetSize;
+    }
+
+    // Encode the last chunk, including the padding, traditionally
+    fallback_encode_inplace(data + pos, size - pos, reinterpret_cast<char*>(out));
+}
+#endif
 
 namespace fastgltf::base64 {
     template <typename Output>
@@ -414,6 +651,28 @@ void fg::base64::fallback_decode_inplace(std::string_view encoded, std::uint8_t*
 	}
 }
 
+void fg::base64::fallback_encode_inplace(const std::uint8_t* data, std::size_t size, char* output) {
+    std::size_t pos = 0;
+    for (; pos + 3 <= size; pos += 3) {
+        const auto block = (std::uint32_t(data[pos]) << 16U) | (std::uint32_t(data[pos + 1]) << 8U) | std::uint32_t(data[pos + 2]);
+        output[0] = base64chars[(block >> 18U) & 0x3FU];
+        output[1] = base64chars[(block >> 12U) & 0x3FU];
+        output[2] = base64chars[(block >> 6U) & 0x3FU];
+        output[3] = base64chars[block & 0x3FU];
+        output += 4;
+    }
+
+    // Encode the last one or two bytes, padding the output to four chars.
+    if (pos < size) {
+        const bool hasSecond = pos + 1 < size;
+        const auto block = (std::uint32_t(data[pos]) << 16U) | (hasSecond ? std::uint32_t(data[pos + 1]) << 8U : 0U);
+        output[0] = base64chars[(block >> 18U) & 0x3FU];
+        output[1] = base64chars[(block >> 12U) & 0x3FU];
+        output[2] = hasSecond ? base64chars[(block >> 6U) & 0x3FU] : '=';
+        output[3] = '=';
+    }
+}
+
 fg::StaticVector<std::uint8_t> fg::base64::fallback_decode(std::string_view encoded) {
     const auto encodedSize = encoded.size();
     const auto padding = getPadding(encoded);
@@ -430,12 +689,45 @@ void fg::base64::decode_inplace(std::string_view encoded, std::uint8_t* output,
     return DecodeFunctionGetter::get()->inplace(encoded, output, padding);
 }
 
+void fg::base64::decode_inplace_parallel(std::string_view encoded, std::uint8_t* output, std::size_t padding,
+                                         TaskExecutorCallback* executor, void* userPointer) {
+    assert(encoded.size() % 4 == 0);
+    if (encoded.size() < parallelDecodeThreshold) {
+        decode_inplace(encoded, output, padding);
+        return;
+    }
+
+    struct ChunkData {
+        std::string_view encoded;
+        std::uint8_t* output;
+        std::size_t padding;
+    } data { encoded, output, padding };
+
+    // Every chunk has to be a multiple of four chars, and a multiple of 64 keeps the SIMD blocks of all decoders intact.
+    constexpr std::size_t chunkSize = 1024 * 1024;
+    const auto chunkCount = (encoded.size() + chunkSize - 1) / chunkSize;
+    executeTasks(chunkCount, [](std::size_t chunkIndex, void* taskData) {
+        const auto& chunk = *static_cast<const ChunkData*>(taskData);
+        const auto offset = chunkIndex * chunkSize;
+        const auto encodedChunk = chunk.encoded.substr(offset, chunkSize);
+
+        // Only the last chunk contains the padding. None of the decoders write past the end of their output,
+        // so the chunks can be decoded independently.
+        const bool isLast = offset + encodedChunk.size() == chunk.encoded.size();
+        decode_inplace(encodedChunk, chunk.output + getOutputSize(offset, 0), isLast ? chunk.padding : 0);
+    }, &data, executor, userPointer);
+}
+
 fg::StaticVector<std::uint8_t> fg::base64::decode(std::string_view encoded) {
     assert(encoded.size() % 4 == 0);
 
     return DecodeFunctionGetter::get()->func(encoded);
 }
 
+void fg::base64::encode_inplace(const std::uint8_t* data, std::size_t size, char* output) {
+    return DecodeFunctionGetter::get()->encode(data, size, output);
+}
+
 #ifdef _MSC_VER
 #pragma warning(pop)
 #endif
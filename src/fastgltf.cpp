@@ -28,9 +28,15 @@
 #error "fastgltf requires C++17"
 #endif
 
+#include <atomic>
+#include <cerrno>
+#include <charconv>
+#include <climits>
+#include <cstdio>
 #include <fstream>
 #include <functional>
 #include <mutex>
+#include <thread>
 #include <utility>
 
 #ifdef _MSC_VER
@@ -50,6 +56,18 @@ static_assert(std::string_view { SIMDJSON_TARGET_VERSION } == SIMDJSON_VERSION,
 #include <fastgltf/core.hpp>
 #include <fastgltf/base64.hpp>
 
+#include "profiling.hpp"
+
+#if FASTGLTF_ENABLE_MESHOPT
+#include <meshoptimizer.h>
+#endif
+
+#if defined(__APPLE__) || defined(__linux__)
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/uio.h>
+#endif
+
 #if defined(FASTGLTF_IS_X86)
 #include <nmmintrin.h> // SSE4.2 for the CRC-32C instructions
 #elif defined(FASTGLTF_ENABLE_ARMV8_CRC)
@@ -305,118 +323,433 @@ namespace fastgltf {
 		OcclusionTexture = 2,
 	};
 
-	fg::Error parseTextureInfo(simdjson::dom::object& object, std::string_view key, TextureInfo* info, Extensions extensions, TextureInfoType type = TextureInfoType::Standard) noexcept {
+	/**
+	 * Parses a textureInfo object, given the JSON value of the field holding it. All fields of the object and of its
+	 * KHR_texture_transform extension are read in a single pass over the keys.
+	 */
+	fg::Error parseTextureInfo(simdjson::dom::element value, TextureInfo* info, Extensions extensions, TextureInfoType type = TextureInfoType::Standard) noexcept {
 		using namespace simdjson;
 
 		dom::object child;
-		if (auto childErr = object[key].get_object().get(child); childErr == NO_SUCH_FIELD) {
-			return Error::MissingField;
-		} else if (childErr != SUCCESS) FASTGLTF_UNLIKELY {
+		if (value.get_object().get(child) != SUCCESS) FASTGLTF_UNLIKELY {
 			return Error::InvalidGltf;
 		}
 
-		std::uint64_t index;
-		if (child["index"].get_uint64().get(index) == SUCCESS) FASTGLTF_LIKELY {
-			info->textureIndex = static_cast<std::size_t>(index);
-		} else {
+		bool hasIndex = false;
+		for (auto field : child) {
+			switch (crcStringFunction(field.key)) {
+				case force_consteval<crc32c("index")>: {
+					std::uint64_t index;
+					if (field.value.get_uint64().get(index) != SUCCESS) FASTGLTF_UNLIKELY {
+						return Error::InvalidGltf;
+					}
+					info->textureIndex = static_cast<std::size_t>(index);
+					hasIndex = true;
+					break;
+				}
+				case force_consteval<crc32c("texCoord")>: {
+					std::uint64_t index;
+					if (field.value.get_uint64().get(index) != SUCCESS) FASTGLTF_UNLIKELY {
+						return Error::InvalidJson;
+					}
+					info->texCoordIndex = static_cast<std::size_t>(index);
+					break;
+				}
+				case force_consteval<crc32c("scale")>: {
+					if (type != TextureInfoType::NormalTexture)
+						break;
+					double scale;
+					if (field.value.get_double().get(scale) != SUCCESS) FASTGLTF_UNLIKELY {
+						return Error::InvalidGltf;
+					}
+					reinterpret_cast<NormalTextureInfo*>(info)->scale = static_cast<num>(scale);
+					break;
+				}
+				case force_consteval<crc32c("strength")>: {
+					if (type != TextureInfoType::OcclusionTexture)
+						break;
+					double strength;
+					if (field.value.get_double().get(strength) != SUCCESS) FASTGLTF_UNLIKELY {
+						return Error::InvalidGltf;
+					}
+					reinterpret_cast<OcclusionTextureInfo*>(info)->strength = static_cast<num>(strength);
+					break;
+				}
+				case force_consteval<crc32c("extensions")>: {
+					dom::object extensionsObject;
+					if (!hasBit(extensions, Extensions::KHR_texture_transform) || field.value.get_object().get(extensionsObject) != SUCCESS)
+						break;
+
+					dom::object textureTransform;
+					if (extensionsObject[extensions::KHR_texture_transform].get_object().get(textureTransform) != SUCCESS)
+						break;
+
+					auto transform = std::make_unique<TextureTransform>();
+					transform->rotation = 0.0F;
+
+					for (auto transformField : textureTransform) {
+						switch (crcStringFunction(transformField.key)) {
+							case force_consteval<crc32c("texCoord")>: {
+								std::uint64_t index;
+								if (transformField.value.get_uint64().get(index) == SUCCESS) FASTGLTF_LIKELY {
+									transform->texCoordIndex = index;
+								}
+								break;
+							}
+							case force_consteval<crc32c("rotation")>: {
+								double rotation;
+								if (transformField.value.get_double().get(rotation) == SUCCESS) FASTGLTF_LIKELY {
+									transform->rotation = static_cast<num>(rotation);
+								}
+								break;
+							}
+							case force_consteval<crc32c("offset")>:
+							case force_consteval<crc32c("scale")>: {
+								dom::array array;
+								if (transformField.value.get_array().get(array) != SUCCESS)
+									break;
+
+								auto& target = transformField.key == "offset" ? transform->uvOffset : transform->uvScale;
+								for (auto i = 0U; i < 2; ++i) {
+									double val;
+									if (array.at(i).get_double().get(val) != SUCCESS) FASTGLTF_UNLIKELY {
+										return Error::InvalidGltf;
+									}
+									target[i] = static_cast<num>(val);
+								}
+								break;
+							}
+							default:
+								break;
+						}
+					}
+
+					info->transform = std::move(transform);
+					break;
+				}
+				default:
+					break;
+			}
+		}
+
+		if (!hasIndex) FASTGLTF_UNLIKELY {
 			return Error::InvalidGltf;
 		}
+		return Error::None;
+	}
 
-		if (auto error = child["texCoord"].get_uint64().get(index); error == SUCCESS) FASTGLTF_LIKELY {
-			info->texCoordIndex = static_cast<std::size_t>(index);
-		} else if (error != NO_SUCH_FIELD) FASTGLTF_UNLIKELY {
-            return Error::InvalidJson;
+	/**
+	 * Parses a JSON array of numbers into a fixed-size array of factors. The JSON array may be shorter than the
+	 * factor array, in which case the remaining factors keep their default values.
+	 */
+	template <std::size_t N>
+	[[nodiscard]] fg::Error parseFactorArray(simdjson::dom::element value, math::vec<num, N>& factors) noexcept {
+		using namespace simdjson;
+
+		dom::array array;
+		if (value.get_array().get(array) != SUCCESS) FASTGLTF_UNLIKELY {
+			return Error::InvalidGltf;
 		}
 
-		if (type == TextureInfoType::NormalTexture) {
-            double scale;
-			if (auto error = child["scale"].get_double().get(scale); error == SUCCESS) FASTGLTF_LIKELY {
-				reinterpret_cast<NormalTextureInfo*>(info)->scale = static_cast<num>(scale);
-			} else if (error != NO_SUCH_FIELD) FASTGLTF_UNLIKELY {
-                return Error::InvalidGltf;
+		std::size_t i = 0;
+		for (auto factor : array) {
+			if (i >= factors.size()) FASTGLTF_UNLIKELY {
+				return Error::InvalidGltf;
 			}
-		} else if (type == TextureInfoType::OcclusionTexture) {
-			double strength;
-			if (auto error = child["strength"].get_double().get(strength); error == SUCCESS) FASTGLTF_LIKELY {
-				reinterpret_cast<OcclusionTextureInfo*>(info)->strength = static_cast<num>(strength);
-			} else if (error != NO_SUCH_FIELD) FASTGLTF_UNLIKELY {
-                return Error::InvalidGltf;
-            }
+			double val;
+			if (factor.get_double().get(val) != SUCCESS) FASTGLTF_UNLIKELY {
+				return Error::InvalidGltf;
+			}
+			factors[i++] = static_cast<num>(val);
 		}
+		return Error::None;
+	}
 
-		dom::object extensionsObject;
-		if (child["extensions"].get_object().get(extensionsObject) == SUCCESS) FASTGLTF_LIKELY {
-			dom::object textureTransform;
-			if (hasBit(extensions, Extensions::KHR_texture_transform) && extensionsObject[extensions::KHR_texture_transform].get_object().get(textureTransform) == SUCCESS) FASTGLTF_LIKELY {
-				auto transform = std::make_unique<TextureTransform>();
-				transform->rotation = 0.0F;
-
-				if (textureTransform["texCoord"].get_uint64().get(index) == SUCCESS) FASTGLTF_LIKELY {
-					transform->texCoordIndex = index;
-				}
+	/** Parses an accessor's sparse object, including its indices and values objects, in a single pass each. */
+	fg::Error parseSparseAccessor(simdjson::dom::object& sparseAccessorObject, SparseAccessor& sparse) noexcept {
+		using namespace simdjson;
 
-				double rotation = 0.0F;
-				if (textureTransform["rotation"].get_double().get(rotation) == SUCCESS) FASTGLTF_LIKELY {
-					transform->rotation = static_cast<num>(rotation);
+		bool hasCount = false, hasIndices = false, hasValues = false;
+		for (auto field : sparseAccessorObject) {
+			switch (crcStringFunction(field.key)) {
+				case force_consteval<crc32c("count")>: {
+					std::uint64_t value;
+					if (field.value.get_uint64().get(value) != SUCCESS) FASTGLTF_UNLIKELY {
+						return Error::InvalidGltf;
+					}
+					sparse.count = static_cast<std::size_t>(value);
+					hasCount = true;
+					break;
 				}
+				case force_consteval<crc32c("indices")>: {
+					// Accessor Sparse Indices
+					dom::object child;
+					if (field.value.get_object().get(child) != SUCCESS) FASTGLTF_UNLIKELY {
+						return Error::InvalidGltf;
+					}
 
-				dom::array array;
-				if (textureTransform["offset"].get_array().get(array) == SUCCESS) FASTGLTF_LIKELY {
-					for (auto i = 0U; i < 2; ++i) {
-						double val;
-						if (array.at(i).get_double().get(val) != SUCCESS) FASTGLTF_UNLIKELY {
-							return Error::InvalidGltf;
+					bool hasBufferView = false, hasComponentType = false;
+					for (auto indicesField : child) {
+						std::uint64_t value;
+						switch (crcStringFunction(indicesField.key)) {
+							case force_consteval<crc32c("bufferView")>:
+								if (indicesField.value.get_uint64().get(value) != SUCCESS) FASTGLTF_UNLIKELY {
+									return Error::InvalidGltf;
+								}
+								sparse.indicesBufferView = static_cast<std::size_t>(value);
+								hasBufferView = true;
+								break;
+							case force_consteval<crc32c("byteOffset")>:
+								if (indicesField.value.get_uint64().get(value) != SUCCESS) FASTGLTF_UNLIKELY {
+									return Error::InvalidGltf;
+								}
+								sparse.indicesByteOffset = static_cast<std::size_t>(value);
+								break;
+							case force_consteval<crc32c("componentType")>:
+								if (indicesField.value.get_uint64().get(value) != SUCCESS) FASTGLTF_UNLIKELY {
+									return Error::InvalidGltf;
+								}
+								sparse.indexComponentType = getComponentType(static_cast<std::underlying_type_t<ComponentType>>(value));
+								hasComponentType = true;
+								break;
+							default:
+								break;
 						}
-						transform->uvOffset[i] = static_cast<num>(val);
 					}
+					if (!hasBufferView || !hasComponentType) FASTGLTF_UNLIKELY {
+						return Error::InvalidGltf;
+					}
+					hasIndices = true;
+					break;
 				}
+				case force_consteval<crc32c("values")>: {
+					// Accessor Sparse Values
+					dom::object child;
+					if (field.value.get_object().get(child) != SUCCESS) FASTGLTF_UNLIKELY {
+						return Error::InvalidGltf;
+					}
 
-				if (textureTransform["scale"].get_array().get(array) == SUCCESS) FASTGLTF_LIKELY {
-					for (auto i = 0U; i < 2; ++i) {
-						double val;
-						if (array.at(i).get_double().get(val) != SUCCESS) FASTGLTF_UNLIKELY {
-							return Error::InvalidGltf;
+					bool hasBufferView = false;
+					for (auto valuesField : child) {
+						std::uint64_t value;
+						switch (crcStringFunction(valuesField.key)) {
+							case force_consteval<crc32c("bufferView")>:
+								if (valuesField.value.get_uint64().get(value) != SUCCESS) FASTGLTF_UNLIKELY {
+									return Error::InvalidGltf;
+								}
+								sparse.valuesBufferView = static_cast<std::size_t>(value);
+								hasBufferView = true;
+								break;
+							case force_consteval<crc32c("byteOffset")>:
+								if (valuesField.value.get_uint64().get(value) != SUCCESS) FASTGLTF_UNLIKELY {
+									return Error::InvalidGltf;
+								}
+								sparse.valuesByteOffset = static_cast<std::size_t>(value);
+								break;
+							default:
+								break;
 						}
-						transform->uvScale[i] = static_cast<num>(val);
 					}
+					if (!hasBufferView) FASTGLTF_UNLIKELY {
+						return Error::InvalidGltf;
+					}
+					hasValues = true;
+					break;
 				}
-
-				info->transform = std::move(transform);
+				default:
+					break;
 			}
 		}
 
+		if (!hasCount || !hasIndices || !hasValues) FASTGLTF_UNLIKELY {
+			return Error::InvalidGltf;
+		}
+
 		return Error::None;
 	}
 
-	void writeTextureInfo(std::string& json, const TextureInfo* info, TextureInfoType type = TextureInfoType::Standard) {
+	/**
+	 * A growable buffer for the JSON written by the Exporter. Numbers are formatted with std::to_chars, and when
+	 * pretty-printing, newlines and tabs are inserted while the JSON is appended instead of in a second pass.
+	 */
+	class JsonOutput {
+		std::string buffer;
+		std::size_t depth;
+		/** The last character of the compact JSON, ignoring any whitespace added by pretty-printing. */
+		char last;
+		bool pretty;
+		bool inString = false;
+		bool escaped = false;
+
+		void newline() {
+			buffer += '\n';
+			buffer.append(depth, '\t');
+		}
+
+		void appendPretty(char c) {
+			if (inString) {
+				buffer += c;
+				if (escaped)
+					escaped = false;
+				else if (c == '\\')
+					escaped = true;
+				else if (c == '"')
+					inString = false;
+				return;
+			}
+
+			switch (c) {
+				case '"':
+					buffer += c;
+					inString = true;
+					break;
+				case '{': case '[':
+					buffer += c;
+					++depth;
+					newline();
+					break;
+				case '}': case ']':
+					--depth;
+					newline();
+					buffer += c;
+					break;
+				case ',':
+					buffer += c;
+					newline();
+					break;
+				default:
+					buffer += c;
+					break;
+			}
+		}
+
+		template <typename T>
+		void appendNumber(T value) {
+			std::array<char, 32> chars {};
+			char* end = chars.data();
+			if constexpr (std::is_floating_point_v<T>) {
+#if defined(__cpp_lib_to_chars)
+				end = std::to_chars(chars.data(), chars.data() + chars.size(), value).ptr;
+#else
+				// Enough digits to round-trip, for standard libraries without floating point to_chars.
+				const int count = std::snprintf(chars.data(), chars.size(), "%.*g",
+					std::numeric_limits<T>::max_digits10, static_cast<double>(value));
+				end = chars.data() + count;
+#endif
+			} else {
+				end = std::to_chars(chars.data(), chars.data() + chars.size(), value).ptr;
+			}
+			// Numbers never contain any structural characters, which allows skipping the pretty-printing.
+			buffer.append(chars.data(), static_cast<std::size_t>(end - chars.data()));
+			last = end[-1];
+		}
+
+	public:
+		/**
+		 * @param depth the nesting depth of the JSON this will be inserted into, for pretty-printing it.
+		 * @param last the last character of the JSON this will be appended to.
+		 */
+		explicit JsonOutput(bool pretty, std::size_t depth = 0, char last = '\0') : depth(depth), last(last), pretty(pretty) {}
+
+		void reserve(std::size_t size) {
+			buffer.reserve(size);
+		}
+
+		[[nodiscard]] char back() const noexcept {
+			return last;
+		}
+
+		JsonOutput& operator+=(char c) {
+			if (pretty)
+				appendPretty(c);
+			else
+				buffer += c;
+			last = c;
+			return *this;
+		}
+
+		JsonOutput& operator+=(std::string_view string) {
+			if (string.empty())
+				return *this;
+			if (pretty) {
+				for (auto c : string)
+					appendPretty(c);
+			} else {
+				buffer += string;
+			}
+			last = string.back();
+			return *this;
+		}
+
+		/**
+		 * Appends all arguments in order, where every arithmetic type except for char is written as a number.
+		 */
+		template <typename... Args>
+		void write(const Args&... args) {
+			([&](const auto& arg) {
+				using T = std::decay_t<decltype(arg)>;
+				if constexpr (std::is_arithmetic_v<T> && !std::is_same_v<T, char> && !std::is_same_v<T, bool>) {
+					appendNumber(arg);
+				} else {
+					*this += arg;
+				}
+			}(args), ...);
+		}
+
+		/**
+		 * Appends count characters without any pretty-printing, which is only valid within strings.
+		 * Returns a pointer to the characters, which the caller has to overwrite.
+		 */
+		[[nodiscard]] char* appendRaw(std::size_t count) {
+			const auto offset = buffer.size();
+			buffer.resize(offset + count);
+			if (count != 0)
+				last = '\0';
+			return buffer.data() + offset;
+		}
+
+		/** Appends JSON previously written into another output, which was created using the state of this one. */
+		void append(const JsonOutput& other) {
+			if (other.buffer.empty())
+				return;
+			buffer += other.buffer;
+			last = other.last;
+		}
+
+		[[nodiscard]] std::string& str() noexcept {
+			return buffer;
+		}
+	};
+
+	void writeTextureInfo(JsonOutput& json, const TextureInfo* info, TextureInfoType type = TextureInfoType::Standard) {
 		json += '{';
-		json += "\"index\":" + std::to_string(info->textureIndex);
+		json.write("\"index\":", info->textureIndex);
 		if (info->texCoordIndex != 0) {
-			json += ",\"texCoord\":" + std::to_string(info->texCoordIndex);
+			json.write(",\"texCoord\":", info->texCoordIndex);
 		}
 		if (type == TextureInfoType::NormalTexture) {
-			json += ",\"scale\":" + std::to_string(reinterpret_cast<const NormalTextureInfo*>(info)->scale);
+			json.write(",\"scale\":", reinterpret_cast<const NormalTextureInfo*>(info)->scale);
 		} else if (type == TextureInfoType::OcclusionTexture) {
-			json += ",\"strength\":" + std::to_string(reinterpret_cast<const OcclusionTextureInfo*>(info)->strength);
+			json.write(",\"strength\":", reinterpret_cast<const OcclusionTextureInfo*>(info)->strength);
 		}
 
         if (info->transform != nullptr) {
             json += R"(,"extensions":{"KHR_texture_transform":{)";
             const auto& transform = *info->transform;
             if (transform.uvOffset[0] != 0.0 || transform.uvOffset[1] != 0.0) {
-                json += "\"offset\":[" + std::to_string(transform.uvOffset[0]) + ',' + std::to_string(transform.uvOffset[1]) + ']';
+                json.write("\"offset\":[", transform.uvOffset[0], ',', transform.uvOffset[1], ']');
             }
             if (transform.rotation != 0.0) {
                 if (json.back() != '{') json += ',';
-                json += "\"rotation\":" + std::to_string(transform.rotation);
+                json.write("\"rotation\":", transform.rotation);
             }
             if (transform.uvScale[0] != 1.0 || transform.uvScale[1] != 1.0) {
                 if (json.back() != '{') json += ',';
-                json += "\"scale\":[" + std::to_string(transform.uvScale[0]) + ',' + std::to_string(transform.uvScale[1]) + ']';
+                json.write("\"scale\":[", transform.uvScale[0], ',', transform.uvScale[1], ']');
             }
             if (transform.texCoordIndex.has_value()) {
                 if (json.back() != '{') json += ',';
-                json += "\"texCoord\":" + std::to_string(transform.texCoordIndex.value());
+                json.write("\"texCoord\":", transform.texCoordIndex.value());
             }
             json += "}}";
         }
@@ -697,8 +1030,117 @@ bool fg::URI::isDataUri() const noexcept {
 }
 #pragma endregion
 
+#pragma region Memory resource
+#if !FASTGLTF_DISABLE_CUSTOM_MEMORY_POOL
+namespace fastgltf {
+	/**
+	 * Memory resource which linearly hands out memory from large chunks, allocated from an upstream resource, and
+	 * never frees individual allocations. Unlike std::pmr::monotonic_buffer_resource it can be reset while keeping
+	 * its memory, so that the memory of a destroyed asset can be reused for the next one.
+	 * This is not thread-safe.
+	 */
+	class ChunkMemoryResource final : public std::pmr::memory_resource {
+		struct Chunk {
+			std::byte* data;
+			std::size_t size;
+		};
+
+		std::pmr::memory_resource* upstream;
+		std::vector<Chunk> chunks;
+		std::size_t chunkIndex = 0;
+		std::size_t offset = 0;
+		std::size_t nextChunkSize;
+
+		static constexpr std::size_t chunkAlignment = alignof(std::max_align_t);
+
+		void release() noexcept {
+			for (const auto& chunk : chunks)
+				upstream->deallocate(chunk.data, chunk.size, chunkAlignment);
+			chunks.clear();
+			chunkIndex = 0;
+			offset = 0;
+		}
+
+		void* do_allocate(std::size_t bytes, std::size_t alignment) override {
+			while (true) {
+				if (chunkIndex < chunks.size()) {
+					const auto& chunk = chunks[chunkIndex];
+					const auto address = reinterpret_cast<std::uintptr_t>(chunk.data) + offset;
+					const auto padding = (alignment - address % alignment) % alignment;
+					if (padding + bytes <= chunk.size - offset) {
+						auto* pointer = chunk.data + offset + padding;
+						offset += padding + bytes;
+						return pointer;
+					}
+
+					// The rest of this chunk is skipped, as there is a chunk after it or one is allocated.
+					++chunkIndex;
+					offset = 0;
+					continue;
+				}
+
+				const auto size = std::max(nextChunkSize, bytes + alignment);
+				chunks.push_back({ static_cast<std::byte*>(upstream->allocate(size, chunkAlignment)), size });
+				nextChunkSize = size * 2;
+			}
+		}
+
+		void do_deallocate(void*, std::size_t, std::size_t) override {}
+
+		[[nodiscard]] bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+			return this == &other;
+		}
+
+	public:
+		static constexpr std::size_t minimumChunkSize = 4096;
+
+		explicit ChunkMemoryResource(std::size_t initialSize, std::pmr::memory_resource* upstream)
+				: upstream(upstream), nextChunkSize(std::max(initialSize, minimumChunkSize)) {}
+		ChunkMemoryResource(const ChunkMemoryResource& other) = delete;
+		ChunkMemoryResource& operator=(const ChunkMemoryResource& other) = delete;
+
+		~ChunkMemoryResource() override {
+			release();
+		}
+
+		[[nodiscard]] std::pmr::memory_resource* upstreamResource() const noexcept {
+			return upstream;
+		}
+
+		/**
+		 * Makes all memory available again, invalidating every previous allocation. Multiple chunks are merged into
+		 * a single one, and the memory is also reallocated if it is far off from the expected size.
+		 */
+		void reset(std::size_t expectedSize) {
+			expectedSize = std::max(expectedSize, minimumChunkSize);
+			std::size_t totalSize = 0;
+			for (const auto& chunk : chunks)
+				totalSize += chunk.size;
+
+			const auto size = totalSize / 8 > expectedSize ? expectedSize : std::max(expectedSize, totalSize);
+			if (chunks.size() > 1 || totalSize != size) {
+				release();
+				nextChunkSize = size;
+			}
+			chunkIndex = 0;
+			offset = 0;
+		}
+	};
+} // namespace fastgltf
+
+fg::Asset::Asset(std::shared_ptr<ChunkMemoryResource> resource) : memoryResource(std::move(resource)),
+		extensionsUsed(memoryResource.get()), extensionsRequired(memoryResource.get()),
+		accessors(memoryResource.get()), animations(memoryResource.get()), buffers(memoryResource.get()),
+		bufferViews(memoryResource.get()), cameras(memoryResource.get()), images(memoryResource.get()),
+		lights(memoryResource.get()), materials(memoryResource.get()), meshes(memoryResource.get()),
+		nodes(memoryResource.get()), samplers(memoryResource.get()), scenes(memoryResource.get()),
+		skins(memoryResource.get()), textures(memoryResource.get()) {}
+#endif
+#pragma endregion
+
 #pragma region glTF parsing
 fg::Expected<fg::DataSource> fg::Parser::decodeDataUri(URIView& uri) const noexcept {
+	FASTGLTF_PROFILE_STAGE(profilingScope, ParseStage::DecodeDataUri);
     auto path = uri.path();
     auto mimeEnd = path.find(';');
     auto mime = path.substr(0, mimeEnd);
@@ -716,8 +1158,12 @@ fg::Expected<fg::DataSource> fg::Parser::decodeDataUri(URIView& uri) const noexc
         auto size = base64::getOutputSize(encodedData.size(), padding);
         auto info = config.mapCallback(size, config.userPointer);
         if (info.mappedMemory != nullptr) {
+			FASTGLTF_PROFILE_COUNTS(profilingScope, size, 1);
             if (config.decodeCallback != nullptr) {
                 config.decodeCallback(encodedData, reinterpret_cast<std::uint8_t*>(info.mappedMemory), padding, size, config.userPointer);
+            } else if (hasBit(options, Options::DecodeDataUrisInParallel)) {
+                base64::decode_inplace_parallel(encodedData, reinterpret_cast<std::uint8_t*>(info.mappedMemory), padding,
+                                                config.executorCallback, config.userPointer);
             } else {
                 base64::decode_inplace(encodedData, reinterpret_cast<std::uint8_t*>(info.mappedMemory), padding);
             }
@@ -736,8 +1182,12 @@ fg::Expected<fg::DataSource> fg::Parser::decodeDataUri(URIView& uri) const noexc
 	// Decode the base64 data into a traditional vector
 	auto padding = base64::getPadding(encodedData);
 	fg::StaticVector<std::byte> uriData(base64::getOutputSize(encodedData.size(), padding));
+	FASTGLTF_PROFILE_COUNTS(profilingScope, uriData.size(), 1);
 	if (config.decodeCallback != nullptr) {
 		config.decodeCallback(encodedData, reinterpret_cast<std::uint8_t*>(uriData.data()), padding, uriData.size(), config.userPointer);
+	} else if (hasBit(options, Options::DecodeDataUrisInParallel)) {
+		base64::decode_inplace_parallel(encodedData, reinterpret_cast<std::uint8_t*>(uriData.data()), padding,
+										config.executorCallback, config.userPointer);
 	} else {
 		base64::decode_inplace(encodedData, reinterpret_cast<std::uint8_t*>(uriData.data()), padding);
 	}
@@ -837,169 +1287,554 @@ template fg::Error fg::Parser::parseAttributes(simdjson::dom::object&, FASTGLTF_
 template fg::Error fg::Parser::parseAttributes(simdjson::dom::object&, decltype(fastgltf::Primitive::attributes)&);
 
 namespace fastgltf {
-	template<typename T>
-	void writeIndices(PrimitiveType type, span<T> indices, std::size_t primitiveCount) {
-		// Generate the correct indices for every primitive topology
-		switch (type) {
-			case PrimitiveType::Points: {
-				for (std::size_t i = 0; i < primitiveCount; ++i)
-					indices[i] = static_cast<T>(i);
-				break;
-			}
-			case PrimitiveType::Lines:
-			case PrimitiveType::LineLoop:
-			case PrimitiveType::LineStrip: {
-				for (std::size_t i = 0; i < primitiveCount; ++i) {
-					indices[i * 2 + 0] = static_cast<T>(i * 2 + 0);
-					indices[i * 2 + 1] = static_cast<T>(i * 2 + 1);
+	/** Returns the bytes of a buffer that has been loaded into memory, or an empty span. */
+	static span<const std::byte> getLoadedBufferBytes(const Buffer& buffer) {
+		return std::visit(visitor {
+			[](auto&) -> span<const std::byte> {
+				return {};
+			},
+			[](const sources::Array& array) -> span<const std::byte> {
+				return span(array.bytes.data(), array.bytes.size());
+			},
+			[](const sources::Vector& vector) -> span<const std::byte> {
+				return span(vector.bytes.data(), vector.bytes.size());
+			},
+			[](const sources::ByteView& byteView) -> span<const std::byte> {
+				return byteView.bytes;
+			},
+		}, buffer.data);
+	}
+
+	/** The raw bytes of a vertex attribute, as used for welding the vertices of a primitive. */
+	struct WeldAttribute {
+		const std::byte* data;
+		std::size_t byteStride;
+		std::size_t elementSize;
+	};
+
+	/**
+	 * Resolves the bytes of an attribute accessor. Returns false if they are not directly available, for example
+	 * because the accessor is sparse or the buffer has not been loaded.
+	 */
+	static bool getWeldAttribute(const Asset& asset, std::size_t accessorIndex, std::size_t vertexCount, WeldAttribute& attribute) {
+		if (accessorIndex >= asset.accessors.size())
+			return false;
+		const auto& accessor = asset.accessors[accessorIndex];
+		if (accessor.count != vertexCount || accessor.sparse || !accessor.bufferViewIndex || *accessor.bufferViewIndex >= asset.bufferViews.size())
+			return false;
+		const auto& bufferView = asset.bufferViews[*accessor.bufferViewIndex];
+		if (bufferView.bufferIndex >= asset.buffers.size())
+			return false;
+
+		auto bytes = getLoadedBufferBytes(asset.buffers[bufferView.bufferIndex]);
+		attribute.elementSize = getElementByteSize(accessor.type, accessor.componentType);
+		attribute.byteStride = bufferView.byteStride.value_or(attribute.elementSize);
+		const auto offset = bufferView.byteOffset + accessor.byteOffset;
+		if (bytes.data() == nullptr || offset + attribute.byteStride * (vertexCount - 1) + attribute.elementSize > bytes.size())
+			return false;
+		attribute.data = bytes.data() + offset;
+		return true;
+	}
+
+	/**
+	 * Welds vertices which are identical across all given attributes using a hash table over their bytes.
+	 * remap receives the new index of every vertex, and uniqueVertices the original vertex for every new index.
+	 */
+	static void weldVertices(span<const WeldAttribute> attributes, std::size_t vertexCount,
+	                         std::vector<std::uint32_t>& remap, std::vector<std::uint32_t>& uniqueVertices) {
+		// Gather the attributes of each vertex into one contiguous key, so that they can be hashed and compared at once.
+		std::size_t vertexSize = 0;
+		for (std::size_t i = 0; i < attributes.size(); ++i)
+			vertexSize += attributes[i].elementSize;
+		std::vector<std::byte> keys(vertexSize * vertexCount);
+		for (std::size_t vertex = 0; vertex < vertexCount; ++vertex) {
+			auto* key = keys.data() + vertex * vertexSize;
+			for (std::size_t i = 0; i < attributes.size(); ++i) {
+				std::memcpy(key, attributes[i].data + vertex * attributes[i].byteStride, attributes[i].elementSize);
+				key += attributes[i].elementSize;
+			}
+		}
+
+		// Open addressing with linear probing, where every slot holds the first vertex with a given key.
+		static constexpr auto emptySlot = std::numeric_limits<std::uint32_t>::max();
+		std::size_t capacity = 1;
+		while (capacity < vertexCount * 2)
+			capacity <<= 1;
+		std::vector<std::uint32_t> table(capacity, emptySlot);
+
+		remap.resize(vertexCount);
+		uniqueVertices.clear();
+		for (std::size_t vertex = 0; vertex < vertexCount; ++vertex) {
+			const auto* key = keys.data() + vertex * vertexSize;
+			auto slot = crcStringFunction(std::string_view(reinterpret_cast<const char*>(key), vertexSize)) & (capacity - 1);
+			while (true) {
+				const auto entry = table[slot];
+				if (entry == emptySlot) {
+					table[slot] = static_cast<std::uint32_t>(vertex);
+					remap[vertex] = static_cast<std::uint32_t>(uniqueVertices.size());
+					uniqueVertices.emplace_back(static_cast<std::uint32_t>(vertex));
+					break;
 				}
-				break;
-			}
-			case PrimitiveType::Triangles:
-			case PrimitiveType::TriangleStrip:
-			case PrimitiveType::TriangleFan: {
-				for (std::size_t i = 0; i < primitiveCount; ++i) {
-					indices[i * 3 + 0] = static_cast<T>(i * 3 + 0);
-					indices[i * 3 + 1] = static_cast<T>(i * 3 + 1);
-					indices[i * 3 + 2] = static_cast<T>(i * 3 + 2);
+				if (std::memcmp(keys.data() + entry * vertexSize, key, vertexSize) == 0) {
+					remap[vertex] = remap[entry];
+					break;
 				}
-				break;
+				slot = (slot + 1) & (capacity - 1);
 			}
-			default: FASTGLTF_UNREACHABLE
 		}
 	}
 
-	std::pair<StaticVector<std::byte>, ComponentType> writeIndices(PrimitiveType type, std::size_t indexCount, std::size_t primitiveCount) {
-		if (indexCount < 255) {
-			StaticVector<std::byte> generatedIndices(indexCount * sizeof(std::uint8_t));
-			span<std::uint8_t> indices(reinterpret_cast<std::uint8_t*>(generatedIndices.data()), generatedIndices.size() / sizeof(std::uint8_t));
-			writeIndices(type, indices, primitiveCount);
-			return std::make_pair(generatedIndices, ComponentType::UnsignedByte);
-		} else if (indexCount < 65535) {
-			StaticVector<std::byte> generatedIndices(indexCount * sizeof(std::uint16_t));
-			span<std::uint16_t> indices(reinterpret_cast<std::uint16_t*>(generatedIndices.data()), generatedIndices.size() / sizeof(std::uint16_t));
-			writeIndices(type, indices, primitiveCount);
-			return std::make_pair(generatedIndices, ComponentType::UnsignedShort);
+	static ComponentType getGeneratedIndexType(std::size_t vertexCount) {
+		if (vertexCount < 255) {
+			return ComponentType::UnsignedByte;
+		} else if (vertexCount < 65535) {
+			return ComponentType::UnsignedShort;
 		} else {
-			StaticVector<std::byte> generatedIndices(indexCount * sizeof(std::uint32_t));
-			span<std::uint32_t> indices(reinterpret_cast<std::uint32_t*>(generatedIndices.data()), generatedIndices.size() / sizeof(std::uint32_t));
-			writeIndices(type, indices, primitiveCount);
-			return std::make_pair(generatedIndices, ComponentType::UnsignedInt);
+			return ComponentType::UnsignedInt;
 		}
 	}
-}
-
-fg::Error fg::Parser::generateMeshIndices(fastgltf::Asset& asset) const {
-	for (auto& mesh : asset.meshes) {
-		for (auto& primitive : mesh.primitives) {
-			if (primitive.indicesAccessor.has_value())
-				continue;
 
-			auto* positionAttribute = primitive.findAttribute("POSITION");
-			if (positionAttribute == primitive.attributes.end()) {
-				return Error::InvalidGltf;
-			}
-			auto positionCount = asset.accessors[positionAttribute->accessorIndex].count;
-
-			auto primitiveCount = [&]() -> std::size_t {
-				switch (primitive.type) {
-					case PrimitiveType::Points: return positionCount;
-					case PrimitiveType::Lines: return positionCount / 2;
-					case PrimitiveType::LineLoop:
-					case PrimitiveType::LineStrip: return max<std::size_t>(0, positionCount - 1);
-					case PrimitiveType::Triangles: return positionCount / 3;
-					case PrimitiveType::TriangleStrip: return max<std::size_t>(0U, positionCount - 2);
-					case PrimitiveType::TriangleFan: return max<std::size_t>(0U, positionCount - 2);
-					default: FASTGLTF_UNREACHABLE
-				}
-			}();
-			auto indexCount = [&]() -> std::size_t {
-				switch (primitive.type) {
-					case PrimitiveType::Points: return primitiveCount;
-					case PrimitiveType::Lines:
-					case PrimitiveType::LineLoop:
-					case PrimitiveType::LineStrip: return primitiveCount * 2;
-					case PrimitiveType::Triangles:
-					case PrimitiveType::TriangleStrip:
-					case PrimitiveType::TriangleFan: return primitiveCount * 3;
-					default: FASTGLTF_UNREACHABLE
-				}
-			}();
-
-			auto [generatedIndices, componentType] = writeIndices(primitive.type, indexCount, primitiveCount);
-
-			auto bufferIdx = asset.buffers.size();
-			auto& buffer = asset.buffers.emplace_back();
-			buffer.byteLength = generatedIndices.size_bytes();
-			sources::Array indicesArray {
-				std::move(generatedIndices),
-				MimeType::GltfBuffer,
-			};
-			buffer.data = std::move(indicesArray);
-
-			auto bufferViewIdx = asset.bufferViews.size();
-			auto& bufferView = asset.bufferViews.emplace_back();
-			bufferView.byteLength = buffer.byteLength;
-			bufferView.bufferIndex = bufferIdx;
-			bufferView.byteOffset = 0;
-
-			primitive.indicesAccessor = asset.accessors.size();
-			auto& accessor = asset.accessors.emplace_back();
-			accessor.byteOffset = 0;
-			accessor.count = positionCount;
-			accessor.type = AccessorType::Scalar;
-			accessor.componentType = componentType;
-			accessor.normalized = false;
-			accessor.bufferViewIndex = bufferViewIdx;
+	template <typename T>
+	static void writeGeneratedIndices(std::byte* destination, std::size_t indexCount, const std::vector<std::uint32_t>& remap) {
+		auto* indices = reinterpret_cast<T*>(destination);
+		if (remap.empty()) {
+			for (std::size_t i = 0; i < indexCount; ++i)
+				indices[i] = static_cast<T>(i);
+		} else {
+			for (std::size_t i = 0; i < indexCount; ++i)
+				indices[i] = static_cast<T>(remap[i]);
 		}
 	}
-	return Error::None;
-}
+} // namespace fastgltf
 
-fg::Error fg::validate(const fastgltf::Asset& asset) {
-	auto isExtensionUsed = [&used = asset.extensionsUsed](std::string_view extension) {
-		for (const auto& extensionUsed : used) {
-			if (extension == extensionUsed) {
-				return true;
-			}
-		}
-		return false;
+#if FASTGLTF_ENABLE_MESHOPT
+namespace fastgltf {
+	struct MeshoptDecodeTask {
+		const CompressedBufferView* compression;
+		const std::byte* source;
+		std::byte* destination;
+		int result;
 	};
 
-	// From the spec: extensionsRequired is a subset of extensionsUsed. All values in extensionsRequired MUST also exist in extensionsUsed.
-	if (asset.extensionsRequired.size() > asset.extensionsUsed.size()) {
-		return Error::InvalidGltf;
-	}
-	for (const auto& required : asset.extensionsRequired) {
-		bool found = false;
-		for (const auto& used : asset.extensionsUsed) {
-			if (required == used)
-				found = true;
+	static int decodeMeshoptBufferView(const MeshoptDecodeTask& task) {
+		const auto& compression = *task.compression;
+		const auto* source = reinterpret_cast<const unsigned char*>(task.source + compression.byteOffset);
+
+		int result = -1;
+		switch (compression.mode) {
+			case MeshoptCompressionMode::Attributes:
+				result = meshopt_decodeVertexBuffer(task.destination, compression.count, compression.byteStride, source, compression.byteLength);
+				break;
+			case MeshoptCompressionMode::Triangles:
+				result = meshopt_decodeIndexBuffer(task.destination, compression.count, compression.byteStride, source, compression.byteLength);
+				break;
+			case MeshoptCompressionMode::Indices:
+				result = meshopt_decodeIndexSequence(task.destination, compression.count, compression.byteStride, source, compression.byteLength);
+				break;
 		}
-		if (!found)
-			return Error::InvalidGltf;
+		if (result != 0)
+			return result;
+
+		switch (compression.filter) {
+			case MeshoptCompressionFilter::None:
+				break;
+			case MeshoptCompressionFilter::Octahedral:
+				meshopt_decodeFilterOct(task.destination, compression.count, compression.byteStride);
+				break;
+			case MeshoptCompressionFilter::Quaternion:
+				meshopt_decodeFilterQuat(task.destination, compression.count, compression.byteStride);
+				break;
+			case MeshoptCompressionFilter::Exponential:
+				meshopt_decodeFilterExp(task.destination, compression.count, compression.byteStride);
+				break;
+		}
+		return 0;
+	}
+} // namespace fastgltf
+#endif
+
+fg::Error fg::Parser::decompressMeshoptBufferViews(Asset& asset) const {
+	std::vector<std::size_t> compressedViews;
+	for (std::size_t i = 0; i < asset.bufferViews.size(); ++i) {
+		if (asset.bufferViews[i].meshoptCompression)
+			compressedViews.emplace_back(i);
 	}
 
-	for (const auto& accessor : asset.accessors) {
-		if (accessor.type == AccessorType::Invalid)
-			return Error::InvalidGltf;
-		if (accessor.componentType == ComponentType::Invalid)
-			return Error::InvalidGltf;
-		if (accessor.count < 1)
+	if (compressedViews.empty())
+		return Error::None;
+
+#if !FASTGLTF_ENABLE_MESHOPT
+	return Error::DecompressionFailed;
+#else
+	// All buffer views are decoded into a single new buffer, with each one aligned to 16 bytes.
+	std::vector<std::size_t> offsets;
+	offsets.reserve(compressedViews.size());
+	std::size_t decodedSize = 0;
+	for (auto viewIndex : compressedViews) {
+		const auto& compression = *asset.bufferViews[viewIndex].meshoptCompression;
+		offsets.emplace_back(decodedSize);
+		decodedSize += alignUp(compression.count * compression.byteStride, 16);
+	}
+
+	StaticVector<std::byte> decoded(decodedSize);
+	std::vector<MeshoptDecodeTask> tasks;
+	tasks.reserve(compressedViews.size());
+	for (std::size_t i = 0; i < compressedViews.size(); ++i) {
+		const auto& compression = *asset.bufferViews[compressedViews[i]].meshoptCompression;
+		if (compression.bufferIndex >= asset.buffers.size())
 			return Error::InvalidGltf;
-		if (accessor.bufferViewIndex.has_value() &&
-		    accessor.bufferViewIndex.value() >= asset.bufferViews.size())
+
+		// Buffers filled through the map callback only have a custom ID, and their memory might not be readable anymore.
+		const auto& buffer = asset.buffers[compression.bufferIndex];
+		if (std::holds_alternative<sources::CustomBuffer>(buffer.data))
+			return Error::UnreadableMappedBuffer;
+		auto source = getLoadedBufferBytes(buffer);
+		if (source.data() == nullptr)
+			return Error::MissingExternalBuffer;
+		if (compression.byteOffset + compression.byteLength > source.size())
 			return Error::InvalidGltf;
-		if (accessor.byteOffset != 0) {
-			// The offset of an accessor into a bufferView (i.e., accessor.byteOffset)
-			// and the offset of an accessor into a buffer (i.e., accessor.byteOffset + bufferView.byteOffset)
-			// MUST be a multiple of the size of the accessor’s component type.
-			auto componentByteSize = getComponentByteSize(accessor.componentType);
-			if (accessor.byteOffset % componentByteSize != 0)
-				return Error::InvalidGltf;
 
-			if (accessor.bufferViewIndex.has_value()) {
-				const auto& bufferView = asset.bufferViews[accessor.bufferViewIndex.value()];
+		tasks.emplace_back(MeshoptDecodeTask { &compression, source.data(), decoded.data() + offsets[i], 0 });
+	}
+
+	executeTasks(tasks.size(), [](std::size_t taskIndex, void* taskData) {
+		auto& task = (*static_cast<std::vector<MeshoptDecodeTask>*>(taskData))[taskIndex];
+		task.result = decodeMeshoptBufferView(task);
+	}, &tasks);
+
+	for (const auto& task : tasks) {
+		if (task.result != 0)
+			return Error::DecompressionFailed;
+	}
+
+	// The buffer views now point into the decoded data and are no longer compressed.
+	auto bufferIndex = asset.buffers.size();
+	auto& buffer = asset.buffers.emplace_back();
+	buffer.byteLength = decoded.size_bytes();
+	buffer.data = sources::Array { std::move(decoded), MimeType::GltfBuffer };
+
+	for (std::size_t i = 0; i < compressedViews.size(); ++i) {
+		auto& bufferView = asset.bufferViews[compressedViews[i]];
+		bufferView.bufferIndex = bufferIndex;
+		bufferView.byteOffset = offsets[i];
+		bufferView.meshoptCompression.reset();
+	}
+	return Error::None;
+#endif
+}
+
+fg::Error fg::Parser::decodeDracoPrimitives(Asset& asset) const {
+	struct DracoDecodeTask {
+		DracoDecodeInfo info;
+		std::size_t firstTarget;
+		std::size_t targetCount;
+		bool hasIndices;
+		bool result;
+	};
+
+	// Every decoded attribute gets its own range in a single new buffer, aligned to 16 bytes.
+	// The targets are only given their spans once the buffer has been allocated.
+	std::vector<DracoDecodeTask> tasks;
+	std::vector<DracoDecodeTarget> targets;
+	std::vector<std::size_t> targetAccessors;
+	std::vector<std::size_t> offsets;
+	std::size_t decodedSize = 0;
+	auto addTarget = [&](std::string_view name, std::size_t dracoAttributeId, std::size_t accessorIndex) {
+		if (accessorIndex >= asset.accessors.size())
+			return false;
+		const auto& accessor = asset.accessors[accessorIndex];
+		offsets.emplace_back(decodedSize);
+		targets.emplace_back(DracoDecodeTarget { name, dracoAttributeId, &accessor, {} });
+		targetAccessors.emplace_back(accessorIndex);
+		decodedSize += alignUp(getElementByteSize(accessor.type, accessor.componentType) * accessor.count, 16);
+		return true;
+	};
+
+	for (std::size_t meshIndex = 0; meshIndex < asset.meshes.size(); ++meshIndex) {
+		auto& primitives = asset.meshes[meshIndex].primitives;
+		for (std::size_t primitiveIndex = 0; primitiveIndex < primitives.size(); ++primitiveIndex) {
+			auto& primitive = primitives[primitiveIndex];
+			if (!primitive.dracoCompression)
+				continue;
+
+			const auto& draco = *primitive.dracoCompression;
+			if (draco.bufferView >= asset.bufferViews.size())
+				return Error::InvalidGltf;
+			const auto& bufferView = asset.bufferViews[draco.bufferView];
+			if (bufferView.bufferIndex >= asset.buffers.size())
+				return Error::InvalidGltf;
+
+			const auto& buffer = asset.buffers[bufferView.bufferIndex];
+			if (std::holds_alternative<sources::CustomBuffer>(buffer.data))
+				return Error::UnreadableMappedBuffer;
+			auto source = getLoadedBufferBytes(buffer);
+			if (source.data() == nullptr)
+				return Error::MissingExternalBuffer;
+			if (bufferView.byteOffset + bufferView.byteLength > source.size())
+				return Error::InvalidGltf;
+
+			auto& task = tasks.emplace_back();
+			task.info.meshIndex = meshIndex;
+			task.info.primitiveIndex = primitiveIndex;
+			task.info.compressedData = span(source.data() + bufferView.byteOffset, bufferView.byteLength);
+			task.firstTarget = targets.size();
+			task.hasIndices = primitive.indicesAccessor.has_value();
+			if (task.hasIndices && !addTarget({}, 0, *primitive.indicesAccessor))
+				return Error::InvalidGltf;
+
+			// The extension's attribute map uses the same names as the primitive's attributes,
+			// but maps them to the IDs within the Draco data instead of accessors.
+			for (const auto& attribute : draco.attributes) {
+				auto* primitiveAttribute = primitive.findAttribute(attribute.name);
+				if (primitiveAttribute == primitive.attributes.end())
+					return Error::InvalidGltf;
+				if (!addTarget(attribute.name, attribute.accessorIndex, primitiveAttribute->accessorIndex))
+					return Error::InvalidGltf;
+			}
+			task.targetCount = targets.size() - task.firstTarget;
+		}
+	}
+
+	if (tasks.empty())
+		return Error::None;
+
+	StaticVector<std::byte> decoded(decodedSize);
+	for (std::size_t i = 0; i < targets.size(); ++i) {
+		const auto& accessor = *targets[i].accessor;
+		targets[i].data = span<std::byte>(decoded.data() + offsets[i], getElementByteSize(accessor.type, accessor.componentType) * accessor.count);
+	}
+	for (auto& task : tasks) {
+		auto attributeOffset = task.hasIndices ? 1U : 0U;
+		task.info.indices = task.hasIndices ? &targets[task.firstTarget] : nullptr;
+		task.info.attributes = span<const DracoDecodeTarget>(targets.data() + task.firstTarget + attributeOffset, task.targetCount - attributeOffset);
+	}
+
+	struct DracoTaskData {
+		std::vector<DracoDecodeTask>* tasks;
+		DracoDecodeCallback* callback;
+		void* userPointer;
+	} taskData { &tasks, config.dracoCallback, config.userPointer };
+	executeTasks(tasks.size(), [](std::size_t taskIndex, void* data) {
+		auto* taskData = static_cast<DracoTaskData*>(data);
+		auto& task = (*taskData->tasks)[taskIndex];
+		task.result = taskData->callback(task.info, taskData->userPointer);
+	}, &taskData);
+
+	for (const auto& task : tasks) {
+		if (!task.result)
+			return Error::DecompressionFailed;
+	}
+
+	// Each decoded attribute gets a new buffer view, which the accessors are changed to point into.
+	auto bufferIndex = asset.buffers.size();
+	auto& buffer = asset.buffers.emplace_back();
+	buffer.byteLength = decoded.size_bytes();
+	buffer.data = sources::Array { std::move(decoded), MimeType::GltfBuffer };
+
+	for (std::size_t i = 0; i < targets.size(); ++i) {
+		auto bufferViewIndex = asset.bufferViews.size();
+		auto& bufferView = asset.bufferViews.emplace_back();
+		bufferView.bufferIndex = bufferIndex;
+		bufferView.byteOffset = offsets[i];
+		bufferView.byteLength = targets[i].data.size_bytes();
+
+		auto& accessor = asset.accessors[targetAccessors[i]];
+		accessor.bufferViewIndex = bufferViewIndex;
+		accessor.byteOffset = 0;
+	}
+
+	for (auto& mesh : asset.meshes) {
+		for (auto& primitive : mesh.primitives) {
+			primitive.dracoCompression.reset();
+		}
+	}
+	return Error::None;
+}
+
+fg::Error fg::Parser::generateMeshIndices(fastgltf::Asset& asset) const {
+	struct GeneratedPrimitive {
+		Primitive* primitive;
+		std::size_t vertexCount;
+		ComponentType indexType;
+		std::size_t indicesOffset;
+
+		// These are only filled when the vertices of the primitive have been welded.
+		std::vector<std::uint32_t> remap;
+		std::vector<std::uint32_t> uniqueVertices;
+		std::vector<WeldAttribute> attributes;
+		std::vector<std::size_t> attributeOffsets;
+	};
+
+	// The indices, and the welded attributes, of all primitives are placed in a single buffer, with each
+	// range aligned to 4 bytes. The vertex attributes also use a stride aligned to 4 bytes, as required by the spec.
+	std::vector<GeneratedPrimitive> generated;
+	std::size_t generatedSize = 0;
+	for (auto& mesh : asset.meshes) {
+		for (auto& primitive : mesh.primitives) {
+			if (primitive.indicesAccessor.has_value())
+				continue;
+
+			auto* positionAttribute = primitive.findAttribute("POSITION");
+			if (positionAttribute == primitive.attributes.end()) {
+				return Error::InvalidGltf;
+			}
+
+			auto& current = generated.emplace_back();
+			current.primitive = &primitive;
+			current.vertexCount = asset.accessors[positionAttribute->accessorIndex].count;
+
+			if (hasBit(options, Options::WeldVertices) && current.vertexCount > 0) {
+				bool available = true;
+				auto addAttributes = [&](const auto& attributes) {
+					for (const auto& attribute : attributes) {
+						auto& weldAttribute = current.attributes.emplace_back();
+						available = available && getWeldAttribute(asset, attribute.accessorIndex, current.vertexCount, weldAttribute);
+					}
+				};
+				addAttributes(primitive.attributes);
+				for (const auto& target : primitive.targets) {
+					addAttributes(target);
+				}
+
+				if (available) {
+					weldVertices(span<const WeldAttribute>(current.attributes.data(), current.attributes.size()),
+					             current.vertexCount, current.remap, current.uniqueVertices);
+				}
+
+				// Keep the original attributes, if nothing could be welded.
+				if (!available || current.uniqueVertices.size() == current.vertexCount) {
+					current.remap.clear();
+					current.uniqueVertices.clear();
+					current.attributes.clear();
+				}
+			}
+
+			current.indexType = getGeneratedIndexType(current.remap.empty() ? current.vertexCount : current.uniqueVertices.size());
+			current.indicesOffset = generatedSize = alignUp(generatedSize, 4);
+			generatedSize += current.vertexCount * getComponentByteSize(current.indexType);
+			for (const auto& attribute : current.attributes) {
+				current.attributeOffsets.emplace_back(generatedSize = alignUp(generatedSize, 4));
+				generatedSize += alignUp(attribute.elementSize, 4) * current.uniqueVertices.size();
+			}
+		}
+	}
+
+	if (generated.empty())
+		return Error::None;
+
+	// All data is written before the new buffer is added, as the welded attributes are read from the existing buffers.
+	StaticVector<std::byte> generatedData(generatedSize);
+	for (const auto& current : generated) {
+		auto* indices = generatedData.data() + current.indicesOffset;
+		switch (current.indexType) {
+			case ComponentType::UnsignedByte: writeGeneratedIndices<std::uint8_t>(indices, current.vertexCount, current.remap); break;
+			case ComponentType::UnsignedShort: writeGeneratedIndices<std::uint16_t>(indices, current.vertexCount, current.remap); break;
+			case ComponentType::UnsignedInt: writeGeneratedIndices<std::uint32_t>(indices, current.vertexCount, current.remap); break;
+			default: FASTGLTF_UNREACHABLE
+		}
+
+		for (std::size_t i = 0; i < current.attributes.size(); ++i) {
+			const auto& attribute = current.attributes[i];
+			const auto stride = alignUp(attribute.elementSize, 4);
+			auto* destination = generatedData.data() + current.attributeOffsets[i];
+			if (stride != attribute.elementSize)
+				std::memset(destination, 0, stride * current.uniqueVertices.size());
+			for (auto vertex : current.uniqueVertices) {
+				std::memcpy(destination, attribute.data + vertex * attribute.byteStride, attribute.elementSize);
+				destination += stride;
+			}
+		}
+	}
+
+	auto bufferIdx = asset.buffers.size();
+	auto& buffer = asset.buffers.emplace_back();
+	buffer.byteLength = generatedData.size_bytes();
+	sources::Array generatedArray {
+		std::move(generatedData),
+		MimeType::GltfBuffer,
+	};
+	buffer.data = std::move(generatedArray);
+
+	for (auto& current : generated) {
+		auto& primitive = *current.primitive;
+
+		auto bufferViewIdx = asset.bufferViews.size();
+		auto& bufferView = asset.bufferViews.emplace_back();
+		bufferView.byteLength = current.vertexCount * getComponentByteSize(current.indexType);
+		bufferView.bufferIndex = bufferIdx;
+		bufferView.byteOffset = current.indicesOffset;
+
+		primitive.indicesAccessor = asset.accessors.size();
+		auto& accessor = asset.accessors.emplace_back();
+		accessor.byteOffset = 0;
+		accessor.count = current.vertexCount;
+		accessor.type = AccessorType::Scalar;
+		accessor.componentType = current.indexType;
+		accessor.normalized = false;
+		accessor.bufferViewIndex = bufferViewIdx;
+
+		if (current.attributes.empty())
+			continue;
+
+		// Every welded attribute gets its own accessor, since the original accessors might be used elsewhere.
+		std::size_t attributeIdx = 0;
+		auto replaceAttributes = [&](auto& attributes) {
+			for (auto& attribute : attributes) {
+				const auto stride = alignUp(current.attributes[attributeIdx].elementSize, 4);
+				auto attributeViewIdx = asset.bufferViews.size();
+				auto& attributeView = asset.bufferViews.emplace_back();
+				attributeView.byteLength = stride * current.uniqueVertices.size();
+				attributeView.byteStride = stride;
+				attributeView.bufferIndex = bufferIdx;
+				attributeView.byteOffset = current.attributeOffsets[attributeIdx];
+
+				Accessor weldedAccessor = asset.accessors[attribute.accessorIndex];
+				weldedAccessor.byteOffset = 0;
+				weldedAccessor.count = current.uniqueVertices.size();
+				weldedAccessor.bufferViewIndex = attributeViewIdx;
+				attribute.accessorIndex = asset.accessors.size();
+				asset.accessors.emplace_back(std::move(weldedAccessor));
+				++attributeIdx;
+			}
+		};
+		replaceAttributes(primitive.attributes);
+		for (auto& target : primitive.targets) {
+			replaceAttributes(target);
+		}
+	}
+	return Error::None;
+}
+
+namespace fastgltf {
+	static bool isExtensionUsed(const Asset& asset, std::string_view extension) {
+		for (const auto& extensionUsed : asset.extensionsUsed) {
+			if (extension == extensionUsed) {
+				return true;
+			}
+		}
+		return false;
+	}
+
+	static Error validateAccessor(const Asset& asset, const Accessor& accessor) {
+		if (accessor.type == AccessorType::Invalid)
+			return Error::InvalidGltf;
+		if (accessor.componentType == ComponentType::Invalid)
+			return Error::InvalidGltf;
+		if (accessor.count < 1)
+			return Error::InvalidGltf;
+		if (accessor.bufferViewIndex.has_value() &&
+		    accessor.bufferViewIndex.value() >= asset.bufferViews.size())
+			return Error::InvalidGltf;
+		if (accessor.byteOffset != 0) {
+			// The offset of an accessor into a bufferView (i.e., accessor.byteOffset)
+			// and the offset of an accessor into a buffer (i.e., accessor.byteOffset + bufferView.byteOffset)
+			// MUST be a multiple of the size of the accessor’s component type.
+			auto componentByteSize = getComponentByteSize(accessor.componentType);
+			if (accessor.byteOffset % componentByteSize != 0)
+				return Error::InvalidGltf;
+
+			if (accessor.bufferViewIndex.has_value()) {
+				const auto& bufferView = asset.bufferViews[accessor.bufferViewIndex.value()];
 				if ((accessor.byteOffset + bufferView.byteOffset) % componentByteSize != 0)
 					return Error::InvalidGltf;
 
@@ -1029,9 +1864,10 @@ fg::Error fg::validate(const fastgltf::Asset& asset) {
 			if (valueView.byteStride || valueView.target)
 				return Error::InvalidGltf;
 		}
+		return Error::None;
 	}
 
-	for (const auto& animation : asset.animations) {
+	static Error validateAnimation(const Asset& asset, const Animation& animation) {
 		if (animation.channels.empty())
 			return Error::InvalidGltf;
 		for (const auto& channel1 : animation.channels) {
@@ -1081,14 +1917,16 @@ fg::Error fg::validate(const fastgltf::Asset& asset) {
 					break;
 			}
 		}
+		return Error::None;
 	}
 
-	for (const auto& buffer : asset.buffers) {
+	static Error validateBuffer(const Asset& asset, const Buffer& buffer) {
 		if (buffer.byteLength < 1)
 			return Error::InvalidGltf;
+		return Error::None;
 	}
 
-	for (const auto& bufferView : asset.bufferViews) {
+	static Error validateBufferView(const Asset& asset, const BufferView& bufferView) {
 		if (bufferView.byteLength < 1)
 			return Error::InvalidGltf;
 		if (bufferView.byteStride.has_value() && (*bufferView.byteStride < 4U || *bufferView.byteStride > 252U || *bufferView.byteStride % 4 != 0))
@@ -1096,7 +1934,7 @@ fg::Error fg::validate(const fastgltf::Asset& asset) {
 		if (bufferView.bufferIndex >= asset.buffers.size())
 			return Error::InvalidGltf;
 
-		if (bufferView.meshoptCompression != nullptr && !isExtensionUsed(extensions::EXT_meshopt_compression))
+		if (bufferView.meshoptCompression != nullptr && !isExtensionUsed(asset, extensions::EXT_meshopt_compression))
 			return Error::InvalidGltf;
 
 		if (bufferView.meshoptCompression) {
@@ -1116,9 +1954,10 @@ fg::Error fg::validate(const fastgltf::Asset& asset) {
 					break;
 			}
 		}
+		return Error::None;
 	}
 
-	for (const auto& camera : asset.cameras) {
+	static Error validateCamera(const Asset& asset, const Camera& camera) {
 		if (const auto* pOrthographic = std::get_if<Camera::Orthographic>(&camera.camera)) {
 			if (pOrthographic->zfar == 0)
 				return Error::InvalidGltf;
@@ -1132,17 +1971,19 @@ fg::Error fg::validate(const fastgltf::Asset& asset) {
 			if (pPerspective->znear == 0.0F)
 				return Error::InvalidGltf;
 		}
+		return Error::None;
 	}
 
-	for (const auto& image : asset.images) {
+	static Error validateImage(const Asset& asset, const Image& image) {
 		if (const auto* view = std::get_if<sources::BufferView>(&image.data); view != nullptr) {
 			if (view->bufferViewIndex >= asset.bufferViews.size()) {
 				return Error::InvalidGltf;
 			}
 		}
+		return Error::None;
 	}
 
-	for (const auto& light : asset.lights) {
+	static Error validateLight(const Asset& asset, const Light& light) {
 		if (light.type == LightType::Directional && light.range.has_value())
 			return Error::InvalidGltf;
 		if (light.range.has_value() && light.range.value() <= 0)
@@ -1162,9 +2003,10 @@ fg::Error fg::validate(const fastgltf::Asset& asset) {
 			if (light.outerConeAngle.value() > math::pi / 2)
 				return Error::InvalidGltf;
 		}
+		return Error::None;
 	}
 
-	for (const auto& material : asset.materials) {
+	static Error validateMaterial(const Asset& asset, const Material& material) {
 		auto isInvalidTexture = [&textures = asset.textures](std::optional<std::size_t> textureIndex) {
 			return textureIndex.has_value() && textureIndex.value() >= textures.size();
 		};
@@ -1182,41 +2024,42 @@ fg::Error fg::validate(const fastgltf::Asset& asset) {
 			return Error::InvalidGltf;
 
 		// Validate that for every additional material field from an extension the correct extension is marked as used by the asset.
-		if (material.anisotropy && !isExtensionUsed(extensions::KHR_materials_anisotropy))
+		if (material.anisotropy && !isExtensionUsed(asset, extensions::KHR_materials_anisotropy))
 			return Error::InvalidGltf;
-		if (material.clearcoat && !isExtensionUsed(extensions::KHR_materials_clearcoat))
+		if (material.clearcoat && !isExtensionUsed(asset, extensions::KHR_materials_clearcoat))
 			return Error::InvalidGltf;
-		if (material.iridescence && !isExtensionUsed(extensions::KHR_materials_iridescence))
+		if (material.iridescence && !isExtensionUsed(asset, extensions::KHR_materials_iridescence))
 			return Error::InvalidGltf;
-		if (material.sheen && !isExtensionUsed(extensions::KHR_materials_sheen))
+		if (material.sheen && !isExtensionUsed(asset, extensions::KHR_materials_sheen))
 			return Error::InvalidGltf;
-		if (material.specular && !isExtensionUsed(extensions::KHR_materials_specular))
+		if (material.specular && !isExtensionUsed(asset, extensions::KHR_materials_specular))
 			return Error::InvalidGltf;
 #if FASTGLTF_ENABLE_DEPRECATED_EXT
-		if (material.specularGlossiness && !isExtensionUsed(extensions::KHR_materials_pbrSpecularGlossiness))
+		if (material.specularGlossiness && !isExtensionUsed(asset, extensions::KHR_materials_pbrSpecularGlossiness))
 			return Error::InvalidGltf;
 #endif
-		if (material.transmission && !isExtensionUsed(extensions::KHR_materials_transmission))
+		if (material.transmission && !isExtensionUsed(asset, extensions::KHR_materials_transmission))
 			return Error::InvalidGltf;
-		if (material.volume && !isExtensionUsed(extensions::KHR_materials_volume))
+		if (material.volume && !isExtensionUsed(asset, extensions::KHR_materials_volume))
 			return Error::InvalidGltf;
-		if (material.emissiveStrength != 1.0f && !isExtensionUsed(extensions::KHR_materials_emissive_strength))
+		if (material.emissiveStrength != 1.0f && !isExtensionUsed(asset, extensions::KHR_materials_emissive_strength))
 			return Error::InvalidGltf;
-		if (material.ior != 1.5f && !isExtensionUsed(extensions::KHR_materials_ior))
+		if (material.ior != 1.5f && !isExtensionUsed(asset, extensions::KHR_materials_ior))
 			return Error::InvalidGltf;
-		if (material.packedNormalMetallicRoughnessTexture && !isExtensionUsed(extensions::MSFT_packing_normalRoughnessMetallic))
+		if (material.packedNormalMetallicRoughnessTexture && !isExtensionUsed(asset, extensions::MSFT_packing_normalRoughnessMetallic))
 			return Error::InvalidGltf;
-		if (material.packedOcclusionRoughnessMetallicTextures && !isExtensionUsed(extensions::MSFT_packing_occlusionRoughnessMetallic))
+		if (material.packedOcclusionRoughnessMetallicTextures && !isExtensionUsed(asset, extensions::MSFT_packing_occlusionRoughnessMetallic))
 			return Error::InvalidGltf;
+		return Error::None;
 	}
 
-	for (const auto& mesh : asset.meshes) {
+	static Error validateMesh(const Asset& asset, const Mesh& mesh) {
 		for (const auto& primitive : mesh.primitives) {
 			if (primitive.materialIndex.has_value() && *primitive.materialIndex >= asset.materials.size())
 				return Error::InvalidGltf;
 
 			if (!primitive.mappings.empty()) {
-				if (!isExtensionUsed(fastgltf::extensions::KHR_materials_variants))
+				if (!isExtensionUsed(asset, fastgltf::extensions::KHR_materials_variants))
 					return Error::InvalidGltf;
 				if (primitive.mappings.size() != asset.materialVariants.size())
 					return Error::InvalidGltf;
@@ -1262,7 +2105,7 @@ fg::Error fg::validate(const fastgltf::Asset& asset) {
 						return Error::InvalidGltf;
 					if (accessor.type != AccessorType::Vec3)
 						return Error::InvalidGltf;
-					if (!isExtensionUsed(extensions::KHR_mesh_quantization)) {
+					if (!isExtensionUsed(asset, extensions::KHR_mesh_quantization)) {
 						if (accessor.componentType != ComponentType::Float)
 							return Error::InvalidGltf;
 					} else {
@@ -1272,7 +2115,7 @@ fg::Error fg::validate(const fastgltf::Asset& asset) {
 				} else if (name == "NORMAL") {
 					if (accessor.type != AccessorType::Vec3)
 						return Error::InvalidGltf;
-					if (!isExtensionUsed(extensions::KHR_mesh_quantization)) {
+					if (!isExtensionUsed(asset, extensions::KHR_mesh_quantization)) {
 						if (accessor.componentType != ComponentType::Float)
 							return Error::InvalidGltf;
 					} else {
@@ -1284,7 +2127,7 @@ fg::Error fg::validate(const fastgltf::Asset& asset) {
 				} else if (name == "TANGENT") {
 					if (accessor.type != AccessorType::Vec4)
 						return Error::InvalidGltf;
-					if (!isExtensionUsed(extensions::KHR_mesh_quantization)) {
+					if (!isExtensionUsed(asset, extensions::KHR_mesh_quantization)) {
 						if (accessor.componentType != ComponentType::Float)
 							return Error::InvalidGltf;
 					} else {
@@ -1296,7 +2139,7 @@ fg::Error fg::validate(const fastgltf::Asset& asset) {
 				} else if (startsWith(name, "TEXCOORD_")) {
 					if (accessor.type != AccessorType::Vec2)
 						return Error::InvalidGltf;
-					if (!isExtensionUsed(extensions::KHR_mesh_quantization)) {
+					if (!isExtensionUsed(asset, extensions::KHR_mesh_quantization)) {
 						if (accessor.componentType != ComponentType::Float &&
 						    accessor.componentType != ComponentType::UnsignedByte &&
 						    accessor.componentType != ComponentType::UnsignedShort) {
@@ -1340,9 +2183,10 @@ fg::Error fg::validate(const fastgltf::Asset& asset) {
 				}
 			}
 		}
+		return Error::None;
 	}
 
-	for (const auto& node : asset.nodes) {
+	static Error validateNode(const Asset& asset, const Node& node) {
 		if (node.cameraIndex.has_value() && asset.cameras.size() <= node.cameraIndex.value())
 			return Error::InvalidGltf;
 		if (node.skinIndex.has_value() && asset.skins.size() <= node.skinIndex.value())
@@ -1375,35 +2219,39 @@ fg::Error fg::validate(const fastgltf::Asset& asset) {
 					return Error::InvalidGltf;
 			}
 		}
+		return Error::None;
 	}
 
-	for (const auto& sampler : asset.samplers) {
+	static Error validateSampler(const Asset& asset, const Sampler& sampler) {
 		if (sampler.magFilter.has_value() && (sampler.magFilter != Filter::Nearest && sampler.magFilter != Filter::Linear)) {
 			return Error::InvalidGltf;
 		}
+		return Error::None;
 	}
 
-	for (const auto& scene : asset.scenes) {
+	static Error validateScene(const Asset& asset, const Scene& scene) {
 		for (const auto& node : scene.nodeIndices) {
 			if (node >= asset.nodes.size())
 				return Error::InvalidGltf;
 		}
+		return Error::None;
 	}
 
-	for (const auto& skin : asset.skins) {
+	static Error validateSkin(const Asset& asset, const Skin& skin) {
 		if (skin.joints.empty())
 			return Error::InvalidGltf;
 		if (skin.skeleton.has_value() && skin.skeleton.value() >= asset.nodes.size())
 			return Error::InvalidGltf;
 		if (skin.inverseBindMatrices.has_value() && skin.inverseBindMatrices.value() >= asset.accessors.size())
 			return Error::InvalidGltf;
+		return Error::None;
 	}
 
-	for (const auto& texture : asset.textures) {
+	static Error validateTexture(const Asset& asset, const Texture& texture) {
 		if (texture.samplerIndex.has_value() && texture.samplerIndex.value() >= asset.samplers.size())
 			return Error::InvalidGltf;
 		// imageIndex needs to be defined, unless one of the texture extensions were enabled and define another image index.
-		if (isExtensionUsed(extensions::KHR_texture_basisu) || isExtensionUsed(extensions::MSFT_texture_dds) || isExtensionUsed(extensions::EXT_texture_webp)) {
+		if (isExtensionUsed(asset, extensions::KHR_texture_basisu) || isExtensionUsed(asset, extensions::MSFT_texture_dds) || isExtensionUsed(asset, extensions::EXT_texture_webp)) {
 			if (!texture.imageIndex.has_value() && (!texture.basisuImageIndex.has_value() && !texture.ddsImageIndex.has_value() && !texture.webpImageIndex.has_value())) {
 				return Error::InvalidGltf;
 			}
@@ -1418,26 +2266,325 @@ fg::Error fg::validate(const fastgltf::Asset& asset) {
 			return Error::InvalidGltf;
 		if (texture.webpImageIndex.has_value() && texture.webpImageIndex.value() >= asset.images.size())
 			return Error::InvalidGltf;
+		return Error::None;
 	}
 
-	return Error::None;
+	template <typename Container, typename Function>
+	static Error validateElements(const Asset& asset, const Container& elements, Function validateElement) {
+		for (const auto& element : elements) {
+			if (auto error = validateElement(asset, element); error != Error::None)
+				return error;
+		}
+		return Error::None;
+	}
+
+	/**
+	 * Validates every element of a single category. Category::Asset validates the properties of the asset itself,
+	 * which are the used and required extensions, and the lights of KHR_lights_punctual.
+	 */
+	static Error validateCategory(const Asset& asset, Category category) {
+		switch (category) {
+			case Category::Asset: {
+				// From the spec: extensionsRequired is a subset of extensionsUsed. All values in extensionsRequired MUST also exist in extensionsUsed.
+				if (asset.extensionsRequired.size() > asset.extensionsUsed.size()) {
+					return Error::InvalidGltf;
+				}
+				for (const auto& required : asset.extensionsRequired) {
+					bool found = false;
+					for (const auto& used : asset.extensionsUsed) {
+						if (required == used)
+							found = true;
+					}
+					if (!found)
+						return Error::InvalidGltf;
+				}
+				return validateElements(asset, asset.lights, validateLight);
+			}
+			case Category::Accessors: return validateElements(asset, asset.accessors, validateAccessor);
+			case Category::Animations: return validateElements(asset, asset.animations, validateAnimation);
+			case Category::Buffers: return validateElements(asset, asset.buffers, validateBuffer);
+			case Category::BufferViews: return validateElements(asset, asset.bufferViews, validateBufferView);
+			case Category::Cameras: return validateElements(asset, asset.cameras, validateCamera);
+			case Category::Images: return validateElements(asset, asset.images, validateImage);
+			case Category::Materials: return validateElements(asset, asset.materials, validateMaterial);
+			case Category::Meshes: return validateElements(asset, asset.meshes, validateMesh);
+			case Category::Nodes: return validateElements(asset, asset.nodes, validateNode);
+			case Category::Samplers: return validateElements(asset, asset.samplers, validateSampler);
+			case Category::Scenes: return validateElements(asset, asset.scenes, validateScene);
+			case Category::Skins: return validateElements(asset, asset.skins, validateSkin);
+			case Category::Textures: return validateElements(asset, asset.textures, validateTexture);
+			default: return Error::None;
+		}
+	}
+
+	static constexpr std::array<Category, 14> validationCategories = {
+		Category::Asset, Category::Accessors, Category::Animations, Category::Buffers, Category::BufferViews,
+		Category::Cameras, Category::Images, Category::Materials, Category::Meshes, Category::Nodes,
+		Category::Samplers, Category::Scenes, Category::Skins, Category::Textures,
+	};
+
+	/**
+	 * Gets the categories which are looked into when validating an element of the given category. They need to be
+	 * parsed completely before the category can be validated. Meshes additionally depend on the material variants,
+	 * which are parsed from the top-level extensions, and therefore depend on Category::Asset.
+	 */
+	static constexpr Category getValidationDependencies(Category category) {
+		switch (category) {
+			case Category::Accessors: return Category::BufferViews;
+			case Category::Animations: return Category::Accessors | Category::BufferViews;
+			case Category::BufferViews: return Category::Buffers;
+			case Category::Images: return Category::BufferViews;
+			case Category::Materials: return Category::Textures;
+			case Category::Meshes: return Category::Materials | Category::Accessors | Category::BufferViews | Category::Asset;
+			case Category::Nodes: return Category::Cameras | Category::Skins | Category::Meshes;
+			case Category::Scenes: return Category::Nodes;
+			case Category::Skins: return Category::Nodes | Category::Accessors;
+			case Category::Textures: return Category::Samplers | Category::Images;
+			default: return Category::None;
+		}
+	}
+
+	/**
+	 * Validates the given categories of the asset. When parallel is true, every category is validated as a separate
+	 * task on the executor, or on a small pool of threads if no executor is given. The returned error is always the
+	 * one of the first failing category in the order of validationCategories, so that the result does not depend on
+	 * the scheduling.
+	 */
+	static Error validateCategories(const Asset& asset, Category categories, bool parallel, TaskExecutorCallback* executor, void* userPointer) {
+		if (!parallel) {
+			for (auto category : validationCategories) {
+				if (!hasBit(categories, category))
+					continue;
+				if (auto error = validateCategory(asset, category); error != Error::None)
+					return error;
+			}
+			return Error::None;
+		}
+
+		struct ValidationTaskData {
+			const Asset* asset;
+			Category categories;
+			std::array<Error, validationCategories.size()> errors;
+		} taskData { &asset, categories, {} };
+		executeTasks(validationCategories.size(), [](std::size_t taskIndex, void* data) {
+			auto* taskData = static_cast<ValidationTaskData*>(data);
+			const auto category = validationCategories[taskIndex];
+			taskData->errors[taskIndex] = hasBit(taskData->categories, category)
+				? validateCategory(*taskData->asset, category)
+				: Error::None;
+		}, &taskData, executor, userPointer);
+
+		for (auto error : taskData.errors) {
+			if (error != Error::None)
+				return error;
+		}
+		return Error::None;
+	}
+} // namespace fastgltf
+
+fg::Error fg::validate(const fastgltf::Asset& asset) {
+	return validateCategories(asset, Category::All, false, nullptr, nullptr);
 }
 
-fg::Expected<fg::Asset> fg::Parser::parse(simdjson::dom::object root, Category categories) {
-	using namespace simdjson;
-	fillCategories(categories);
+fg::Error fg::validateInParallel(const fastgltf::Asset& asset, TaskExecutorCallback* executor, void* userPointer) {
+	return validateCategories(asset, Category::All, true, executor, userPointer);
+}
+
+namespace fastgltf {
+	/**
+	 * Gets the category parsed from the given hashed top-level key of the glTF JSON, or Category::None if the key
+	 * does not belong to any category.
+	 */
+	static Category getCategoryFromKey(std::uint32_t hashedKey) {
+		switch (hashedKey) {
+			case force_consteval<crc32c("accessors")>: return Category::Accessors;
+			case force_consteval<crc32c("animations")>: return Category::Animations;
+			case force_consteval<crc32c("buffers")>: return Category::Buffers;
+			case force_consteval<crc32c("bufferViews")>: return Category::BufferViews;
+			case force_consteval<crc32c("cameras")>: return Category::Cameras;
+			case force_consteval<crc32c("images")>: return Category::Images;
+			case force_consteval<crc32c("materials")>: return Category::Materials;
+			case force_consteval<crc32c("meshes")>: return Category::Meshes;
+			case force_consteval<crc32c("nodes")>: return Category::Nodes;
+			case force_consteval<crc32c("samplers")>: return Category::Samplers;
+			case force_consteval<crc32c("scenes")>: return Category::Scenes;
+			case force_consteval<crc32c("skins")>: return Category::Skins;
+			case force_consteval<crc32c("textures")>: return Category::Textures;
+			default: return Category::None;
+		}
+	}
+
+	/**
+	 * The JSON document of an asset loaded with Options::LazyCategories, together with a parser which holds the
+	 * state of the Parser that loaded the asset. The parser owns the simdjson document that the root points into.
+	 */
+	class RetainedDocument {
+	public:
+		Parser parser;
+		simdjson::dom::object root;
+		Category parsedCategories = Category::None;
+	};
+
+	/**
+	 * The top-level object of a glTF, for which simdjson has built the DOM of the entire document.
+	 */
+	struct DomRoot {
+		struct Member {
+			std::uint32_t hashedKey;
+			simdjson::dom::element element;
+
+			simdjson::simdjson_result<simdjson::dom::element> value() const noexcept {
+				return simdjson::dom::element(element);
+			}
+		};
 
-	Asset asset {};
+		simdjson::dom::object object;
 
+		simdjson::simdjson_result<simdjson::dom::element> find(std::string_view key) const noexcept {
+			return object[key];
+		}
+
+		/** Calls the function for every member in order, until it returns an error. */
+		template <typename Function>
+		Error forEach(Function&& function) const {
+			for (const auto field : object) {
+				Member member { crcStringFunction(field.key), field.value };
+				if (auto error = function(member); error != Error::None)
+					return error;
+			}
+			return Error::None;
+		}
+	};
+
+	/**
+	 * The top-level object of a glTF, which has been split into the JSON of its members in a single pass using
+	 * simdjson's On-Demand API. The DOM of a member is only built when its value is requested, and using the same
+	 * simdjson parser for every member, which is why every value is only valid until the next one is requested.
+	 */
+	struct OnDemandRoot {
+		struct Member {
+			std::uint32_t hashedKey;
+			std::string_view json;
+			simdjson::dom::parser* parser;
+
+			simdjson::simdjson_result<simdjson::dom::element> value() const noexcept {
+				// The JSON of the member is part of the padded document, so it can be parsed in place.
+				return parser->parse(reinterpret_cast<const std::uint8_t*>(json.data()), json.size(), false);
+			}
+		};
+
+		std::vector<Member> members;
+
+		Error split(simdjson::padded_string_view json, simdjson::dom::parser* parser) {
+			using namespace simdjson;
+
+			// The On-Demand parser is only needed for this pass, after which its memory can be released.
+			ondemand::parser onDemandParser;
+			ondemand::document document;
+			ondemand::object root;
+			if (onDemandParser.iterate(json).get(document) != SUCCESS || document.get_object().get(root) != SUCCESS) FASTGLTF_UNLIKELY {
+				return Error::InvalidJson;
+			}
+
+			members.clear();
+			for (auto field : root) {
+				std::string_view key;
+				std::string_view value;
+				if (field.unescaped_key().get(key) != SUCCESS || field.value().raw_json().get(value) != SUCCESS) FASTGLTF_UNLIKELY {
+					return Error::InvalidJson;
+				}
+				members.push_back({ crcStringFunction(key), value, parser });
+			}
+			if (!document.at_end()) FASTGLTF_UNLIKELY {
+				return Error::InvalidJson;
+			}
+			return Error::None;
+		}
+
+		simdjson::simdjson_result<simdjson::dom::element> find(std::string_view key) const noexcept {
+			const auto hashedKey = crcStringFunction(key);
+			for (const auto& member : members) {
+				if (member.hashedKey == hashedKey)
+					return member.value();
+			}
+			return simdjson::NO_SUCH_FIELD;
+		}
+
+		/** Calls the function for every member in order, until it returns an error. */
+		template <typename Function>
+		Error forEach(Function&& function) const {
+			for (const auto& member : members) {
+				if (auto error = function(member); error != Error::None)
+					return error;
+			}
+			return Error::None;
+		}
+	};
+
+	/**
+	 * Options::OnDemandParsing is not used together with the options which need the DOM of the entire JSON.
+	 */
+	static bool isParsedOnDemand(Options options) noexcept {
+		return hasBit(options, Options::OnDemandParsing)
+			&& !hasBit(options, Options::ParseCategoriesInParallel)
+			&& !hasBit(options, Options::LazyCategories);
+	}
+
+	/**
+	 * Reserves the container of a category in the asset. The containers allocate from the asset's memory resource,
+	 * which is not thread-safe, so this happens before parsing categories in parallel, after which the parsing
+	 * functions only allocate from the resource of their category.
+	 */
+	static void reserveCategory(Category category, std::size_t count, Asset& asset) {
+		switch (category) {
+			case Category::Accessors: asset.accessors.reserve(count); break;
+			case Category::Animations: asset.animations.reserve(count); break;
+			case Category::Buffers: asset.buffers.reserve(count); break;
+			case Category::BufferViews: asset.bufferViews.reserve(count); break;
+			case Category::Cameras: asset.cameras.reserve(count); break;
+			case Category::Images: asset.images.reserve(count); break;
+			case Category::Materials: asset.materials.reserve(count); break;
+			case Category::Meshes: asset.meshes.reserve(count); break;
+			case Category::Nodes: asset.nodes.reserve(count); break;
+			case Category::Samplers: asset.samplers.reserve(count); break;
+			case Category::Scenes: asset.scenes.reserve(count); break;
+			case Category::Skins: asset.skins.reserve(count); break;
+			case Category::Textures: asset.textures.reserve(count); break;
+			default: break;
+		}
+	}
+} // namespace fastgltf
+
+fg::Asset fg::Parser::createAsset([[maybe_unused]] std::size_t expectedSize) {
 #if !FASTGLTF_DISABLE_CUSTOM_MEMORY_POOL
-	// Create a new chunk memory resource for each asset we parse.
-	asset.memoryResource = resourceAllocator = std::make_shared<std::pmr::monotonic_buffer_resource>();
+	// The memory of the previous asset is reused if that asset has been destroyed, as the resource is then only
+	// referenced by the parser.
+	auto* upstream = upstreamResource != nullptr ? upstreamResource : std::pmr::get_default_resource();
+	if (resourceAllocator && resourceAllocator.use_count() == 1 && resourceAllocator->upstreamResource() == upstream) {
+		resourceAllocator->reset(expectedSize);
+	} else {
+		resourceAllocator = std::make_shared<ChunkMemoryResource>(expectedSize, upstream);
+	}
+	return Asset(resourceAllocator);
+#else
+	return Asset {};
 #endif
+}
+
+template <typename JsonRoot>
+fg::Expected<fg::Asset> fg::Parser::parse(JsonRoot& root, std::size_t jsonSize, Category categories) {
+	using namespace simdjson;
+	fillCategories(categories);
+
+	// The parsed asset usually needs about twice as much memory as its JSON.
+	const auto expectedSize = jsonSize * 2;
+	auto asset = createAsset(expectedSize);
+	deferredFileLoads.clear();
 
 	if (!hasBit(options, Options::DontRequireValidAssetMember)) {
 		dom::object assetInfo;
 		AssetInfo info = {};
-		auto error = root["asset"].get_object().get(assetInfo);
+		auto error = root.find("asset").get_object().get(assetInfo);
 		if (error == NO_SUCH_FIELD) {
 			return Error::InvalidOrMissingAssetField;
 		}
@@ -1470,7 +2617,7 @@ fg::Expected<fg::Asset> fg::Parser::parse(simdjson::dom::object root, Category c
 		asset.assetInfo = std::move(info);
 	}
 
-	if (dom::array extensionsRequired; root["extensionsRequired"].get_array().get(extensionsRequired) == SUCCESS) FASTGLTF_LIKELY {
+	if (dom::array extensionsRequired; root.find("extensionsRequired").get_array().get(extensionsRequired) == SUCCESS) FASTGLTF_LIKELY {
 		for (auto extension : extensionsRequired) {
 			std::string_view string;
 			if (extension.get_string().get(string) != SUCCESS) FASTGLTF_UNLIKELY {
@@ -1497,41 +2644,110 @@ fg::Expected<fg::Asset> fg::Parser::parse(simdjson::dom::object root, Category c
 		}
 	}
 
-	Category readCategories = Category::None;
-	for (const auto object : root) {
-		auto hashedKey = crcStringFunction(object.key);
-		if (hashedKey == force_consteval<crc32c("scene")>) {
-			std::uint64_t defaultScene;
-			if (object.value.get_uint64().get(defaultScene) != SUCCESS) FASTGLTF_UNLIKELY {
+	if (dom::array extensionsUsed; root.find("extensionsUsed").get_array().get(extensionsUsed) == SUCCESS) FASTGLTF_LIKELY {
+		for (auto usedValue : extensionsUsed) {
+			std::string_view usedString;
+			if (usedValue.get_string().get(usedString) != SUCCESS) FASTGLTF_UNLIKELY {
 				return Error::InvalidGltf;
 			}
-			asset.defaultScene = static_cast<std::size_t>(defaultScene);
-			continue;
+			FASTGLTF_STD_PMR_NS::string FASTGLTF_CONSTRUCT_PMR_RESOURCE(string, resourceAllocator.get(), usedString);
+			asset.extensionsUsed.emplace_back(std::move(string));
 		}
+	}
 
-		if (hashedKey == force_consteval<crc32c("extensions")>) {
-			dom::object extensionsObject;
-			if (object.value.get_object().get(extensionsObject) != SUCCESS) FASTGLTF_UNLIKELY {
-				return Error::InvalidGltf;
-			}
-
-			if (auto error = parseExtensions(extensionsObject, asset); error != Error::None)
-				return error;
-			continue;
+	// With Options::ParseCategoriesInParallel the categories are only collected in the loop below,
+	// and are parsed concurrently afterwards, each with their own parser state and memory resource.
+	struct CategoryTask {
+		Category category;
+		dom::array array;
+		Parser parser;
+		Error error = Error::None;
+	};
+	std::vector<CategoryTask> categoryTasks;
+	const bool parseInParallel = hasBit(options, Options::ParseCategoriesInParallel);
+
+	// With Options::Validate, a category is validated right after it has been parsed if none of the categories it
+	// references are still to be parsed. Categories which are referenced but not present in the JSON can be ignored.
+	// All other categories are validated after the loop. The top-level extensions are tracked as Category::Asset.
+	const bool validateAsset = hasBit(options, Options::Validate);
+	Category unparsedCategories = Category::None;
+	Category unvalidatedCategories = Category::Asset;
+	if (validateAsset && !parseInParallel) {
+		root.forEach([&](auto& member) {
+			unparsedCategories |= member.hashedKey == force_consteval<crc32c("extensions")> ? Category::Asset : getCategoryFromKey(member.hashedKey);
+			return Error::None;
+		});
+		unparsedCategories &= categories | Category::Asset;
+	}
+
+	auto parseSequentially = [&](Category category, dom::array& array) -> Error {
+		const bool validateInline = validateAsset && (unparsedCategories & getValidationDependencies(category)) == Category::None;
+		validateWhileParsing = validateInline;
+		auto error = parseCategory(category, array, asset);
+		validateWhileParsing = false;
+		unparsedCategories &= ~category;
+		if (error != Error::None || !validateAsset)
+			return error;
+		if (!validateInline) {
+			unvalidatedCategories |= category;
+			return Error::None;
+		}
+
+		// Accessors, meshes, and nodes have already been validated element by element while parsing.
+		if (category == Category::Accessors || category == Category::Meshes || category == Category::Nodes)
+			return Error::None;
+		return validateCategory(asset, category);
+	};
+
+	Category readCategories = Category::None;
+	auto parseMember = [&](auto& member) -> Error {
+		const auto hashedKey = member.hashedKey;
+		if (hashedKey == force_consteval<crc32c("scene")>) {
+			std::uint64_t defaultScene;
+			if (member.value().get_uint64().get(defaultScene) != SUCCESS) FASTGLTF_UNLIKELY {
+				return Error::InvalidGltf;
+			}
+			asset.defaultScene = static_cast<std::size_t>(defaultScene);
+			return Error::None;
+		}
+
+		if (hashedKey == force_consteval<crc32c("extensions")>) {
+			dom::object extensionsObject;
+			if (member.value().get_object().get(extensionsObject) != SUCCESS) FASTGLTF_UNLIKELY {
+				return Error::InvalidGltf;
+			}
+
+			if (auto error = parseExtensions(extensionsObject, asset); error != Error::None)
+				return error;
+			unparsedCategories &= ~Category::Asset;
+			return Error::None;
 		}
 
 		if (hashedKey == force_consteval<crc32c("asset")> || hashedKey == force_consteval<crc32c("extras")>) {
-			continue;
+			return Error::None;
+		}
+
+		// The values of categories which have not been requested are never looked at.
+		if (auto category = getCategoryFromKey(hashedKey); category != Category::None && !hasBit(categories, category)) {
+			readCategories |= category;
+			return Error::None;
 		}
 
 		dom::array array;
-		if (object.value.get_array().get(array) != SUCCESS) FASTGLTF_UNLIKELY {
+		if (member.value().get_array().get(array) != SUCCESS) FASTGLTF_UNLIKELY {
 			return Error::InvalidGltf;
 		}
 
+		// The glTF spec requires JSON keys to be unique, which we rely on when parsing concurrently.
 #define KEY_SWITCH_CASE(name, id) case force_consteval<crc32c(FASTGLTF_QUOTE(id))>:       \
-                if (hasBit(categories, Category::name))   \
-                    error = parse##name(array, asset);                     \
+                if (hasBit(categories, Category::name)) { \
+                    if (!parseInParallel)                 \
+                        error = parseSequentially(Category::name, array); \
+                    else if (hasBit(readCategories, Category::name)) \
+                        error = Error::InvalidGltf;       \
+                    else                                  \
+                        categoryTasks.push_back({ Category::name, array, Parser(), Error::None }); \
+                }                                         \
                 readCategories |= Category::name;         \
                 break;
 
@@ -1550,18 +2766,7 @@ fg::Expected<fg::Asset> fg::Parser::parse(simdjson::dom::object root, Category c
 			KEY_SWITCH_CASE(Scenes, scenes)
 			KEY_SWITCH_CASE(Skins, skins)
 			KEY_SWITCH_CASE(Textures, textures)
-			case force_consteval<crc32c("extensionsUsed")>: {
-				for (auto usedValue : array) {
-					std::string_view usedString;
-					if (auto eError = usedValue.get_string().get(usedString); eError == SUCCESS) FASTGLTF_LIKELY {
-						FASTGLTF_STD_PMR_NS::string FASTGLTF_CONSTRUCT_PMR_RESOURCE(string, resourceAllocator.get(), usedString);
-						asset.extensionsUsed.emplace_back(std::move(string));
-					} else {
-						error = Error::InvalidGltf;
-					}
-				}
-				break;
-			}
+			case force_consteval<crc32c("extensionsUsed")>:
 			case force_consteval<crc32c("extensionsRequired")>: {
 				// These are already parsed before this section.
 				break;
@@ -1570,15 +2775,114 @@ fg::Expected<fg::Asset> fg::Parser::parse(simdjson::dom::object root, Category c
 				break;
 		}
 
-		if (error != Error::None)
-			return error;
-
 #undef KEY_SWITCH_CASE
+		return error;
+	};
+	if (auto error = root.forEach(parseMember); error != Error::None) {
+		return error;
 	}
 
 	asset.availableCategories = readCategories;
 
+	if (!categoryTasks.empty()) {
+		for (auto& task : categoryTasks) {
+			task.parser.config = config;
+			task.parser.options = options;
+			task.parser.directory = directory;
+#if !FASTGLTF_DISABLE_CUSTOM_MEMORY_POOL
+			task.parser.resourceAllocator = asset.categoryMemoryResources.emplace_back(
+				std::make_shared<ChunkMemoryResource>(expectedSize / categoryTasks.size(), resourceAllocator->upstreamResource()));
+#endif
+			reserveCategory(task.category, task.array.size(), asset);
+			if (task.category == Category::Buffers) {
+				task.parser.glbBuffer = std::move(glbBuffer);
+			}
+		}
+
+		struct CategoryTaskData {
+			std::vector<CategoryTask>* tasks;
+			Asset* asset;
+		} taskData { &categoryTasks, &asset };
+		executeTasks(categoryTasks.size(), [](std::size_t taskIndex, void* data) {
+			auto* taskData = static_cast<CategoryTaskData*>(data);
+			auto& task = (*taskData->tasks)[taskIndex];
+			task.error = task.parser.parseCategory(task.category, task.array, *taskData->asset);
+		}, &taskData);
+
+		// Check the errors and gather the deferred loads in the order of the categories in the JSON,
+		// so that the result is the same as when parsing sequentially.
+		for (auto& task : categoryTasks) {
+			if (task.error != Error::None) {
+				return task.error;
+			}
+			deferredFileLoads.insert(deferredFileLoads.end(), task.parser.deferredFileLoads.begin(), task.parser.deferredFileLoads.end());
+		}
+	}
+
+	if (validateAsset) {
+		// When parsing in parallel, nothing could be validated while parsing.
+		const auto remainingCategories = parseInParallel ? Category::All : unvalidatedCategories;
+		if (auto error = validateCategories(asset, remainingCategories, parseInParallel, config.executorCallback, config.userPointer); error != Error::None) {
+			return error;
+		}
+	}
+
+	if (auto error = processParsedCategories(asset, readCategories); error != Error::None) {
+		return error;
+	}
+
+	// Keep the JSON document alive if any of the categories in it have not been parsed. Options::OnDemandParsing
+	// never builds the document of the entire JSON, and is therefore not used together with Options::LazyCategories.
+	if constexpr (std::is_same_v<JsonRoot, DomRoot>) {
+		if (hasBit(options, Options::LazyCategories) && (readCategories & ~categories) != Category::None) {
+			auto document = std::make_shared<RetainedDocument>();
+			auto& parser = document->parser;
+			parser.config = config;
+			parser.options = options;
+			parser.directory = directory;
+#if !FASTGLTF_DISABLE_CUSTOM_MEMORY_POOL
+			parser.resourceAllocator = resourceAllocator;
+#endif
+			if (!hasBit(categories, Category::Buffers)) {
+				parser.glbBuffer = std::move(glbBuffer);
+			}
+			// The document is owned by the simdjson parser, so the retained one takes over ours.
+			std::swap(parser.jsonParser, jsonParser);
+			document->root = root.object;
+			document->parsedCategories = categories;
+			asset.retainedDocument = std::move(document);
+		}
+	}
+
+	return std::move(asset);
+}
+
+fg::Error fg::Parser::processParsedCategories(Asset& asset, Category parsedCategories) {
+	if (!deferredFileLoads.empty()) {
+		if (auto error = loadDeferredFiles(asset); error != Error::None) {
+			return error;
+		}
+	}
+
+	if (hasBit(options, Options::DecompressMeshopt) && hasBit(parsedCategories, Category::Buffers | Category::BufferViews)) {
+		FASTGLTF_PROFILE_STAGE(profilingScope, ParseStage::DecompressMeshopt);
+		FASTGLTF_PROFILE_COUNTS(profilingScope, 0, asset.bufferViews.size());
+		if (auto error = decompressMeshoptBufferViews(asset); error != Error::None) {
+			return error;
+		}
+	}
+
+	if (config.dracoCallback != nullptr && hasBit(parsedCategories, Category::Meshes | Category::Accessors)) {
+		FASTGLTF_PROFILE_STAGE(profilingScope, ParseStage::DecodeDraco);
+		FASTGLTF_PROFILE_COUNTS(profilingScope, 0, asset.meshes.size());
+		if (auto error = decodeDracoPrimitives(asset); error != Error::None) {
+			return error;
+		}
+	}
+
 	if (hasBit(options, Options::GenerateMeshIndices)) {
+		FASTGLTF_PROFILE_STAGE(profilingScope, ParseStage::GenerateIndices);
+		FASTGLTF_PROFILE_COUNTS(profilingScope, 0, asset.meshes.size());
 		if (auto error = generateMeshIndices(asset); error != Error::None) {
 			return error;
 		}
@@ -1596,7 +2900,79 @@ fg::Expected<fg::Asset> fg::Parser::parse(simdjson::dom::object root, Category c
 		}
 	}
 
-	return std::move(asset);
+	return Error::None;
+}
+
+fg::Error fg::Parser::parseRetainedCategories(Asset& asset, Category categories) {
+	using namespace simdjson;
+	if (!asset.retainedDocument) {
+		return Error::None;
+	}
+
+	auto& document = *asset.retainedDocument;
+	fillCategories(categories);
+	const auto newCategories = categories & ~document.parsedCategories;
+	if (newCategories == Category::None) {
+		return Error::None;
+	}
+
+	auto& parser = document.parser;
+	parser.deferredFileLoads.clear();
+	for (const auto object : document.root) {
+		const auto category = getCategoryFromKey(crcStringFunction(object.key));
+		if (category == Category::None || !hasBit(newCategories, category))
+			continue;
+
+		dom::array array;
+		if (object.value.get_array().get(array) != SUCCESS) FASTGLTF_UNLIKELY {
+			return Error::InvalidGltf;
+		}
+		if (auto error = parser.parseCategory(category, array, asset); error != Error::None) {
+			return error;
+		}
+	}
+	document.parsedCategories |= newCategories;
+
+	if (hasBit(parser.options, Options::Validate)) {
+		if (auto error = validateCategories(asset, newCategories, false, nullptr, nullptr); error != Error::None) {
+			return error;
+		}
+	}
+
+	if (auto error = parser.processParsedCategories(asset, document.parsedCategories); error != Error::None) {
+		return error;
+	}
+
+	// Once everything has been parsed, the document is no longer needed.
+	if (hasBit(document.parsedCategories, asset.availableCategories)) {
+		asset.retainedDocument.reset();
+	}
+	return Error::None;
+}
+
+fg::Error fg::ensureCategories(Asset& asset, Category categories) {
+	return Parser::parseRetainedCategories(asset, categories);
+}
+
+fg::Error fg::Parser::parseCategory(Category category, simdjson::dom::array& array, Asset& asset) {
+	FASTGLTF_PROFILE_STAGE(profilingScope, ParseStage::ParseCategory, category);
+	FASTGLTF_PROFILE_COUNTS(profilingScope, 0, array.size());
+	switch (category) {
+		case Category::Accessors: return parseAccessors(array, asset);
+		case Category::Animations: return parseAnimations(array, asset);
+		case Category::Buffers: return parseBuffers(array, asset);
+		case Category::BufferViews: return parseBufferViews(array, asset);
+		case Category::Cameras: return parseCameras(array, asset);
+		case Category::Images: return parseImages(array, asset);
+		case Category::Materials: return parseMaterials(array, asset);
+		case Category::Meshes: return parseMeshes(array, asset);
+		case Category::Nodes: return parseNodes(array, asset);
+		case Category::Samplers: return parseSamplers(array, asset);
+		case Category::Scenes: return parseScenes(array, asset);
+		case Category::Skins: return parseSkins(array, asset);
+		case Category::Textures: return parseTextures(array, asset);
+		default: return Error::InvalidGltf;
+	}
 }
 
 fg::Error fg::Parser::parseAccessors(simdjson::dom::array& accessors, Asset& asset) {
@@ -1611,45 +2987,112 @@ fg::Error fg::Parser::parseAccessors(simdjson::dom::array& accessors, Asset& ass
             return Error::InvalidGltf;
         }
 
-        std::uint64_t componentType;
-        if (accessorObject["componentType"].get_uint64().get(componentType) != SUCCESS) FASTGLTF_UNLIKELY {
-            return Error::InvalidGltf;
-        }
-		accessor.componentType = getComponentType(static_cast<std::underlying_type_t<ComponentType>>(componentType));
-        if (accessor.componentType == ComponentType::Double && (!hasBit(options, Options::AllowDouble) || !hasBit(config.extensions, Extensions::KHR_accessor_float64))) {
-            return Error::InvalidGltf;
-        }
-
-        std::string_view accessorType;
-        if (accessorObject["type"].get_string().get(accessorType) != SUCCESS) FASTGLTF_UNLIKELY {
-            return Error::InvalidGltf;
-        }
-		accessor.type = getAccessorType(accessorType);
-
-        std::uint64_t accessorCount;
-        if (accessorObject["count"].get_uint64().get(accessorCount) != SUCCESS) FASTGLTF_UNLIKELY {
-            return Error::InvalidGltf;
-        }
-		accessor.count = static_cast<std::size_t>(accessorCount);
-
-
-        std::uint64_t bufferView;
-        if (accessorObject["bufferView"].get_uint64().get(bufferView) == SUCCESS) FASTGLTF_LIKELY {
-            accessor.bufferViewIndex = static_cast<std::size_t>(bufferView);
-        }
+		// min and max depend on the type and componentType, which might only appear after them.
+		dom::array maxElements, minElements;
+		dom::object extrasObject;
+		bool hasComponentType = false, hasType = false, hasCount = false;
+		bool hasMax = false, hasMin = false, hasExtras = false;
+		for (auto field : accessorObject) {
+			switch (crcStringFunction(field.key)) {
+				case force_consteval<crc32c("componentType")>: {
+					std::uint64_t componentType;
+					if (field.value.get_uint64().get(componentType) != SUCCESS) FASTGLTF_UNLIKELY {
+						return Error::InvalidGltf;
+					}
+					accessor.componentType = getComponentType(static_cast<std::underlying_type_t<ComponentType>>(componentType));
+					if (accessor.componentType == ComponentType::Double && (!hasBit(options, Options::AllowDouble) || !hasBit(config.extensions, Extensions::KHR_accessor_float64))) {
+						return Error::InvalidGltf;
+					}
+					hasComponentType = true;
+					break;
+				}
+				case force_consteval<crc32c("type")>: {
+					std::string_view accessorType;
+					if (field.value.get_string().get(accessorType) != SUCCESS) FASTGLTF_UNLIKELY {
+						return Error::InvalidGltf;
+					}
+					accessor.type = getAccessorType(accessorType);
+					hasType = true;
+					break;
+				}
+				case force_consteval<crc32c("count")>: {
+					std::uint64_t accessorCount;
+					if (field.value.get_uint64().get(accessorCount) != SUCCESS) FASTGLTF_UNLIKELY {
+						return Error::InvalidGltf;
+					}
+					accessor.count = static_cast<std::size_t>(accessorCount);
+					hasCount = true;
+					break;
+				}
+				case force_consteval<crc32c("bufferView")>: {
+					std::uint64_t bufferView;
+					if (field.value.get_uint64().get(bufferView) == SUCCESS) FASTGLTF_LIKELY {
+						accessor.bufferViewIndex = static_cast<std::size_t>(bufferView);
+					}
+					break;
+				}
+				case force_consteval<crc32c("byteOffset")>: {
+					// byteOffset is optional, but defaults to 0
+					std::uint64_t byteOffset;
+					if (field.value.get_uint64().get(byteOffset) != SUCCESS) FASTGLTF_UNLIKELY {
+						return Error::InvalidGltf;
+					}
+					accessor.byteOffset = static_cast<std::size_t>(byteOffset);
+					break;
+				}
+				case force_consteval<crc32c("max")>: {
+					hasMax = field.value.get_array().get(maxElements) == SUCCESS;
+					break;
+				}
+				case force_consteval<crc32c("min")>: {
+					hasMin = field.value.get_array().get(minElements) == SUCCESS;
+					break;
+				}
+				case force_consteval<crc32c("normalized")>: {
+					if (field.value.get_bool().get(accessor.normalized) != SUCCESS) FASTGLTF_UNLIKELY {
+						return Error::InvalidGltf;
+					}
+					break;
+				}
+				case force_consteval<crc32c("sparse")>: {
+					dom::object sparseAccessorObject;
+					if (field.value.get_object().get(sparseAccessorObject) != SUCCESS)
+						break;
+					SparseAccessor sparse = {};
+					if (auto error = parseSparseAccessor(sparseAccessorObject, sparse); error != Error::None) {
+						return error;
+					}
+					accessor.sparse = sparse;
+					break;
+				}
+				case force_consteval<crc32c("extras")>: {
+					if (config.extrasCallback == nullptr)
+						break;
+					if (field.value.get_object().get(extrasObject) != SUCCESS) FASTGLTF_UNLIKELY {
+						return Error::InvalidGltf;
+					}
+					hasExtras = true;
+					break;
+				}
+				case force_consteval<crc32c("name")>: {
+					std::string_view name;
+					if (field.value.get_string().get(name) == SUCCESS) {
+						accessor.name = FASTGLTF_CONSTRUCT_PMR_RESOURCE(decltype(accessor.name), resourceAllocator.get(), name);
+					}
+					break;
+				}
+				default:
+					break;
+			}
+		}
 
-        // byteOffset is optional, but defaults to 0
-        std::uint64_t byteOffset;
-        if (auto error = accessorObject["byteOffset"].get_uint64().get(byteOffset); error == SUCCESS) FASTGLTF_LIKELY {
-            accessor.byteOffset = static_cast<std::size_t>(byteOffset);
-        } else if (error != NO_SUCH_FIELD) FASTGLTF_UNLIKELY {
-            return Error::InvalidGltf;
-        }
+		if (!hasComponentType || !hasType || !hasCount) FASTGLTF_UNLIKELY {
+			return Error::InvalidGltf;
+		}
 
         // Type of min and max should always be the same.
-        auto parseMinMax = [&](std::string_view key, decltype(Accessor::max)& ref) -> fastgltf::Error {
-            dom::array elements;
-            if (accessorObject[key].get_array().get(elements) == SUCCESS) FASTGLTF_LIKELY {
+        auto parseMinMax = [&](dom::array& elements, decltype(Accessor::max)& ref) -> fastgltf::Error {
+            {
                 decltype(Accessor::max) variant;
 
 				using double_vec = std::variant_alternative_t<1, decltype(Accessor::max)>;
@@ -1722,86 +3165,30 @@ fg::Error fg::Parser::parseAccessors(simdjson::dom::array& accessors, Asset& ass
             return Error::None;
         };
 
-        if (auto error = parseMinMax("max", accessor.max); error != Error::None) {
-            return error;
-        }
-        if (auto error = parseMinMax("min", accessor.min); error != Error::None) {
-            return error;
-        }
-
-        if (auto error = accessorObject["normalized"].get_bool().get(accessor.normalized); error != SUCCESS && error != NO_SUCH_FIELD) FASTGLTF_UNLIKELY {
-            return Error::InvalidGltf;
-        }
+        if (hasMax) {
+			if (auto error = parseMinMax(maxElements, accessor.max); error != Error::None) {
+				return error;
+			}
+		}
+        if (hasMin) {
+			if (auto error = parseMinMax(minElements, accessor.min); error != Error::None) {
+				return error;
+			}
+		}
 
 		// This property MUST NOT be set to true for accessors with FLOAT or UNSIGNED_INT component type.
 		if (accessor.normalized && (accessor.componentType == ComponentType::UnsignedInt || accessor.componentType == ComponentType::Float)) {
 			return Error::InvalidGltf;
 		}
 
-        dom::object sparseAccessorObject;
-        if (accessorObject["sparse"].get_object().get(sparseAccessorObject) == SUCCESS) FASTGLTF_LIKELY {
-            SparseAccessor sparse = {};
-            std::uint64_t value;
-            dom::object child;
-            if (sparseAccessorObject["count"].get_uint64().get(value) != SUCCESS) FASTGLTF_UNLIKELY {
-                return Error::InvalidGltf;
-            }
-            sparse.count = static_cast<std::size_t>(value);
-
-            // Accessor Sparce Indices
-            if (sparseAccessorObject["indices"].get_object().get(child) != SUCCESS) FASTGLTF_UNLIKELY {
-                return Error::InvalidGltf;
-            }
-
-            if (child["bufferView"].get_uint64().get(value) != SUCCESS) FASTGLTF_UNLIKELY {
-                return Error::InvalidGltf;
-            }
-            sparse.indicesBufferView = static_cast<std::size_t>(value);
-
-            if (auto error = child["byteOffset"].get_uint64().get(value); error == SUCCESS) FASTGLTF_LIKELY {
-                sparse.indicesByteOffset = static_cast<std::size_t>(value);
-            } else if (error != NO_SUCH_FIELD) FASTGLTF_UNLIKELY {
-                return Error::InvalidGltf;
-            }
-
-            if (child["componentType"].get_uint64().get(value) != SUCCESS) FASTGLTF_UNLIKELY {
-                return Error::InvalidGltf;
-            }
-            sparse.indexComponentType = getComponentType(static_cast<std::underlying_type_t<ComponentType>>(value));
-
-            // Accessor Sparse Values
-            if (sparseAccessorObject["values"].get_object().get(child) != SUCCESS) FASTGLTF_UNLIKELY {
-                return Error::InvalidGltf;
-            }
-
-            if (child["bufferView"].get_uint64().get(value) != SUCCESS) FASTGLTF_UNLIKELY {
-                return Error::InvalidGltf;
-            }
-            sparse.valuesBufferView = static_cast<std::size_t>(value);
-
-            if (auto error = child["byteOffset"].get_uint64().get(value); error == SUCCESS) FASTGLTF_LIKELY {
-                sparse.valuesByteOffset = static_cast<std::size_t>(value);
-            } else if (error != NO_SUCH_FIELD) FASTGLTF_UNLIKELY {
-                return Error::InvalidGltf;
-            }
-
-            accessor.sparse = sparse;
-        }
-
-		if (config.extrasCallback != nullptr) {
-			dom::object extrasObject;
-			if (auto extrasError = accessorObject["extras"].get_object().get(extrasObject); extrasError == SUCCESS) {
-				config.extrasCallback(&extrasObject, asset.accessors.size(), Category::Accessors, config.userPointer);
-			} else if (extrasError != NO_SUCH_FIELD) {
-				return Error::InvalidGltf;
-			}
+		if (hasExtras) {
+			config.extrasCallback(&extrasObject, asset.accessors.size(), Category::Accessors, config.userPointer);
 		}
 
-		std::string_view name;
-        if (accessorObject["name"].get_string().get(name) == SUCCESS) {
-	        accessor.name = FASTGLTF_CONSTRUCT_PMR_RESOURCE(decltype(accessor.name), resourceAllocator.get(), name);
-        }
-
+		if (validateWhileParsing) {
+			if (auto error = validateAccessor(asset, accessor); error != Error::None)
+				return error;
+		}
 	    asset.accessors.emplace_back(std::move(accessor));
     }
 
@@ -1988,7 +3375,15 @@ fg::Error fg::Parser::parseBuffers(simdjson::dom::array& buffers, Asset& asset)
                 }
 
                 buffer.data = std::move(source);
-            } else if (uriView.isLocalPath() && hasBit(options, Options::LoadExternalBuffers)) {
+            } else if (uriView.isLocalPath() && hasBit(options, Options::MapExternalBuffers)) {
+				auto [error, source] = mapFileFromUri(uriView, asset);
+				if (error != Error::None) {
+					return error;
+				}
+
+				buffer.data = std::move(source);
+            } else if (uriView.isLocalPath() && hasBit(options, Options::LoadExternalBuffers)
+					&& !hasBit(options, Options::LoadExternalFilesInParallel)) {
 	            auto [error, source] = loadFileFromUri(uriView);
                 if (error != Error::None) {
                     return error;
@@ -1996,6 +3391,11 @@ fg::Error fg::Parser::parseBuffers(simdjson::dom::array& buffers, Asset& asset)
 
                 buffer.data = std::move(source);
             } else {
+				if (uriView.isLocalPath() && hasBit(options, Options::LoadExternalBuffers)) {
+					// The file is loaded once all buffers and images have been parsed, which then replaces this URI source.
+					deferredFileLoads.emplace_back(Category::Buffers, asset.buffers.size());
+				}
+
                 sources::URI filePath;
                 filePath.fileByteOffset = 0;
                 filePath.uri = uriView;
@@ -2378,7 +3778,8 @@ fg::Error fg::Parser::parseImages(simdjson::dom::array& images, Asset& asset) {
                 }
 
                 image.data = std::move(source);
-            } else if (uriView.isLocalPath() && hasBit(options, Options::LoadExternalImages)) {
+            } else if (uriView.isLocalPath() && hasBit(options, Options::LoadExternalImages)
+					&& !hasBit(options, Options::LoadExternalFilesInParallel)) {
 	            auto [error, source] = loadFileFromUri(uriView);
                 if (error != Error::None) {
                     return error;
@@ -2386,6 +3787,11 @@ fg::Error fg::Parser::parseImages(simdjson::dom::array& images, Asset& asset) {
 
                 image.data = std::move(source);
             } else {
+				if (uriView.isLocalPath() && hasBit(options, Options::LoadExternalImages)) {
+					// The file is loaded once all buffers and images have been parsed, which then replaces this URI source.
+					deferredFileLoads.emplace_back(Category::Images, asset.images.size());
+				}
+
                 sources::URI filePath;
                 filePath.fileByteOffset = 0;
                 filePath.uri = uriView;
@@ -2563,29 +3969,35 @@ fg::Error fg::Parser::parseMaterialExtensions(simdjson::dom::object &object, fas
 				}
 
 				auto anisotropy = std::make_unique<MaterialAnisotropy>();
-
-				double anisotropyStrength;
-				if (auto error = anisotropyObject["anisotropyStrength"].get_double().get(anisotropyStrength);
-						error == SUCCESS) FASTGLTF_LIKELY {
-					anisotropy->anisotropyStrength = static_cast<num>(anisotropyStrength);
-				} else if (error != NO_SUCH_FIELD) FASTGLTF_UNLIKELY {
-					return Error::InvalidJson;
-				}
-
-				double anisotropyRotation;
-				if (auto error = anisotropyObject["anisotropyRotation"].get_double().get(anisotropyRotation);
-						error == SUCCESS) FASTGLTF_LIKELY {
-					anisotropy->anisotropyRotation = static_cast<num>(anisotropyRotation);
-				} else if (error != NO_SUCH_FIELD) FASTGLTF_UNLIKELY {
-					return Error::InvalidJson;
-				}
-
-				TextureInfo anisotropyTexture;
-				if (auto error = parseTextureInfo(anisotropyObject, "anisotropyTexture", &anisotropyTexture,
-												  config.extensions); error == Error::None) FASTGLTF_LIKELY {
-					anisotropy->anisotropyTexture = std::move(anisotropyTexture);
-				} else if (error != Error::MissingField) {
-					return error;
+				for (auto field : anisotropyObject) {
+					switch (crcStringFunction(field.key)) {
+						case force_consteval<crc32c("anisotropyStrength")>: {
+							double anisotropyStrength;
+							if (field.value.get_double().get(anisotropyStrength) != SUCCESS) FASTGLTF_UNLIKELY {
+								return Error::InvalidJson;
+							}
+							anisotropy->anisotropyStrength = static_cast<num>(anisotropyStrength);
+							break;
+						}
+						case force_consteval<crc32c("anisotropyRotation")>: {
+							double anisotropyRotation;
+							if (field.value.get_double().get(anisotropyRotation) != SUCCESS) FASTGLTF_UNLIKELY {
+								return Error::InvalidJson;
+							}
+							anisotropy->anisotropyRotation = static_cast<num>(anisotropyRotation);
+							break;
+						}
+						case force_consteval<crc32c("anisotropyTexture")>: {
+							TextureInfo anisotropyTexture;
+							if (auto error = parseTextureInfo(field.value, &anisotropyTexture, config.extensions); error != Error::None) {
+								return error;
+							}
+							anisotropy->anisotropyTexture = std::move(anisotropyTexture);
+							break;
+						}
+						default:
+							break;
+					}
 				}
 
 				material.anisotropy = std::move(anisotropy);
@@ -2602,47 +4014,51 @@ fg::Error fg::Parser::parseMaterialExtensions(simdjson::dom::object &object, fas
 				}
 
 				auto clearcoat = std::make_unique<MaterialClearcoat>();
-
-				double clearcoatFactor;
-				if (auto error = clearcoatObject["clearcoatFactor"].get_double().get(clearcoatFactor); error ==
-																									   SUCCESS) {
-					clearcoat->clearcoatFactor = static_cast<num>(clearcoatFactor);
-				} else if (error != NO_SUCH_FIELD) FASTGLTF_UNLIKELY {
-					return Error::InvalidJson;
-				}
-
-				TextureInfo clearcoatTexture;
-				if (auto error = parseTextureInfo(clearcoatObject, "clearcoatTexture", &clearcoatTexture,
-												  config.extensions); error == Error::None) FASTGLTF_LIKELY {
-					clearcoat->clearcoatTexture = std::move(clearcoatTexture);
-				} else if (error != Error::MissingField) {
-					return error;
-				}
-
-				double clearcoatRoughnessFactor;
-				if (auto error = clearcoatObject["clearcoatRoughnessFactor"].get_double().get(
-							clearcoatRoughnessFactor); error == SUCCESS) FASTGLTF_LIKELY {
-					clearcoat->clearcoatRoughnessFactor = static_cast<num>(clearcoatRoughnessFactor);
-				} else if (error != NO_SUCH_FIELD) FASTGLTF_UNLIKELY {
-					return Error::InvalidJson;
-				}
-
-				TextureInfo clearcoatRoughnessTexture;
-				if (auto error = parseTextureInfo(clearcoatObject, "clearcoatRoughnessTexture",
-												  &clearcoatRoughnessTexture, config.extensions); error ==
-																								  Error::None) {
-					clearcoat->clearcoatRoughnessTexture = std::move(clearcoatRoughnessTexture);
-				} else if (error != Error::MissingField) {
-					return error;
-				}
-
-				NormalTextureInfo clearcoatNormalTexture;
-				if (auto error = parseTextureInfo(clearcoatObject, "clearcoatNormalTexture",
-												  &clearcoatNormalTexture, config.extensions, TextureInfoType::NormalTexture); error ==
-																							   Error::None) {
-					clearcoat->clearcoatNormalTexture = std::move(clearcoatNormalTexture);
-				} else if (error != Error::MissingField) {
-					return error;
+				for (auto field : clearcoatObject) {
+					switch (crcStringFunction(field.key)) {
+						case force_consteval<crc32c("clearcoatFactor")>: {
+							double clearcoatFactor;
+							if (field.value.get_double().get(clearcoatFactor) != SUCCESS) FASTGLTF_UNLIKELY {
+								return Error::InvalidJson;
+							}
+							clearcoat->clearcoatFactor = static_cast<num>(clearcoatFactor);
+							break;
+						}
+						case force_consteval<crc32c("clearcoatTexture")>: {
+							TextureInfo clearcoatTexture;
+							if (auto error = parseTextureInfo(field.value, &clearcoatTexture, config.extensions); error != Error::None) {
+								return error;
+							}
+							clearcoat->clearcoatTexture = std::move(clearcoatTexture);
+							break;
+						}
+						case force_consteval<crc32c("clearcoatRoughnessFactor")>: {
+							double clearcoatRoughnessFactor;
+							if (field.value.get_double().get(clearcoatRoughnessFactor) != SUCCESS) FASTGLTF_UNLIKELY {
+								return Error::InvalidJson;
+							}
+							clearcoat->clearcoatRoughnessFactor = static_cast<num>(clearcoatRoughnessFactor);
+							break;
+						}
+						case force_consteval<crc32c("clearcoatRoughnessTexture")>: {
+							TextureInfo clearcoatRoughnessTexture;
+							if (auto error = parseTextureInfo(field.value, &clearcoatRoughnessTexture, config.extensions); error != Error::None) {
+								return error;
+							}
+							clearcoat->clearcoatRoughnessTexture = std::move(clearcoatRoughnessTexture);
+							break;
+						}
+						case force_consteval<crc32c("clearcoatNormalTexture")>: {
+							NormalTextureInfo clearcoatNormalTexture;
+							if (auto error = parseTextureInfo(field.value, &clearcoatNormalTexture, config.extensions, TextureInfoType::NormalTexture); error != Error::None) {
+								return error;
+							}
+							clearcoat->clearcoatNormalTexture = std::move(clearcoatNormalTexture);
+							break;
+						}
+						default:
+							break;
+					}
 				}
 
 				material.clearcoat = std::move(clearcoat);
@@ -2716,54 +4132,59 @@ fg::Error fg::Parser::parseMaterialExtensions(simdjson::dom::object &object, fas
 				}
 
 				auto iridescence = std::make_unique<MaterialIridescence>();
-
-				double iridescenceFactor;
-				if (auto error = iridescenceObject["iridescenceFactor"].get_double().get(iridescenceFactor);
-						error == SUCCESS) FASTGLTF_LIKELY {
-					iridescence->iridescenceFactor = static_cast<num>(iridescenceFactor);
-				} else if (error != NO_SUCH_FIELD) FASTGLTF_UNLIKELY {
-					return Error::InvalidGltf;
-				}
-
-				TextureInfo iridescenceTexture;
-				if (auto error = parseTextureInfo(iridescenceObject, "iridescenceTexture", &iridescenceTexture,
-												  config.extensions); error == Error::None) FASTGLTF_LIKELY {
-					iridescence->iridescenceTexture = std::move(iridescenceTexture);
-				} else if (error != Error::MissingField) {
-					return error;
-				}
-
-				double iridescenceIor;
-				if (auto error = iridescenceObject["iridescenceIor"].get_double().get(iridescenceIor); error ==
-																									   SUCCESS) {
-					iridescence->iridescenceIor = static_cast<num>(iridescenceIor);
-				} else if (error != NO_SUCH_FIELD) FASTGLTF_UNLIKELY {
-					return Error::InvalidGltf;
-				}
-
-				double iridescenceThicknessMinimum;
-				if (auto error = iridescenceObject["iridescenceThicknessMinimum"].get_double().get(
-							iridescenceThicknessMinimum); error == SUCCESS) FASTGLTF_LIKELY {
-					iridescence->iridescenceThicknessMinimum = static_cast<num>(iridescenceThicknessMinimum);
-				} else if (error != NO_SUCH_FIELD) FASTGLTF_UNLIKELY {
-					return Error::InvalidGltf;
-				}
-
-				double iridescenceThicknessMaximum;
-				if (auto error = iridescenceObject["iridescenceThicknessMaximum"].get_double().get(
-							iridescenceThicknessMaximum); error == SUCCESS) FASTGLTF_LIKELY {
-					iridescence->iridescenceThicknessMaximum = static_cast<num>(iridescenceThicknessMaximum);
-				} else if (error != NO_SUCH_FIELD) FASTGLTF_UNLIKELY {
-					return Error::InvalidGltf;
-				}
-
-				TextureInfo iridescenceThicknessTexture;
-				if (auto error = parseTextureInfo(iridescenceObject, "iridescenceThicknessTexture",
-												  &iridescenceThicknessTexture, config.extensions); error ==
-																									Error::None) {
-					iridescence->iridescenceThicknessTexture = std::move(iridescenceThicknessTexture);
-				} else if (error != Error::MissingField) {
-					return error;
+				for (auto field : iridescenceObject) {
+					switch (crcStringFunction(field.key)) {
+						case force_consteval<crc32c("iridescenceFactor")>: {
+							double iridescenceFactor;
+							if (field.value.get_double().get(iridescenceFactor) != SUCCESS) FASTGLTF_UNLIKELY {
+								return Error::InvalidGltf;
+							}
+							iridescence->iridescenceFactor = static_cast<num>(iridescenceFactor);
+							break;
+						}
+						case force_consteval<crc32c("iridescenceTexture")>: {
+							TextureInfo iridescenceTexture;
+							if (auto error = parseTextureInfo(field.value, &iridescenceTexture, config.extensions); error != Error::None) {
+								return error;
+							}
+							iridescence->iridescenceTexture = std::move(iridescenceTexture);
+							break;
+						}
+						case force_consteval<crc32c("iridescenceIor")>: {
+							double iridescenceIor;
+							if (field.value.get_double().get(iridescenceIor) != SUCCESS) FASTGLTF_UNLIKELY {
+								return Error::InvalidGltf;
+							}
+							iridescence->iridescenceIor = static_cast<num>(iridescenceIor);
+							break;
+						}
+						case force_consteval<crc32c("iridescenceThicknessMinimum")>: {
+							double iridescenceThicknessMinimum;
+							if (field.value.get_double().get(iridescenceThicknessMinimum) != SUCCESS) FASTGLTF_UNLIKELY {
+								return Error::InvalidGltf;
+							}
+							iridescence->iridescenceThicknessMinimum = static_cast<num>(iridescenceThicknessMinimum);
+							break;
+						}
+						case force_consteval<crc32c("iridescenceThicknessMaximum")>: {
+							double iridescenceThicknessMaximum;
+							if (field.value.get_double().get(iridescenceThicknessMaximum) != SUCCESS) FASTGLTF_UNLIKELY {
+								return Error::InvalidGltf;
+							}
+							iridescence->iridescenceThicknessMaximum = static_cast<num>(iridescenceThicknessMaximum);
+							break;
+						}
+						case force_consteval<crc32c("iridescenceThicknessTexture")>: {
+							TextureInfo iridescenceThicknessTexture;
+							if (auto error = parseTextureInfo(field.value, &iridescenceThicknessTexture, config.extensions); error != Error::None) {
+								return error;
+							}
+							iridescence->iridescenceThicknessTexture = std::move(iridescenceThicknessTexture);
+							break;
+						}
+						default:
+							break;
+					}
 				}
 
 				material.iridescence = std::move(iridescence);
@@ -2780,47 +4201,41 @@ fg::Error fg::Parser::parseMaterialExtensions(simdjson::dom::object &object, fas
 				}
 
 				auto sheen = std::make_unique<MaterialSheen>();
-
-				dom::array sheenColorFactor;
-				if (auto error = sheenObject["sheenColorFactor"].get_array().get(sheenColorFactor); error ==
-																									SUCCESS) {
-					std::size_t i = 0;
-					for (auto factor: sheenColorFactor) {
-						if (i >= sheen->sheenColorFactor.size()) {
-							return Error::InvalidGltf;
+				for (auto field : sheenObject) {
+					switch (crcStringFunction(field.key)) {
+						case force_consteval<crc32c("sheenColorFactor")>: {
+							if (auto error = parseFactorArray(field.value, sheen->sheenColorFactor); error != Error::None) {
+								return error;
+							}
+							break;
 						}
-						double value;
-						if (factor.get_double().get(value) != SUCCESS) FASTGLTF_UNLIKELY {
-							return Error::InvalidGltf;
+						case force_consteval<crc32c("sheenColorTexture")>: {
+							TextureInfo sheenColorTexture;
+							if (auto error = parseTextureInfo(field.value, &sheenColorTexture, config.extensions); error != Error::None) {
+								return error;
+							}
+							sheen->sheenColorTexture = std::move(sheenColorTexture);
+							break;
+						}
+						case force_consteval<crc32c("sheenRoughnessFactor")>: {
+							double sheenRoughnessFactor;
+							if (field.value.get_double().get(sheenRoughnessFactor) != SUCCESS) FASTGLTF_UNLIKELY {
+								return Error::InvalidGltf;
+							}
+							sheen->sheenRoughnessFactor = static_cast<num>(sheenRoughnessFactor);
+							break;
+						}
+						case force_consteval<crc32c("sheenRoughnessTexture")>: {
+							TextureInfo sheenRoughnessTexture;
+							if (auto error = parseTextureInfo(field.value, &sheenRoughnessTexture, config.extensions); error != Error::None) {
+								return error;
+							}
+							sheen->sheenRoughnessTexture = std::move(sheenRoughnessTexture);
+							break;
 						}
-						sheen->sheenColorFactor[i++] = static_cast<num>(value);
+						default:
+							break;
 					}
-				} else if (error != NO_SUCH_FIELD) FASTGLTF_UNLIKELY {
-					return Error::InvalidGltf;
-				}
-
-				TextureInfo sheenColorTexture;
-				if (auto error = parseTextureInfo(sheenObject, "sheenColorTexture", &sheenColorTexture,
-												  config.extensions); error == Error::None) FASTGLTF_LIKELY {
-					sheen->sheenColorTexture = std::move(sheenColorTexture);
-				} else if (error != Error::MissingField) {
-					return error;
-				}
-
-				double sheenRoughnessFactor;
-				if (auto error = sheenObject["sheenRoughnessFactor"].get_double().get(sheenRoughnessFactor);
-						error == SUCCESS) FASTGLTF_LIKELY {
-					sheen->sheenRoughnessFactor = static_cast<num>(sheenRoughnessFactor);
-				} else if (error != NO_SUCH_FIELD) FASTGLTF_UNLIKELY {
-					return Error::InvalidGltf;
-				}
-
-				TextureInfo sheenRoughnessTexture;
-				if (auto error = parseTextureInfo(sheenObject, "sheenRoughnessTexture", &sheenRoughnessTexture,
-												  config.extensions); error == Error::None) FASTGLTF_LIKELY {
-					sheen->sheenRoughnessTexture = std::move(sheenRoughnessTexture);
-				} else if (error != Error::MissingField) {
-					return error;
 				}
 
 				material.sheen = std::move(sheen);
@@ -2837,47 +4252,41 @@ fg::Error fg::Parser::parseMaterialExtensions(simdjson::dom::object &object, fas
 				}
 
 				auto specular = std::make_unique<MaterialSpecular>();
-
-				double specularFactor;
-				if (auto error = specularObject["specularFactor"].get_double().get(specularFactor); error ==
-																									SUCCESS) {
-					specular->specularFactor = static_cast<num>(specularFactor);
-				} else if (error != NO_SUCH_FIELD) FASTGLTF_UNLIKELY {
-					return Error::InvalidGltf;
-				}
-
-				TextureInfo specularTexture;
-				if (auto error = parseTextureInfo(specularObject, "specularTexture", &specularTexture,
-												  config.extensions); error == Error::None) FASTGLTF_LIKELY {
-					specular->specularTexture = std::move(specularTexture);
-				} else if (error != Error::MissingField) {
-					return error;
-				}
-
-				dom::array specularColorFactor;
-				if (auto error = specularObject["specularColorFactor"].get_array().get(specularColorFactor);
-						error == SUCCESS) FASTGLTF_LIKELY {
-					std::size_t i = 0;
-					for (auto factor: specularColorFactor) {
-						if (i >= specular->specularColorFactor.size()) {
-							return Error::InvalidGltf;
+				for (auto field : specularObject) {
+					switch (crcStringFunction(field.key)) {
+						case force_consteval<crc32c("specularFactor")>: {
+							double specularFactor;
+							if (field.value.get_double().get(specularFactor) != SUCCESS) FASTGLTF_UNLIKELY {
+								return Error::InvalidGltf;
+							}
+							specular->specularFactor = static_cast<num>(specularFactor);
+							break;
 						}
-						double value;
-						if (factor.get_double().get(value) != SUCCESS) FASTGLTF_UNLIKELY {
-							return Error::InvalidGltf;
+						case force_consteval<crc32c("specularTexture")>: {
+							TextureInfo specularTexture;
+							if (auto error = parseTextureInfo(field.value, &specularTexture, config.extensions); error != Error::None) {
+								return error;
+							}
+							specular->specularTexture = std::move(specularTexture);
+							break;
 						}
-						specular->specularColorFactor[i++] = static_cast<num>(value);
+						case force_consteval<crc32c("specularColorFactor")>: {
+							if (auto error = parseFactorArray(field.value, specular->specularColorFactor); error != Error::None) {
+								return error;
+							}
+							break;
+						}
+						case force_consteval<crc32c("specularColorTexture")>: {
+							TextureInfo specularColorTexture;
+							if (auto error = parseTextureInfo(field.value, &specularColorTexture, config.extensions); error != Error::None) {
+								return error;
+							}
+							specular->specularColorTexture = std::move(specularColorTexture);
+							break;
+						}
+						default:
+							break;
 					}
-				} else if (error != NO_SUCH_FIELD) FASTGLTF_UNLIKELY {
-					return Error::InvalidGltf;
-				}
-
-				TextureInfo specularColorTexture;
-				if (auto error = parseTextureInfo(specularObject, "specularColorTexture", &specularColorTexture,
-												  config.extensions); error == Error::None) FASTGLTF_LIKELY {
-					specular->specularColorTexture = std::move(specularColorTexture);
-				} else if (error != Error::MissingField) {
-					return error;
 				}
 
 				material.specular = std::move(specular);
@@ -2894,21 +4303,27 @@ fg::Error fg::Parser::parseMaterialExtensions(simdjson::dom::object &object, fas
 				}
 
 				auto transmission = std::make_unique<MaterialTransmission>();
-
-				double transmissionFactor;
-				if (auto error = transmissionObject["transmissionFactor"].get_double().get(transmissionFactor);
-						error == SUCCESS) FASTGLTF_LIKELY {
-					transmission->transmissionFactor = static_cast<num>(transmissionFactor);
-				} else if (error != NO_SUCH_FIELD) FASTGLTF_UNLIKELY {
-					return Error::InvalidGltf;
-				}
-
-				TextureInfo transmissionTexture;
-				if (auto error = parseTextureInfo(transmissionObject, "transmissionTexture", &transmissionTexture,
-												  config.extensions); error == Error::None) FASTGLTF_LIKELY {
-					transmission->transmissionTexture = std::move(transmissionTexture);
-				} else if (error != Error::MissingField) {
-					return error;
+				for (auto field : transmissionObject) {
+					switch (crcStringFunction(field.key)) {
+						case force_consteval<crc32c("transmissionFactor")>: {
+							double transmissionFactor;
+							if (field.value.get_double().get(transmissionFactor) != SUCCESS) FASTGLTF_UNLIKELY {
+								return Error::InvalidGltf;
+							}
+							transmission->transmissionFactor = static_cast<num>(transmissionFactor);
+							break;
+						}
+						case force_consteval<crc32c("transmissionTexture")>: {
+							TextureInfo transmissionTexture;
+							if (auto error = parseTextureInfo(field.value, &transmissionTexture, config.extensions); error != Error::None) {
+								return error;
+							}
+							transmission->transmissionTexture = std::move(transmissionTexture);
+							break;
+						}
+						default:
+							break;
+					}
 				}
 
 				material.transmission = std::move(transmission);
@@ -2938,43 +4353,41 @@ fg::Error fg::Parser::parseMaterialExtensions(simdjson::dom::object &object, fas
 				}
 
 				auto volume = std::make_unique<MaterialVolume>();
-
-				double thicknessFactor;
-				if (auto error = volumeObject["thicknessFactor"].get_double().get(thicknessFactor); error == SUCCESS) FASTGLTF_LIKELY {
-					volume->thicknessFactor = static_cast<num>(thicknessFactor);
-				} else if (error != NO_SUCH_FIELD) FASTGLTF_UNLIKELY {
-					return Error::InvalidGltf;
-				}
-
-				TextureInfo thicknessTexture;
-				if (auto error = parseTextureInfo(volumeObject, "thicknessTexture", &thicknessTexture, config.extensions); error == Error::None) FASTGLTF_LIKELY {
-					volume->thicknessTexture = std::move(thicknessTexture);
-				} else if (error != Error::MissingField) {
-					return error;
-				}
-
-				double attenuationDistance;
-				if (auto error = volumeObject["attenuationDistance"].get_double().get(attenuationDistance); error == SUCCESS) FASTGLTF_LIKELY {
-					volume->attenuationDistance = static_cast<num>(attenuationDistance);
-				} else if (error != NO_SUCH_FIELD) FASTGLTF_UNLIKELY {
-					return Error::InvalidGltf;
-				}
-
-				dom::array attenuationColor;
-				if (auto error = volumeObject["attenuationColor"].get_array().get(attenuationColor); error == SUCCESS) FASTGLTF_LIKELY {
-					std::size_t i = 0;
-					for (auto factor : attenuationColor) {
-						if (i >= volume->attenuationColor.size()) {
-							return Error::InvalidGltf;
+				for (auto field : volumeObject) {
+					switch (crcStringFunction(field.key)) {
+						case force_consteval<crc32c("thicknessFactor")>: {
+							double thicknessFactor;
+							if (field.value.get_double().get(thicknessFactor) != SUCCESS) FASTGLTF_UNLIKELY {
+								return Error::InvalidGltf;
+							}
+							volume->thicknessFactor = static_cast<num>(thicknessFactor);
+							break;
 						}
-						double value;
-						if (factor.get_double().get(value) != SUCCESS) FASTGLTF_UNLIKELY {
-							return Error::InvalidGltf;
+						case force_consteval<crc32c("thicknessTexture")>: {
+							TextureInfo thicknessTexture;
+							if (auto error = parseTextureInfo(field.value, &thicknessTexture, config.extensions); error != Error::None) {
+								return error;
+							}
+							volume->thicknessTexture = std::move(thicknessTexture);
+							break;
+						}
+						case force_consteval<crc32c("attenuationDistance")>: {
+							double attenuationDistance;
+							if (field.value.get_double().get(attenuationDistance) != SUCCESS) FASTGLTF_UNLIKELY {
+								return Error::InvalidGltf;
+							}
+							volume->attenuationDistance = static_cast<num>(attenuationDistance);
+							break;
+						}
+						case force_consteval<crc32c("attenuationColor")>: {
+							if (auto error = parseFactorArray(field.value, volume->attenuationColor); error != Error::None) {
+								return error;
+							}
+							break;
 						}
-						(volume->attenuationColor)[i++] = static_cast<num>(value);
+						default:
+							break;
 					}
-				} else if (error != NO_SUCH_FIELD) FASTGLTF_UNLIKELY {
-					return Error::InvalidGltf;
 				}
 
 				material.volume = std::move(volume);
@@ -2988,11 +4401,15 @@ fg::Error fg::Parser::parseMaterialExtensions(simdjson::dom::object &object, fas
 				if (extensionField.value.get_object().get(normalRoughnessMetallic) != SUCCESS) FASTGLTF_UNLIKELY {
 					return Error::InvalidGltf;
 				}
-				TextureInfo textureInfo = {};
-				if (auto error = parseTextureInfo(normalRoughnessMetallic, "normalRoughnessMetallicTexture", &textureInfo, config.extensions); error == Error::None) FASTGLTF_LIKELY {
+
+				// Objects with a single known field are still looked up directly.
+				dom::element normalRoughnessMetallicTexture;
+				if (normalRoughnessMetallic["normalRoughnessMetallicTexture"].get(normalRoughnessMetallicTexture) == SUCCESS) FASTGLTF_LIKELY {
+					TextureInfo textureInfo = {};
+					if (auto error = parseTextureInfo(normalRoughnessMetallicTexture, &textureInfo, config.extensions); error != Error::None) {
+						return error;
+					}
 					material.packedNormalMetallicRoughnessTexture = std::move(textureInfo);
-				} else if (error != Error::MissingField) {
-					return error;
 				}
 				break;
 			}
@@ -3004,24 +4421,29 @@ fg::Error fg::Parser::parseMaterialExtensions(simdjson::dom::object &object, fas
 				if (extensionField.value.get_object().get(occlusionRoughnessMetallic) != SUCCESS) FASTGLTF_UNLIKELY {
 					return Error::InvalidGltf;
 				}
-				auto packedTextures = std::make_unique<MaterialPackedTextures>();
-				TextureInfo textureInfo = {};
-				if (auto error = parseTextureInfo(occlusionRoughnessMetallic, "occlusionRoughnessMetallicTexture", &textureInfo, config.extensions); error == Error::None) FASTGLTF_LIKELY {
-					packedTextures->occlusionRoughnessMetallicTexture = std::move(textureInfo);
-				} else if (error != Error::MissingField) {
-					return error;
-				}
 
-				if (auto error = parseTextureInfo(occlusionRoughnessMetallic, "roughnessMetallicOcclusionTexture", &textureInfo, config.extensions); error == Error::None) FASTGLTF_LIKELY {
-					packedTextures->roughnessMetallicOcclusionTexture = std::move(textureInfo);
-				} else if (error != Error::MissingField) {
-					return error;
-				}
+				auto packedTextures = std::make_unique<MaterialPackedTextures>();
+				for (auto field : occlusionRoughnessMetallic) {
+					Optional<TextureInfo>* target;
+					switch (crcStringFunction(field.key)) {
+						case force_consteval<crc32c("occlusionRoughnessMetallicTexture")>:
+							target = &packedTextures->occlusionRoughnessMetallicTexture;
+							break;
+						case force_consteval<crc32c("roughnessMetallicOcclusionTexture")>:
+							target = &packedTextures->roughnessMetallicOcclusionTexture;
+							break;
+						case force_consteval<crc32c("normalTexture")>:
+							target = &packedTextures->normalTexture;
+							break;
+						default:
+							continue;
+					}
 
-				if (auto error = parseTextureInfo(occlusionRoughnessMetallic, "normalTexture", &textureInfo, config.extensions); error == Error::None) FASTGLTF_LIKELY {
-					packedTextures->normalTexture = std::move(textureInfo);
-				} else if (error != Error::MissingField) {
-					return error;
+					TextureInfo textureInfo = {};
+					if (auto error = parseTextureInfo(field.value, &textureInfo, config.extensions); error != Error::None) {
+						return error;
+					}
+					*target = std::move(textureInfo);
 				}
 
 				material.packedOcclusionRoughnessMetallicTextures = std::move(packedTextures);
@@ -3037,61 +4459,49 @@ fg::Error fg::Parser::parseMaterialExtensions(simdjson::dom::object &object, fas
 				if (specularGlossinessError != SUCCESS) FASTGLTF_UNLIKELY {
 					return Error::InvalidGltf;
 				}
-				auto specularGlossiness = std::make_unique<MaterialSpecularGlossiness>();
 
-				dom::array diffuseFactor;
-				if (auto error = specularGlossinessObject["diffuseFactor"].get_array().get(diffuseFactor); error == SUCCESS) FASTGLTF_LIKELY {
-					std::size_t i = 0;
-					for (auto factor : diffuseFactor) {
-						if (i >= specularGlossiness->diffuseFactor.size()) {
-							return Error::InvalidGltf;
+				auto specularGlossiness = std::make_unique<MaterialSpecularGlossiness>();
+				for (auto field : specularGlossinessObject) {
+					switch (crcStringFunction(field.key)) {
+						case force_consteval<crc32c("diffuseFactor")>: {
+							if (auto error = parseFactorArray(field.value, specularGlossiness->diffuseFactor); error != Error::None) {
+								return error;
+							}
+							break;
 						}
-						double value;
-						if (factor.get_double().get(value) != SUCCESS) FASTGLTF_UNLIKELY {
-							return Error::InvalidGltf;
+						case force_consteval<crc32c("diffuseTexture")>: {
+							TextureInfo diffuseTexture;
+							if (auto error = parseTextureInfo(field.value, &diffuseTexture, config.extensions); error != Error::None) {
+								return error;
+							}
+							specularGlossiness->diffuseTexture = std::move(diffuseTexture);
+							break;
 						}
-						specularGlossiness->diffuseFactor[i++] = static_cast<num>(value);
-					}
-				} else if (error != NO_SUCH_FIELD) FASTGLTF_UNLIKELY {
-					return Error::InvalidGltf;
-				}
-
-				TextureInfo diffuseTexture;
-				if (auto error = parseTextureInfo(specularGlossinessObject, "diffuseTexture", &diffuseTexture, config.extensions); error == Error::None) FASTGLTF_LIKELY {
-					specularGlossiness->diffuseTexture = std::move(diffuseTexture);
-				} else if (error != Error::MissingField) {
-					return error;
-				}
-
-				dom::array specularFactor;
-				if (auto error = specularGlossinessObject["specularFactor"].get_array().get(specularFactor); error == SUCCESS) FASTGLTF_LIKELY {
-					std::size_t i = 0;
-					for (auto factor : specularFactor) {
-						if (i >= specularGlossiness->specularFactor.size()) {
-							return Error::InvalidGltf;
+						case force_consteval<crc32c("specularFactor")>: {
+							if (auto error = parseFactorArray(field.value, specularGlossiness->specularFactor); error != Error::None) {
+								return error;
+							}
+							break;
 						}
-						double value;
-						if (factor.get_double().get(value) != SUCCESS) FASTGLTF_UNLIKELY {
-							return Error::InvalidGltf;
+						case force_consteval<crc32c("glossinessFactor")>: {
+							double glossinessFactor;
+							if (field.value.get_double().get(glossinessFactor) != SUCCESS) FASTGLTF_UNLIKELY {
+								return Error::InvalidGltf;
+							}
+							specularGlossiness->glossinessFactor = static_cast<num>(glossinessFactor);
+							break;
+						}
+						case force_consteval<crc32c("specularGlossinessTexture")>: {
+							TextureInfo specularGlossinessTexture;
+							if (auto error = parseTextureInfo(field.value, &specularGlossinessTexture, config.extensions); error != Error::None) {
+								return error;
+							}
+							specularGlossiness->specularGlossinessTexture = std::move(specularGlossinessTexture);
+							break;
 						}
-						specularGlossiness->specularFactor[i++] = static_cast<num>(value);
+						default:
+							break;
 					}
-				} else if (error != NO_SUCH_FIELD) FASTGLTF_UNLIKELY {
-					return Error::InvalidGltf;
-				}
-
-				double glossinessFactor;
-				if (auto error = specularGlossinessObject["glossinessFactor"].get_double().get(glossinessFactor); error == SUCCESS) FASTGLTF_LIKELY {
-					specularGlossiness->glossinessFactor = static_cast<num>(glossinessFactor);
-				} else if (error != NO_SUCH_FIELD) FASTGLTF_UNLIKELY {
-					return Error::InvalidGltf;
-				}
-
-				TextureInfo specularGlossinessTexture;
-				if (auto error = parseTextureInfo(specularGlossinessObject, "specularGlossinessTexture", &specularGlossinessTexture, config.extensions); error == Error::None) FASTGLTF_LIKELY {
-					specularGlossiness->specularGlossinessTexture = std::move(specularGlossinessTexture);
-				} else if (error != Error::MissingField) {
-					return error;
 				}
 
 				material.specularGlossiness = std::move(specularGlossiness);
@@ -3118,140 +4528,173 @@ fg::Error fg::Parser::parseMaterials(simdjson::dom::array& materials, Asset& ass
         }
         Material material = {};
 
-        dom::array emissiveFactor;
-        if (auto error = materialObject["emissiveFactor"].get_array().get(emissiveFactor); error == SUCCESS) FASTGLTF_LIKELY {
-            if (emissiveFactor.size() != 3) {
-                return Error::InvalidGltf;
-            }
-            for (auto i = 0U; i < 3; ++i) {
-                double val;
-                if (emissiveFactor.at(i).get_double().get(val) != SUCCESS) FASTGLTF_UNLIKELY {
-                    return Error::InvalidGltf;
-                }
-                material.emissiveFactor[i] = static_cast<num>(val);
-            }
-        } else if (error != NO_SUCH_FIELD) FASTGLTF_UNLIKELY {
-            return Error::InvalidGltf;
-        }
+		dom::object extrasObject;
+		bool hasExtras = false;
+		for (auto field : materialObject) {
+			switch (crcStringFunction(field.key)) {
+				case force_consteval<crc32c("emissiveFactor")>: {
+					dom::array emissiveFactor;
+					if (field.value.get_array().get(emissiveFactor) != SUCCESS || emissiveFactor.size() != 3) FASTGLTF_UNLIKELY {
+						return Error::InvalidGltf;
+					}
+					for (auto i = 0U; i < 3; ++i) {
+						double val;
+						if (emissiveFactor.at(i).get_double().get(val) != SUCCESS) FASTGLTF_UNLIKELY {
+							return Error::InvalidGltf;
+						}
+						material.emissiveFactor[i] = static_cast<num>(val);
+					}
+					break;
+				}
+				case force_consteval<crc32c("normalTexture")>: {
+					NormalTextureInfo normalTextureInfo = {};
+					if (auto error = parseTextureInfo(field.value, &normalTextureInfo, config.extensions, TextureInfoType::NormalTexture); error != Error::None) {
+						return error;
+					}
+					material.normalTexture = std::move(normalTextureInfo);
+					break;
+				}
+				case force_consteval<crc32c("occlusionTexture")>: {
+					OcclusionTextureInfo occlusionTextureInfo = {};
+					if (auto error = parseTextureInfo(field.value, &occlusionTextureInfo, config.extensions, TextureInfoType::OcclusionTexture); error != Error::None) {
+						return error;
+					}
+					material.occlusionTexture = std::move(occlusionTextureInfo);
+					break;
+				}
+				case force_consteval<crc32c("emissiveTexture")>: {
+					TextureInfo textureInfo = {};
+					if (auto error = parseTextureInfo(field.value, &textureInfo, config.extensions); error != Error::None) {
+						return error;
+					}
+					material.emissiveTexture = std::move(textureInfo);
+					break;
+				}
+				case force_consteval<crc32c("pbrMetallicRoughness")>: {
+					dom::object pbrMetallicRoughness;
+					if (field.value.get_object().get(pbrMetallicRoughness) != SUCCESS)
+						break;
 
-	    {
-		    NormalTextureInfo normalTextureInfo = {};
-		    if (auto error = parseTextureInfo(materialObject, "normalTexture", &normalTextureInfo, config.extensions, TextureInfoType::NormalTexture); error == Error::None) FASTGLTF_LIKELY {
-			    material.normalTexture = std::move(normalTextureInfo);
-		    } else if (error != Error::MissingField) {
-			    return error;
-		    }
-	    }
-
-	    {
-			OcclusionTextureInfo occlusionTextureInfo = {};
-	        if (auto error = parseTextureInfo(materialObject, "occlusionTexture", &occlusionTextureInfo, config.extensions, TextureInfoType::OcclusionTexture); error == Error::None) FASTGLTF_LIKELY {
-	            material.occlusionTexture = std::move(occlusionTextureInfo);
-	        } else if (error != Error::MissingField) {
-	            return error;
-	        }
-	    }
-
-	    {
-		    TextureInfo textureInfo = {};
-	        if (auto error = parseTextureInfo(materialObject, "emissiveTexture", &textureInfo, config.extensions); error == Error::None) FASTGLTF_LIKELY {
-	            material.emissiveTexture = std::move(textureInfo);
-	        } else if (error != Error::MissingField) {
-	            return error;
-	        }
-	    }
-
-        dom::object pbrMetallicRoughness;
-        if (materialObject["pbrMetallicRoughness"].get_object().get(pbrMetallicRoughness) == SUCCESS) FASTGLTF_LIKELY {
-            PBRData pbr = {};
-
-            dom::array baseColorFactor;
-            if (pbrMetallicRoughness["baseColorFactor"].get_array().get(baseColorFactor) == SUCCESS) FASTGLTF_LIKELY {
-                for (auto i = 0U; i < 4; ++i) {
-                    double val;
-                    if (baseColorFactor.at(i).get_double().get(val) != SUCCESS) FASTGLTF_UNLIKELY {
-                        return Error::InvalidGltf;
-                    }
-                    pbr.baseColorFactor[i] = static_cast<num>(val);
-                }
-            }
+					PBRData pbr = {};
+					for (auto pbrField : pbrMetallicRoughness) {
+						switch (crcStringFunction(pbrField.key)) {
+							case force_consteval<crc32c("baseColorFactor")>: {
+								dom::array baseColorFactor;
+								if (pbrField.value.get_array().get(baseColorFactor) != SUCCESS)
+									break;
+								for (auto i = 0U; i < 4; ++i) {
+									double val;
+									if (baseColorFactor.at(i).get_double().get(val) != SUCCESS) FASTGLTF_UNLIKELY {
+										return Error::InvalidGltf;
+									}
+									pbr.baseColorFactor[i] = static_cast<num>(val);
+								}
+								break;
+							}
+							case force_consteval<crc32c("metallicFactor")>: {
+								double factor;
+								if (pbrField.value.get_double().get(factor) != SUCCESS) FASTGLTF_UNLIKELY {
+									return Error::InvalidGltf;
+								}
+								pbr.metallicFactor = static_cast<num>(factor);
+								break;
+							}
+							case force_consteval<crc32c("roughnessFactor")>: {
+								double factor;
+								if (pbrField.value.get_double().get(factor) != SUCCESS) FASTGLTF_UNLIKELY {
+									return Error::InvalidGltf;
+								}
+								pbr.roughnessFactor = static_cast<num>(factor);
+								break;
+							}
+							case force_consteval<crc32c("baseColorTexture")>: {
+								TextureInfo textureInfo;
+								if (auto error = parseTextureInfo(pbrField.value, &textureInfo, config.extensions); error != Error::None) {
+									return error;
+								}
+								pbr.baseColorTexture = std::move(textureInfo);
+								break;
+							}
+							case force_consteval<crc32c("metallicRoughnessTexture")>: {
+								TextureInfo textureInfo;
+								if (auto error = parseTextureInfo(pbrField.value, &textureInfo, config.extensions); error != Error::None) {
+									return error;
+								}
+								pbr.metallicRoughnessTexture = std::move(textureInfo);
+								break;
+							}
+							default:
+								break;
+						}
+					}
 
-            double factor;
-            if (auto error = pbrMetallicRoughness["metallicFactor"].get_double().get(factor); error == SUCCESS) FASTGLTF_LIKELY {
-                pbr.metallicFactor = static_cast<num>(factor);
-            } else if (error != NO_SUCH_FIELD) {
-				return Error::InvalidGltf;
+					material.pbrData = std::move(pbr);
+					break;
+				}
+				case force_consteval<crc32c("alphaMode")>: {
+					std::string_view alphaMode;
+					if (field.value.get_string().get(alphaMode) != SUCCESS) FASTGLTF_UNLIKELY {
+						return Error::InvalidGltf;
+					}
+					if (alphaMode == "OPAQUE") {
+						material.alphaMode = AlphaMode::Opaque;
+					} else if (alphaMode == "MASK") {
+						material.alphaMode = AlphaMode::Mask;
+					} else if (alphaMode == "BLEND") {
+						material.alphaMode = AlphaMode::Blend;
+					} else {
+						return Error::InvalidGltf;
+					}
+					break;
+				}
+				case force_consteval<crc32c("alphaCutoff")>: {
+					double alphaCutoff;
+					if (field.value.get_double().get(alphaCutoff) != SUCCESS) FASTGLTF_UNLIKELY {
+						return Error::InvalidGltf;
+					}
+					material.alphaCutoff = static_cast<num>(alphaCutoff);
+					break;
+				}
+				case force_consteval<crc32c("doubleSided")>: {
+					bool doubleSided;
+					if (field.value.get_bool().get(doubleSided) != SUCCESS) FASTGLTF_UNLIKELY {
+						return Error::InvalidGltf;
+					}
+					material.doubleSided = doubleSided;
+					break;
+				}
+				case force_consteval<crc32c("name")>: {
+					std::string_view name;
+					if (field.value.get_string().get(name) == SUCCESS) {
+						material.name = FASTGLTF_CONSTRUCT_PMR_RESOURCE(decltype(material.name), resourceAllocator.get(), name);
+					}
+					break;
+				}
+				case force_consteval<crc32c("extensions")>: {
+					dom::object extensionsObject;
+					if (field.value.get_object().get(extensionsObject) != SUCCESS) FASTGLTF_UNLIKELY {
+						return Error::InvalidJson;
+					}
+					parseMaterialExtensions(extensionsObject, material);
+					break;
+				}
+				case force_consteval<crc32c("extras")>: {
+					if (config.extrasCallback == nullptr)
+						break;
+					if (field.value.get_object().get(extrasObject) != SUCCESS) FASTGLTF_UNLIKELY {
+						return Error::InvalidGltf;
+					}
+					hasExtras = true;
+					break;
+				}
+				default:
+					break;
 			}
-            if (auto error = pbrMetallicRoughness["roughnessFactor"].get_double().get(factor); error == SUCCESS) FASTGLTF_LIKELY {
-                pbr.roughnessFactor = static_cast<num>(factor);
-            } else if (error != NO_SUCH_FIELD) {
-				return Error::InvalidGltf;
-			}
-
-	        TextureInfo textureInfo;
-            if (auto error = parseTextureInfo(pbrMetallicRoughness, "baseColorTexture", &textureInfo, config.extensions); error == Error::None) FASTGLTF_LIKELY {
-                pbr.baseColorTexture = std::move(textureInfo);
-            } else if (error != Error::MissingField) {
-                return error;
-            }
-
-            if (auto error = parseTextureInfo(pbrMetallicRoughness, "metallicRoughnessTexture", &textureInfo, config.extensions); error == Error::None) FASTGLTF_LIKELY {
-                pbr.metallicRoughnessTexture = std::move(textureInfo);
-            } else if (error != Error::MissingField) {
-                return error;
-            }
-
-            material.pbrData = std::move(pbr);
-        }
-
-        std::string_view alphaMode;
-        if (auto error = materialObject["alphaMode"].get_string().get(alphaMode); error == SUCCESS) FASTGLTF_LIKELY {
-            if (alphaMode == "OPAQUE") {
-                material.alphaMode = AlphaMode::Opaque;
-            } else if (alphaMode == "MASK") {
-                material.alphaMode = AlphaMode::Mask;
-            } else if (alphaMode == "BLEND") {
-                material.alphaMode = AlphaMode::Blend;
-            } else {
-                return Error::InvalidGltf;
-            }
-        } else if (error != NO_SUCH_FIELD) FASTGLTF_UNLIKELY {
-            return Error::InvalidGltf;
-        }
-
-        double alphaCutoff;
-        if (auto error = materialObject["alphaCutoff"].get_double().get(alphaCutoff); error == SUCCESS) FASTGLTF_LIKELY {
-            material.alphaCutoff = static_cast<num>(alphaCutoff);
-        } else if (error != NO_SUCH_FIELD) FASTGLTF_UNLIKELY {
-            return Error::InvalidGltf;
-        }
-
-        bool doubleSided;
-        if (auto error = materialObject["doubleSided"].get_bool().get(doubleSided); error == SUCCESS) FASTGLTF_LIKELY {
-            material.doubleSided = doubleSided;
-        } else if (error != NO_SUCH_FIELD) FASTGLTF_UNLIKELY {
-            return Error::InvalidGltf;
-        }
-
-        std::string_view name;
-        if (materialObject["name"].get_string().get(name) == SUCCESS) {
-	        material.name = FASTGLTF_CONSTRUCT_PMR_RESOURCE(decltype(material.name), resourceAllocator.get(), name);
-        }
-
-        dom::object extensionsObject;
-        if (auto extensionError = materialObject["extensions"].get_object().get(extensionsObject); extensionError == SUCCESS) {
-			parseMaterialExtensions(extensionsObject, material);
-        } else if (extensionError != NO_SUCH_FIELD) FASTGLTF_UNLIKELY {
-            return Error::InvalidJson;
-        }
+		}
 
-		if (config.extrasCallback != nullptr) {
-			dom::object extrasObject;
-			if (auto extrasError = materialObject["extras"].get_object().get(extrasObject); extrasError == SUCCESS) {
-				config.extrasCallback(&extrasObject, asset.materials.size(), Category::Materials, config.userPointer);
-			} else if (extrasError != NO_SUCH_FIELD) {
-				return Error::InvalidGltf;
-			}
+		// The extras callback is only invoked once the entire material has been parsed successfully.
+		if (hasExtras) {
+			config.extrasCallback(&extrasObject, asset.materials.size(), Category::Materials, config.userPointer);
 		}
 
 		asset.materials.emplace_back(std::move(material));
@@ -3454,6 +4897,10 @@ fg::Error fg::Parser::parseMeshes(simdjson::dom::array& meshes, Asset& asset) {
 	        mesh.name = FASTGLTF_CONSTRUCT_PMR_RESOURCE(decltype(mesh.name), resourceAllocator.get(), name);
         }
 
+		if (validateWhileParsing) {
+			if (auto error = validateMesh(asset, mesh); error != Error::None)
+				return error;
+		}
         asset.meshes.emplace_back(std::move(mesh));
     }
 
@@ -3471,84 +4918,147 @@ fg::Error fg::Parser::parseNodes(simdjson::dom::array& nodes, Asset& asset) {
             return Error::InvalidGltf;
         }
 
-        std::uint64_t index;
-        if (auto error = nodeObject["mesh"].get_uint64().get(index); error == SUCCESS) {
-            node.meshIndex = static_cast<std::size_t>(index);
-        } else if (error != NO_SUCH_FIELD) FASTGLTF_UNLIKELY {
-			return Error::InvalidGltf;
-		}
-        if (auto error = nodeObject["skin"].get_uint64().get(index); error == SUCCESS) {
-            node.skinIndex = static_cast<std::size_t>(index);
-        } else if (error != NO_SUCH_FIELD) FASTGLTF_UNLIKELY {
-			return Error::InvalidGltf;
-		}
-        if (auto error = nodeObject["camera"].get_uint64().get(index); error == SUCCESS) {
-            node.cameraIndex = static_cast<std::size_t>(index);
-        } else if (error != NO_SUCH_FIELD) FASTGLTF_UNLIKELY {
-			return Error::InvalidGltf;
+		// A matrix takes precedence over the TRS fields, so the transform is only built after all fields were seen.
+		dom::element matrixValue, scaleValue, translationValue, rotationValue;
+		dom::object extrasObject;
+		bool hasMatrix = false, hasScale = false, hasTranslation = false, hasRotation = false, hasExtras = false;
+		for (auto field : nodeObject) {
+			switch (crcStringFunction(field.key)) {
+				case force_consteval<crc32c("mesh")>: {
+					std::uint64_t index;
+					if (field.value.get_uint64().get(index) != SUCCESS) FASTGLTF_UNLIKELY {
+						return Error::InvalidGltf;
+					}
+					node.meshIndex = static_cast<std::size_t>(index);
+					break;
+				}
+				case force_consteval<crc32c("skin")>: {
+					std::uint64_t index;
+					if (field.value.get_uint64().get(index) != SUCCESS) FASTGLTF_UNLIKELY {
+						return Error::InvalidGltf;
+					}
+					node.skinIndex = static_cast<std::size_t>(index);
+					break;
+				}
+				case force_consteval<crc32c("camera")>: {
+					std::uint64_t index;
+					if (field.value.get_uint64().get(index) != SUCCESS) FASTGLTF_UNLIKELY {
+						return Error::InvalidGltf;
+					}
+					node.cameraIndex = static_cast<std::size_t>(index);
+					break;
+				}
+				case force_consteval<crc32c("children")>: {
+					dom::array array;
+					if (field.value.get_array().get(array) != SUCCESS) FASTGLTF_UNLIKELY {
+						return Error::InvalidJson;
+					}
+					node.children = FASTGLTF_CONSTRUCT_PMR_RESOURCE(decltype(node.children), resourceAllocator.get(), 0);
+					node.children.reserve(array.size());
+					for (auto childValue : array) {
+						std::uint64_t index;
+						if (childValue.get_uint64().get(index) != SUCCESS) FASTGLTF_UNLIKELY {
+							return Error::InvalidGltf;
+						}
+						node.children.emplace_back(static_cast<std::size_t>(index));
+					}
+					break;
+				}
+				case force_consteval<crc32c("weights")>: {
+					dom::array array;
+					if (field.value.get_array().get(array) != SUCCESS) FASTGLTF_UNLIKELY {
+						return Error::InvalidJson;
+					}
+					node.weights = FASTGLTF_CONSTRUCT_PMR_RESOURCE(decltype(node.weights), resourceAllocator.get(), 0);
+					node.weights.reserve(array.size());
+					for (auto weightValue : array) {
+						double val;
+						if (weightValue.get_double().get(val) != SUCCESS) FASTGLTF_UNLIKELY {
+							return Error::InvalidGltf;
+						}
+						node.weights.emplace_back(static_cast<num>(val));
+					}
+					break;
+				}
+				case force_consteval<crc32c("matrix")>:
+					matrixValue = field.value;
+					hasMatrix = true;
+					break;
+				case force_consteval<crc32c("scale")>:
+					scaleValue = field.value;
+					hasScale = true;
+					break;
+				case force_consteval<crc32c("translation")>:
+					translationValue = field.value;
+					hasTranslation = true;
+					break;
+				case force_consteval<crc32c("rotation")>:
+					rotationValue = field.value;
+					hasRotation = true;
+					break;
+				case force_consteval<crc32c("extensions")>: {
+					dom::object extensionsObject;
+					if (field.value.get_object().get(extensionsObject) != SUCCESS)
+						break;
+					if (auto error = parseNodeExtensions(extensionsObject, node); error != Error::None) {
+						return error;
+					}
+					break;
+				}
+				case force_consteval<crc32c("extras")>: {
+					if (config.extrasCallback == nullptr)
+						break;
+					if (field.value.get_object().get(extrasObject) != SUCCESS) FASTGLTF_UNLIKELY {
+						return Error::InvalidGltf;
+					}
+					hasExtras = true;
+					break;
+				}
+				case force_consteval<crc32c("name")>: {
+					std::string_view name;
+					if (field.value.get_string().get(name) == SUCCESS) {
+						node.name = FASTGLTF_CONSTRUCT_PMR_RESOURCE(decltype(node.name), resourceAllocator.get(), name);
+					}
+					break;
+				}
+				default:
+					break;
+			}
 		}
 
         dom::array array;
-        auto childError = getJsonArray(nodeObject, "children", &array);
-        if (childError == Error::None) FASTGLTF_LIKELY {
-	        node.children = FASTGLTF_CONSTRUCT_PMR_RESOURCE(decltype(node.children), resourceAllocator.get(), 0);
-			node.children.reserve(array.size());
-            for (auto childValue : array) {
-                if (childValue.get_uint64().get(index) != SUCCESS) FASTGLTF_UNLIKELY {
-                    return Error::InvalidGltf;
-                }
-
-                node.children.emplace_back(static_cast<std::size_t>(index));
-            }
-        } else if (childError != Error::MissingField) {
-            return childError;
-        }
-
-        auto weightsError = getJsonArray(nodeObject, "weights", &array);
-        if (weightsError != Error::MissingField) {
-            if (weightsError != Error::None) {
-	            node.weights = FASTGLTF_CONSTRUCT_PMR_RESOURCE(decltype(node.weights), resourceAllocator.get(), 0);
-                node.weights.reserve(array.size());
-                for (auto weightValue : array) {
-                    double val;
-                    if (weightValue.get_double().get(val) != SUCCESS) FASTGLTF_UNLIKELY {
-                        return Error::InvalidGltf;
-                    }
-                    node.weights.emplace_back(static_cast<num>(val));
-                }
-            } else {
-                return Error::InvalidGltf;
-            }
-        }
-
-        auto error = nodeObject["matrix"].get_array().get(array);
-        if (error == SUCCESS) FASTGLTF_LIKELY {
-            math::fmat4x4 transformMatrix;
-            std::size_t i = 0, j = 0;
-			for (auto num : array) {
-                double val;
-                if (num.get_double().get(val) != SUCCESS) FASTGLTF_UNLIKELY {
-                    break;
-                }
-				transformMatrix.col(i)[j++] = static_cast<fastgltf::num>(val);
-				if (j == 4) {
-					j = 0;
-					++i;
+        if (hasMatrix) {
+			if (matrixValue.get_array().get(array) == SUCCESS) FASTGLTF_LIKELY {
+				math::fmat4x4 transformMatrix;
+				std::size_t i = 0, j = 0;
+				for (auto num : array) {
+					double val;
+					if (num.get_double().get(val) != SUCCESS) FASTGLTF_UNLIKELY {
+						break;
+					}
+					transformMatrix.col(i)[j++] = static_cast<fastgltf::num>(val);
+					if (j == 4) {
+						j = 0;
+						++i;
+					}
 				}
-            }
 
-            if (hasBit(options, Options::DecomposeNodeMatrices)) {
-                TRS trs = {};
-                math::decomposeTransformMatrix(transformMatrix, trs.scale, trs.rotation, trs.translation);
-                node.transform = trs;
-            } else {
-                node.transform = transformMatrix;
-            }
-        } else if (error == NO_SUCH_FIELD) {
+				if (hasBit(options, Options::DecomposeNodeMatrices)) {
+					TRS trs = {};
+					math::decomposeTransformMatrix(transformMatrix, trs.scale, trs.rotation, trs.translation);
+					node.transform = trs;
+				} else {
+					node.transform = transformMatrix;
+				}
+			}
+        } else {
             TRS trs = {};
 
             // There's no matrix, let's see if there's scale, rotation, or rotation fields.
-            if (auto scaleError = nodeObject["scale"].get_array().get(array); scaleError == SUCCESS) FASTGLTF_LIKELY {
+            if (hasScale) {
+	            if (scaleValue.get_array().get(array) != SUCCESS) FASTGLTF_UNLIKELY {
+					return Error::InvalidJson;
+				}
                 auto i = 0U;
                 for (auto num : array) {
                     double val;
@@ -3558,11 +5068,12 @@ fg::Error fg::Parser::parseNodes(simdjson::dom::array& nodes, Asset& asset) {
                     trs.scale[i] = static_cast<fastgltf::num>(val);
                     ++i;
                 }
-            } else if (scaleError != NO_SUCH_FIELD) FASTGLTF_UNLIKELY {
-                return Error::InvalidJson;
             }
 
-            if (auto translationError = nodeObject["translation"].get_array().get(array); translationError == SUCCESS) FASTGLTF_LIKELY {
+            if (hasTranslation) {
+	            if (translationValue.get_array().get(array) != SUCCESS) FASTGLTF_UNLIKELY {
+					return Error::InvalidGltf;
+				}
                 auto i = 0U;
                 for (auto num : array) {
                     double val;
@@ -3572,11 +5083,12 @@ fg::Error fg::Parser::parseNodes(simdjson::dom::array& nodes, Asset& asset) {
                     trs.translation[i] = static_cast<fastgltf::num>(val);
                     ++i;
                 }
-            } else if (translationError != NO_SUCH_FIELD) FASTGLTF_UNLIKELY {
-                return Error::InvalidGltf;
             }
 
-            if (auto rotationError = nodeObject["rotation"].get_array().get(array); rotationError == SUCCESS) FASTGLTF_LIKELY {
+            if (hasRotation) {
+	            if (rotationValue.get_array().get(array) != SUCCESS) FASTGLTF_UNLIKELY {
+					return Error::InvalidGltf;
+				}
                 auto i = 0U;
                 for (auto num : array) {
                     double val;
@@ -3586,63 +5098,70 @@ fg::Error fg::Parser::parseNodes(simdjson::dom::array& nodes, Asset& asset) {
                     trs.rotation[i] = static_cast<fastgltf::num>(val);
                     ++i;
                 }
-            } else if (rotationError != NO_SUCH_FIELD) FASTGLTF_UNLIKELY {
-                return Error::InvalidGltf;
             }
 
             node.transform = trs;
         }
 
-        dom::object extensionsObject;
-        if (nodeObject["extensions"].get_object().get(extensionsObject) == SUCCESS) FASTGLTF_LIKELY {
-			if (hasBit(config.extensions, Extensions::KHR_lights_punctual)) {
+		if (hasExtras) {
+			config.extrasCallback(&extrasObject, asset.nodes.size(), Category::Nodes, config.userPointer);
+		}
+
+		if (validateWhileParsing) {
+			if (auto error = validateNode(asset, node); error != Error::None)
+				return error;
+		}
+        asset.nodes.emplace_back(std::move(node));
+    }
+
+	return Error::None;
+}
+
+fg::Error fg::Parser::parseNodeExtensions(simdjson::dom::object& object, Node& node) {
+	using namespace simdjson;
+
+	for (auto extension : object) {
+		switch (crcStringFunction(extension.key)) {
+			case force_consteval<crc32c(extensions::KHR_lights_punctual)>: {
+				if (!hasBit(config.extensions, Extensions::KHR_lights_punctual))
+					break;
+
 				dom::object lightsObject;
-				if (extensionsObject[extensions::KHR_lights_punctual].get_object().get(lightsObject) == SUCCESS) FASTGLTF_LIKELY {
-					std::uint64_t light;
-					if (auto lightError = lightsObject["light"].get_uint64().get(light); lightError == SUCCESS) FASTGLTF_LIKELY {
-						node.lightIndex = static_cast<std::size_t>(light);
-					} else {
-						return lightError == NO_SUCH_FIELD || lightError == INCORRECT_TYPE ? Error::InvalidGltf : Error::InvalidJson;
-					}
-				} else if (error != NO_SUCH_FIELD) {
+				if (extension.value.get_object().get(lightsObject) != SUCCESS) FASTGLTF_UNLIKELY {
 					return Error::InvalidGltf;
 				}
+
+				std::uint64_t light;
+				if (auto lightError = lightsObject["light"].get_uint64().get(light); lightError == SUCCESS) FASTGLTF_LIKELY {
+					node.lightIndex = static_cast<std::size_t>(light);
+				} else {
+					return lightError == NO_SUCH_FIELD || lightError == INCORRECT_TYPE ? Error::InvalidGltf : Error::InvalidJson;
+				}
+				break;
 			}
+			case force_consteval<crc32c(extensions::EXT_mesh_gpu_instancing)>: {
+				if (!hasBit(config.extensions, Extensions::EXT_mesh_gpu_instancing))
+					break;
 
-			if (hasBit(config.extensions, Extensions::EXT_mesh_gpu_instancing)) {
 				dom::object gpuInstancingObject;
-				if (auto instancingError = extensionsObject[extensions::EXT_mesh_gpu_instancing].get_object().get(gpuInstancingObject); instancingError == SUCCESS) FASTGLTF_LIKELY {
-					dom::object attributesObject;
-
-					if (gpuInstancingObject["attributes"].get_object().get(attributesObject) != SUCCESS) FASTGLTF_UNLIKELY {
-						return Error::InvalidGltf;
-					}
+				if (extension.value.get_object().get(gpuInstancingObject) != SUCCESS) FASTGLTF_UNLIKELY {
+					return Error::InvalidGltf;
+				}
 
-					if (auto attributesError = parseAttributes(attributesObject, node.instancingAttributes); attributesError != Error::None) {
-						return attributesError;
-					}
-				} else if (instancingError != NO_SUCH_FIELD) {
+				dom::object attributesObject;
+				if (gpuInstancingObject["attributes"].get_object().get(attributesObject) != SUCCESS) FASTGLTF_UNLIKELY {
 					return Error::InvalidGltf;
 				}
-			}
-        }
 
-		if (config.extrasCallback != nullptr) {
-			dom::object extrasObject;
-			if (auto extrasError = nodeObject["extras"].get_object().get(extrasObject); extrasError == SUCCESS) {
-				config.extrasCallback(&extrasObject, asset.nodes.size(), Category::Nodes, config.userPointer);
-			} else if (extrasError != NO_SUCH_FIELD) {
-				return Error::InvalidGltf;
+				if (auto attributesError = parseAttributes(attributesObject, node.instancingAttributes); attributesError != Error::None) {
+					return attributesError;
+				}
+				break;
 			}
+			default:
+				break;
 		}
-
-        std::string_view name;
-        if (nodeObject["name"].get_string().get(name) == SUCCESS) {
-	        node.name = FASTGLTF_CONSTRUCT_PMR_RESOURCE(decltype(node.name), resourceAllocator.get(), name);
-        }
-
-        asset.nodes.emplace_back(std::move(node));
-    }
+	}
 
 	return Error::None;
 }
@@ -3893,16 +5412,92 @@ fg::Parser::Parser(Extensions extensionsToLoad) noexcept {
     config.extensions = extensionsToLoad;
 }
 
-fg::Parser::Parser(Parser&& other) noexcept : jsonParser(std::move(other.jsonParser)), config(other.config) {}
+fg::Parser::Parser(Parser&& other) noexcept : jsonParser(std::move(other.jsonParser)), config(other.config),
+		glbBuffer(std::move(other.glbBuffer)),
+#if !FASTGLTF_DISABLE_CUSTOM_MEMORY_POOL
+		resourceAllocator(std::move(other.resourceAllocator)), upstreamResource(other.upstreamResource),
+#endif
+		directory(std::move(other.directory)), options(other.options), deferredFileLoads(std::move(other.deferredFileLoads)) {}
 
 fg::Parser& fg::Parser::operator=(Parser&& other) noexcept {
     jsonParser = std::move(other.jsonParser);
     config = other.config;
+	glbBuffer = std::move(other.glbBuffer);
+#if !FASTGLTF_DISABLE_CUSTOM_MEMORY_POOL
+	resourceAllocator = std::move(other.resourceAllocator);
+	upstreamResource = other.upstreamResource;
+#endif
+	directory = std::move(other.directory);
+	options = other.options;
+	deferredFileLoads = std::move(other.deferredFileLoads);
     return *this;
 }
 
 fg::Parser::~Parser() = default;
 
+namespace fastgltf {
+	/** The number of threads currently spawned by all calls to executeTasks without an executor. */
+	static std::atomic_size_t spawnedTaskThreads = 0;
+
+	/**
+	 * Reserves up to the given number of threads, so that concurrent and nested calls to executeTasks
+	 * together never spawn more threads than there are hardware threads besides the calling one.
+	 */
+	static std::size_t reserveTaskThreads(std::size_t count) noexcept {
+		const auto limit = static_cast<std::size_t>(std::max(std::thread::hardware_concurrency(), 1U)) - 1;
+		auto spawned = spawnedTaskThreads.load(std::memory_order_relaxed);
+		std::size_t reserved;
+		do {
+			reserved = std::min(count, spawned < limit ? limit - spawned : 0);
+			if (reserved == 0)
+				return 0;
+		} while (!spawnedTaskThreads.compare_exchange_weak(spawned, spawned + reserved, std::memory_order_relaxed));
+		return reserved;
+	}
+} // namespace fastgltf
+
+void fg::executeTasks(std::size_t taskCount, TaskFunction* task, void* taskData, TaskExecutorCallback* executor, void* userPointer) {
+	if (taskCount == 0)
+		return;
+
+	if (executor != nullptr) {
+		executor(taskCount, task, taskData, userPointer);
+		return;
+	}
+
+	// Every thread, including the calling one, keeps taking the next task until all tasks have been taken.
+	std::atomic_size_t nextTask = 0;
+	auto worker = [&nextTask, taskCount, task, taskData]() {
+		for (auto i = nextTask.fetch_add(1, std::memory_order_relaxed); i < taskCount; i = nextTask.fetch_add(1, std::memory_order_relaxed)) {
+			task(i, taskData);
+		}
+	};
+
+	const auto reservedThreads = reserveTaskThreads(taskCount - 1);
+	std::vector<std::thread> threads;
+#ifdef __cpp_exceptions
+	try {
+#endif
+		threads.reserve(reservedThreads);
+		for (std::size_t i = 0; i < reservedThreads; ++i) {
+			threads.emplace_back(worker);
+		}
+#ifdef __cpp_exceptions
+	} catch (const std::exception&) {
+		// If no more threads can be created, the calling thread simply takes the remaining tasks.
+	}
+#endif
+	worker();
+	for (auto& thread : threads) {
+		thread.join();
+	}
+	spawnedTaskThreads.fetch_sub(reservedThreads, std::memory_order_relaxed);
+}
+
+void fg::Parser::executeTasks(std::size_t taskCount, TaskFunction* task, void* taskData) const {
+	fastgltf::executeTasks(taskCount, task, taskData, config.executorCallback, config.userPointer);
+}
+
 fg::Expected<fg::Asset> fg::Parser::loadGltf(GltfDataGetter& data, fs::path _directory, Options _options, Category categories) {
     auto type = fastgltf::determineGltfFileType(data);
 
@@ -3917,173 +5512,842 @@ fg::Expected<fg::Asset> fg::Parser::loadGltf(GltfDataGetter& data, fs::path _dir
     return Error::InvalidFileData;
 }
 
-fg::Expected<fg::Asset> fg::Parser::loadGltfJson(GltfDataGetter& data, fs::path _directory, Options _options, Category categories) {
-    using namespace simdjson;
+fg::Expected<fg::Asset> fg::Parser::loadGltfJson(GltfDataGetter& data, fs::path _directory, Options _options, Category categories) {
+    using namespace simdjson;
+	FASTGLTF_PROFILE_STAGE(loadScope, ParseStage::Load);
+	FASTGLTF_PROFILE_COUNTS(loadScope, data.totalSize(), 0);
+
+	options = _options;
+	directory = std::move(_directory);
+
+#if !defined(__ANDROID__)
+    // If we never have to load the files ourselves, we're fine with the directory being invalid/blank.
+    if (std::error_code ec; (hasBit(_options, Options::LoadExternalBuffers) || hasBit(_options, Options::MapExternalBuffers)) && (!fs::is_directory(directory, ec) || ec)) {
+        return Error::InvalidPath;
+    }
+#endif
+
+	data.reset();
+	span<std::byte> jsonSpan;
+	{
+		FASTGLTF_PROFILE_STAGE(readScope, ParseStage::ReadJson);
+		FASTGLTF_PROFILE_COUNTS(readScope, data.totalSize(), 0);
+		jsonSpan = data.read(data.totalSize(), SIMDJSON_PADDING);
+	}
+	if (auto error = data.readError(); error != Error::None) {
+		return error;
+	}
+	padded_string_view view(reinterpret_cast<const std::uint8_t*>(jsonSpan.data()),
+									  data.totalSize(),
+									  data.totalSize() + SIMDJSON_PADDING);
+	DomRoot domRoot;
+	OnDemandRoot onDemandRoot;
+	const bool onDemand = isParsedOnDemand(options);
+	{
+		FASTGLTF_PROFILE_STAGE(jsonScope, ParseStage::ParseJson);
+		FASTGLTF_PROFILE_COUNTS(jsonScope, data.totalSize(), 0);
+		if (onDemand) {
+			if (auto error = onDemandRoot.split(view, jsonParser.get()); error != Error::None) {
+				return error;
+			}
+		} else if (auto error = jsonParser->parse(view).get(domRoot.object); error != SUCCESS) FASTGLTF_UNLIKELY {
+			return Error::InvalidJson;
+		}
+	}
+
+	if (onDemand) {
+		return parse(onDemandRoot, data.totalSize(), categories);
+	}
+	return parse(domRoot, data.totalSize(), categories);
+}
+
+fg::Expected<fg::Asset> fg::Parser::loadGltfBinary(GltfDataGetter& data, fs::path _directory, Options _options, Category categories) {
+    using namespace simdjson;
+	FASTGLTF_PROFILE_STAGE(loadScope, ParseStage::Load);
+	FASTGLTF_PROFILE_COUNTS(loadScope, data.totalSize(), 0);
+
+	options = _options;
+	directory = std::move(_directory);
+
+    // If we never have to load the files ourselves, we're fine with the directory being invalid/blank.
+    if (std::error_code ec; (hasBit(options, Options::LoadExternalBuffers) || hasBit(options, Options::MapExternalBuffers)) && (!fs::is_directory(directory, ec) || ec)) {
+	    return Error::InvalidPath;
+    }
+
+	data.reset();
+
+    auto header = readBinaryHeader(data);
+    if (header.magic != binaryGltfHeaderMagic) {
+	    return Error::InvalidGLB;
+    }
+	if (header.version != 2) {
+		return Error::UnsupportedVersion;
+	}
+    if (header.length > data.totalSize()) {
+	    return Error::InvalidGLB;
+    }
+
+    // The glTF 2 spec specifies that in GLB files the order of chunks is predefined. Specifically,
+    //  1. JSON chunk
+    //  2. BIN chunk (optional)
+    auto jsonChunk = readBinaryChunk(data);
+    if (jsonChunk.chunkType != binaryGltfJsonChunkMagic) {
+	    return Error::InvalidGLB;
+    }
+
+    // Create a string view of the JSON chunk in the GLB data buffer. The documentation of parse()
+    // says the padding can be initialised to anything, apparently. Therefore, this should work.
+	span<std::byte> jsonSpan;
+	{
+		FASTGLTF_PROFILE_STAGE(readScope, ParseStage::ReadJson);
+		FASTGLTF_PROFILE_COUNTS(readScope, jsonChunk.chunkLength, 0);
+		jsonSpan = data.read(jsonChunk.chunkLength, SIMDJSON_PADDING);
+	}
+    simdjson::padded_string_view jsonChunkView(reinterpret_cast<const std::uint8_t*>(jsonSpan.data()),
+                                               jsonChunk.chunkLength,
+                                               jsonChunk.chunkLength + SIMDJSON_PADDING);
+
+	DomRoot domRoot;
+	OnDemandRoot onDemandRoot;
+	const bool onDemand = isParsedOnDemand(options);
+	{
+		FASTGLTF_PROFILE_STAGE(jsonScope, ParseStage::ParseJson);
+		FASTGLTF_PROFILE_COUNTS(jsonScope, jsonChunk.chunkLength, 0);
+		if (onDemand) {
+			if (auto error = onDemandRoot.split(jsonChunkView, jsonParser.get()); error != Error::None) {
+				return error;
+			}
+		} else if (jsonParser->parse(jsonChunkView).get(domRoot.object) != SUCCESS) FASTGLTF_UNLIKELY {
+			return Error::InvalidJson;
+		}
+	}
+
+    // Is there enough room for another chunk header?
+    if (header.length > (data.bytesRead() + sizeof(BinaryGltfChunk))) {
+        auto binaryChunk = readBinaryChunk(data);
+
+        if (binaryChunk.chunkType != binaryGltfDataChunkMagic) {
+	        return Error::InvalidGLB;
+        }
+
+		if (binaryChunk.chunkLength > data.totalSize() - data.bytesRead()) {
+			return Error::InvalidGLB;
+		}
+
+		if (binaryChunk.chunkLength != 0) {
+			FASTGLTF_PROFILE_STAGE(binaryScope, ParseStage::ReadBinaryChunk);
+			FASTGLTF_PROFILE_COUNTS(binaryScope, binaryChunk.chunkLength, 0);
+
+			// The GLB buffer might be able to just reference the bytes of the data getter.
+			span<const std::byte> persistentBytes;
+			if (hasBit(options, Options::ReferenceGLBBuffer)) {
+				persistentBytes = data.persistentBytes();
+			}
+
+			if (hasBit(options, Options::SkipGLBBuffer)) {
+				sources::URI chunkSource;
+				chunkSource.fileByteOffset = data.bytesRead();
+				chunkSource.mimeType = MimeType::GltfBuffer;
+				glbBuffer = std::move(chunkSource);
+			} else if (!persistentBytes.empty()) {
+				glbBuffer = sources::ByteView {
+					persistentBytes.subspan(data.bytesRead(), binaryChunk.chunkLength),
+					MimeType::GltfBuffer,
+				};
+			} else if (config.mapCallback != nullptr) {
+				auto info = config.mapCallback(binaryChunk.chunkLength, config.userPointer);
+				if (info.mappedMemory != nullptr) {
+					data.read(info.mappedMemory, binaryChunk.chunkLength);
+					if (config.unmapCallback != nullptr) {
+						config.unmapCallback(&info, config.userPointer);
+					}
+					glbBuffer = sources::CustomBuffer{info.customId, MimeType::None};
+				}
+			} else {
+				StaticVector<std::byte> binaryData(binaryChunk.chunkLength);
+				data.read(binaryData.data(), binaryChunk.chunkLength);
+
+				sources::Array vectorData = {
+					std::move(binaryData),
+					MimeType::GltfBuffer,
+				};
+				glbBuffer = std::move(vectorData);
+			}
+		}
+    }
+
+	if (auto error = data.readError(); error != Error::None) {
+		return error;
+	}
+
+	if (onDemand) {
+		return parse(onDemandRoot, jsonChunk.chunkLength, categories);
+	}
+	return parse(domRoot, jsonChunk.chunkLength, categories);
+}
+
+fg::Expected<fg::Asset> fg::Parser::loadGltf(std::shared_ptr<GltfDataGetter> data, fs::path _directory, Options _options, Category categories) {
+	auto asset = loadGltf(*data, std::move(_directory), _options, categories);
+	if (asset.error() == Error::None) {
+		asset->dataGetter = std::move(data);
+	}
+	return asset;
+}
+
+fg::Expected<fg::Asset> fg::Parser::loadGltfBinary(std::shared_ptr<GltfDataGetter> data, fs::path _directory, Options _options, Category categories) {
+	auto asset = loadGltfBinary(*data, std::move(_directory), _options, categories);
+	if (asset.error() == Error::None) {
+		asset->dataGetter = std::move(data);
+	}
+	return asset;
+}
+
+std::future<fg::Expected<fg::Asset>> fg::Parser::loadGltfAsync(std::shared_ptr<GltfDataGetter> data, fs::path _directory, Options _options, Category categories) {
+	return std::async(std::launch::async, [this, data = std::move(data), _directory = std::move(_directory), _options, categories]() mutable {
+		return loadGltf(std::move(data), std::move(_directory), _options, categories);
+	});
+}
+
+void fg::Parser::setBufferAllocationCallback(BufferMapCallback* mapCallback, BufferUnmapCallback* unmapCallback) noexcept {
+	if (mapCallback == nullptr)
+		unmapCallback = nullptr;
+	config.mapCallback = mapCallback;
+	config.unmapCallback = unmapCallback;
+}
+
+void fg::Parser::setBase64DecodeCallback(Base64DecodeCallback* decodeCallback) noexcept {
+    config.decodeCallback = decodeCallback;
+}
+
+void fg::Parser::setExtrasParseCallback(ExtrasParseCallback *extrasCallback) noexcept {
+	config.extrasCallback = extrasCallback;
+}
+
+void fg::Parser::setTaskExecutorCallback(TaskExecutorCallback* executorCallback) noexcept {
+	config.executorCallback = executorCallback;
+}
+
+void fg::Parser::setDracoDecodeCallback(DracoDecodeCallback* dracoCallback) noexcept {
+	config.dracoCallback = dracoCallback;
+}
+
+#if FASTGLTF_ENABLE_PROFILING
+void fg::Parser::setProfilingCallback(ProfilingCallback* profilingCallback) noexcept {
+	config.profilingCallback = profilingCallback;
+}
+#endif
+
+void fg::Parser::setUserPointer(void* pointer) noexcept {
+    config.userPointer = pointer;
+}
+
+#if !FASTGLTF_DISABLE_CUSTOM_MEMORY_POOL
+void fg::Parser::setUpstreamMemoryResource(std::pmr::memory_resource* resource) noexcept {
+	upstreamResource = resource;
+}
+#endif
+
+void fg::Parser::reserveJsonBuffers(std::size_t capacity) {
+	// A failed allocation is no error here, as the parser tries again once it actually needs the memory.
+	if (capacity != 0) {
+		[[maybe_unused]] auto error = jsonParser->allocate(capacity);
+	}
+}
+
+void fg::Parser::shrinkJsonBuffers(std::size_t maxCapacity) {
+	if (jsonParser->capacity() <= maxCapacity)
+		return;
+
+	// simdjson never shrinks its buffers, so the parser is replaced instead.
+	jsonParser = std::make_unique<simdjson::dom::parser>();
+	reserveJsonBuffers(maxCapacity);
+}
+
+struct fg::ParserPool::LoadTaskData {
+	ParserPool* pool;
+	std::size_t count;
+	Options options;
+	Category categories;
+
+	span<GltfDataGetter* const> data;
+	span<const fs::path> paths;
+	Expected<Asset> (*loadFile)(Parser& parser, std::size_t index, const LoadTaskData& data);
+
+	Expected<Asset>* results = nullptr;
+	std::atomic_size_t nextFile = 0;
+};
+
+fg::ParserPool::ParserPool(Extensions extensionsToLoad, std::size_t parserCount, std::size_t _retainedJsonCapacity)
+		: retainedJsonCapacity(_retainedJsonCapacity) {
+	if (parserCount == 0)
+		parserCount = std::max(std::thread::hardware_concurrency(), 1U);
+
+	parsers.reserve(parserCount);
+	for (std::size_t i = 0; i < parserCount; ++i) {
+		parsers.emplace_back(extensionsToLoad);
+		parsers.back().reserveJsonBuffers(retainedJsonCapacity);
+	}
+}
+
+std::vector<fg::Expected<fg::Asset>> fg::ParserPool::load(LoadTaskData& data) {
+	std::vector<Expected<Asset>> results;
+	results.reserve(data.count);
+	for (std::size_t i = 0; i < data.count; ++i)
+		results.emplace_back(Error::None);
+	data.results = results.data();
+
+	// Every task owns one parser, and keeps loading the next file until all have been taken.
+	executeTasks(std::min(parsers.size(), data.count), [](std::size_t taskIndex, void* taskData) {
+		auto& load = *static_cast<LoadTaskData*>(taskData);
+		auto& parser = load.pool->parsers[taskIndex];
+		for (auto i = load.nextFile.fetch_add(1, std::memory_order_relaxed); i < load.count; i = load.nextFile.fetch_add(1, std::memory_order_relaxed)) {
+			load.results[i] = load.loadFile(parser, i, load);
+			parser.shrinkJsonBuffers(load.pool->retainedJsonCapacity);
+		}
+	}, &data, executorCallback, userPointer);
+	return results;
+}
+
+std::vector<fg::Expected<fg::Asset>> fg::ParserPool::loadGltfs(span<GltfDataGetter* const> data,
+		span<const fs::path> directories, Options options, Category categories) {
+	assert(data.size() == directories.size());
+	LoadTaskData taskData { this, data.size(), options, categories, data, directories };
+	taskData.loadFile = [](Parser& parser, std::size_t index, const LoadTaskData& load) {
+		return parser.loadGltf(*load.data[index], load.paths[index], load.options, load.categories);
+	};
+	return load(taskData);
+}
+
+std::vector<fg::Expected<fg::Asset>> fg::ParserPool::loadGltfs(span<const fs::path> paths, Options options, Category categories) {
+	LoadTaskData taskData { this, paths.size(), options, categories, {}, paths };
+	taskData.loadFile = [](Parser& parser, std::size_t index, const LoadTaskData& load) -> Expected<Asset> {
+		const auto& path = load.paths[index];
+#if defined(FASTGLTF_HAS_MEMORY_MAPPED_FILE)
+		using FileType = MappedGltfFile;
+#else
+		using FileType = GltfDataBuffer;
+#endif
+		auto file = FileType::FromPath(path);
+		if (file.error() != Error::None)
+			return file.error();
+
+		// The asset may reference the file's memory with Options::ReferenceGLBBuffer, so it has to share ownership.
+		return parser.loadGltf(std::make_shared<FileType>(std::move(file.get())), path.parent_path(),
+			load.options, load.categories);
+	};
+	return load(taskData);
+}
+
+void fg::ParserPool::setBufferAllocationCallback(BufferMapCallback* mapCallback, BufferUnmapCallback* unmapCallback) noexcept {
+	for (auto& parser : parsers)
+		parser.setBufferAllocationCallback(mapCallback, unmapCallback);
+}
+
+void fg::ParserPool::setBase64DecodeCallback(Base64DecodeCallback* decodeCallback) noexcept {
+	for (auto& parser : parsers)
+		parser.setBase64DecodeCallback(decodeCallback);
+}
+
+void fg::ParserPool::setExtrasParseCallback(ExtrasParseCallback* extrasCallback) noexcept {
+	for (auto& parser : parsers)
+		parser.setExtrasParseCallback(extrasCallback);
+}
+
+void fg::ParserPool::setDracoDecodeCallback(DracoDecodeCallback* dracoCallback) noexcept {
+	for (auto& parser : parsers)
+		parser.setDracoDecodeCallback(dracoCallback);
+}
+
+#if FASTGLTF_ENABLE_PROFILING
+void fg::ParserPool::setProfilingCallback(ProfilingCallback* profilingCallback) noexcept {
+	for (auto& parser : parsers)
+		parser.setProfilingCallback(profilingCallback);
+}
+#endif
+
+void fg::ParserPool::setTaskExecutorCallback(TaskExecutorCallback* _executorCallback) noexcept {
+	executorCallback = _executorCallback;
+	for (auto& parser : parsers)
+		parser.setTaskExecutorCallback(_executorCallback);
+}
+
+void fg::ParserPool::setUserPointer(void* pointer) noexcept {
+	userPointer = pointer;
+	for (auto& parser : parsers)
+		parser.setUserPointer(pointer);
+}
+#pragma endregion
+
+#pragma region Asset cache
+namespace fastgltf {
+	struct AssetCacheHeader {
+		std::uint32_t magic;
+		std::uint32_t version;
+		std::uint32_t layoutHash;
+		std::uint32_t payloadHash;
+		std::uint64_t sourceHash;
+		std::uint64_t payloadSize;
+	};
+	static_assert(sizeof(AssetCacheHeader) == 32);
+
+	static constexpr std::uint32_t assetCacheMagic = 0x43414746; // "FGAC" on little-endian platforms
+	static constexpr std::uint32_t assetCacheVersion = 1;
+
+	// Alignment of embedded buffers and images, relative to the start of the cache.
+	static constexpr std::size_t assetCacheDataAlignment = 16;
+
+	/**
+	 * The cache stores all values with their native size and byte order. Hashing the sizes of the serialized
+	 * types rejects caches from builds with a different configuration, like FASTGLTF_USE_64BIT_FLOAT, or from
+	 * a different platform. The magic also won't match when the byte order differs.
+	 */
+	static std::uint32_t getAssetCacheLayoutHash() {
+		const std::array<std::uint32_t, 18> sizes = {
+			sizeof(std::size_t), sizeof(num), sizeof(MimeType),
+			sizeof(Accessor), sizeof(Animation), sizeof(Buffer), sizeof(BufferView), sizeof(Camera), sizeof(Image),
+			sizeof(Light), sizeof(Material), sizeof(Mesh), sizeof(Primitive), sizeof(Node), sizeof(Sampler),
+			sizeof(Scene), sizeof(Skin), sizeof(Texture),
+		};
+		return crcStringFunction(std::string_view(reinterpret_cast<const char*>(sizes.data()), sizes.size() * sizeof(std::uint32_t)));
+	}
+
+	class AssetCacheWriter {
+	public:
+		static constexpr bool reading = false;
+		std::vector<std::byte> bytes;
+
+		void raw(const void* data, std::size_t size) {
+			const auto offset = bytes.size();
+			bytes.resize(offset + size);
+			if (size != 0)
+				std::memcpy(bytes.data() + offset, data, size);
+		}
+
+		void align(std::size_t alignment) {
+			bytes.resize((bytes.size() + alignment - 1) & ~(alignment - 1));
+		}
+	};
+
+	class AssetCacheReader {
+		span<const std::byte> bytes;
+		std::size_t offset;
+
+	public:
+		static constexpr bool reading = true;
+		bool referenceData;
+		bool failed = false;
+
+		explicit AssetCacheReader(span<const std::byte> bytes, std::size_t offset, bool referenceData)
+				: bytes(bytes), offset(offset), referenceData(referenceData) {}
+
+		[[nodiscard]] std::size_t remaining() const noexcept {
+			return bytes.size() - offset;
+		}
+
+		span<const std::byte> take(std::size_t size) {
+			if (failed || size > remaining()) FASTGLTF_UNLIKELY {
+				failed = true;
+				return {};
+			}
+			auto data = bytes.subspan(offset, size);
+			offset += size;
+			return data;
+		}
+
+		void raw(void* data, std::size_t size) {
+			auto source = take(size);
+			if (!source.empty())
+				std::memcpy(data, source.data(), size);
+		}
+
+		void align(std::size_t alignment) {
+			const auto aligned = (offset + alignment - 1) & ~(alignment - 1);
+			take(aligned - offset);
+		}
+	};
+
+	template <typename T> struct IsMathType : std::false_type {};
+	template <typename T, std::size_t N> struct IsMathType<math::vec<T, N>> : std::true_type {};
+	template <typename T> struct IsMathType<math::quat<T>> : std::true_type {};
+	template <typename T, std::size_t N, std::size_t M> struct IsMathType<math::mat<T, N, M>> : std::true_type {};
+
+	template <typename T> struct IsCacheString : std::false_type {};
+	template <typename Traits, typename Allocator> struct IsCacheString<std::basic_string<char, Traits, Allocator>> : std::true_type {};
+
+	template <typename T> struct IsCacheOptional : std::false_type {};
+	template <typename T> struct IsCacheOptional<std::optional<T>> : std::true_type {};
+	template <typename T> struct IsCacheOptional<OptionalWithFlagValue<T>> : std::true_type {};
+
+	template <typename T> struct IsCacheUniquePtr : std::false_type {};
+	template <typename T> struct IsCacheUniquePtr<std::unique_ptr<T>> : std::true_type {};
+
+	template <typename T> struct IsCacheVariant : std::false_type {};
+	template <typename... Ts> struct IsCacheVariant<std::variant<Ts...>> : std::true_type {};
+
+	template <typename T> struct IsCacheVector : std::false_type {};
+	template <typename T, typename Allocator> struct IsCacheVector<std::vector<T, Allocator>> : std::true_type {};
+	template <typename T, std::size_t N, typename Allocator> struct IsCacheVector<SmallVector<T, N, Allocator>> : std::true_type {};
+
+	template <typename T> struct AlwaysFalse : std::false_type {};
+
+	template <typename Variant, std::size_t... Is>
+	bool emplaceVariant(Variant& variant, std::size_t index, std::index_sequence<Is...>) {
+		return ((index == Is ? (variant.template emplace<Is>(), true) : false) || ...);
+	}
+
+	/**
+	 * Reads or writes a value, depending on the archive. Every type of the Asset has an overload listing its fields
+	 * in order, while this handles the primitives and containers they are built from.
+	 */
+	template <typename Archive, typename T>
+	void serialize(Archive& ar, T& value) {
+		if constexpr (std::is_arithmetic_v<T> || std::is_enum_v<T> || IsMathType<T>::value) {
+			ar.raw(&value, sizeof(T));
+		} else if constexpr (std::is_empty_v<T>) {
+			// std::monostate and sources::Fallback have nothing to store.
+		} else if constexpr (IsCacheString<T>::value) {
+			std::size_t size = value.size();
+			serialize(ar, size);
+			if constexpr (Archive::reading) {
+				auto chars = ar.take(size);
+				value.assign(reinterpret_cast<const char*>(chars.data()), chars.size());
+			} else {
+				ar.raw(value.data(), size);
+			}
+		} else if constexpr (IsCacheOptional<T>::value) {
+			bool hasValue = value.has_value();
+			serialize(ar, hasValue);
+			if constexpr (Archive::reading) {
+				if (hasValue) {
+					serialize(ar, value.emplace());
+				} else {
+					value.reset();
+				}
+			} else if (hasValue) {
+				serialize(ar, value.value());
+			}
+		} else if constexpr (IsCacheUniquePtr<T>::value) {
+			bool hasValue = value != nullptr;
+			serialize(ar, hasValue);
+			if constexpr (Archive::reading) {
+				value = hasValue ? std::make_unique<typename T::element_type>() : nullptr;
+			}
+			if (hasValue)
+				serialize(ar, *value);
+		} else if constexpr (IsCacheVariant<T>::value) {
+			auto index = static_cast<std::uint8_t>(value.index());
+			serialize(ar, index);
+			if constexpr (Archive::reading) {
+				if (!emplaceVariant(value, index, std::make_index_sequence<std::variant_size_v<T>>())) {
+					ar.failed = true;
+					return;
+				}
+			}
+			std::visit([&](auto& alternative) { serialize(ar, alternative); }, value);
+		} else if constexpr (IsCacheVector<T>::value) {
+			using Element = std::remove_reference_t<decltype(*value.data())>;
+			std::size_t size = value.size();
+			serialize(ar, size);
+			if constexpr (Archive::reading) {
+				// Every element takes up at least one byte, which bounds the size of damaged caches.
+				if (ar.failed || size > ar.remaining()) {
+					ar.failed = true;
+					return;
+				}
+				value.resize(size);
+			}
+			if constexpr (std::is_arithmetic_v<Element>) {
+				ar.raw(value.data(), size * sizeof(Element));
+			} else {
+				for (auto& element : value)
+					serialize(ar, element);
+			}
+		} else {
+			static_assert(AlwaysFalse<T>::value, "Type is missing an asset cache overload");
+		}
+	}
+
+	template <typename Archive, typename... Ts>
+	void serializeFields(Archive& ar, Ts&... fields) {
+		(serialize(ar, fields), ...);
+	}
+
+	template <typename Archive>
+	void serialize(Archive& ar, URI& uri) {
+		// The URI constructor decodes percent-encoded characters, so they need to be encoded again.
+		std::string string;
+		if constexpr (!Archive::reading) {
+			for (auto c : uri.string()) {
+				if (c == '%') {
+					string += "%25";
+				} else {
+					string += c;
+				}
+			}
+		}
+		serialize(ar, string);
+		if constexpr (Archive::reading) {
+			uri = URI(std::move(string));
+		}
+	}
+
+	template <typename Archive>
+	void serializeBytes(Archive& ar, DataSource& source, span<const std::byte> bytes, MimeType mimeType) {
+		std::size_t size = bytes.size();
+		serializeFields(ar, mimeType, size);
+		ar.align(assetCacheDataAlignment);
+		if constexpr (Archive::reading) {
+			auto data = ar.take(size);
+			if (ar.failed)
+				return;
+			if (ar.referenceData) {
+				source = sources::ByteView { data, mimeType };
+			} else {
+				sources::Array array { StaticVector<std::byte>(size), mimeType };
+				std::memcpy(array.bytes.data(), data.data(), size);
+				source = std::move(array);
+			}
+		} else {
+			ar.raw(bytes.data(), size);
+		}
+	}
+
+	template <typename Archive>
+	void serialize(Archive& ar, DataSource& source) {
+		// Array, Vector, and ByteView are all stored as embedded data.
+		enum class SourceType : std::uint8_t { None, BufferView, URI, Bytes, CustomBuffer, Fallback };
+
+		if constexpr (Archive::reading) {
+			SourceType type;
+			serialize(ar, type);
+			switch (type) {
+				case SourceType::None: source = std::monostate {}; break;
+				case SourceType::BufferView: serialize(ar, source.emplace<sources::BufferView>()); break;
+				case SourceType::URI: serialize(ar, source.emplace<sources::URI>()); break;
+				case SourceType::Bytes: serializeBytes(ar, source, {}, MimeType::None); break;
+				case SourceType::CustomBuffer: serialize(ar, source.emplace<sources::CustomBuffer>()); break;
+				case SourceType::Fallback: source = sources::Fallback {}; break;
+				default: ar.failed = true; break;
+			}
+		} else {
+			auto write = [&](SourceType type) { serialize(ar, type); };
+			std::visit(visitor {
+				[&](std::monostate&) { write(SourceType::None); },
+				[&](sources::BufferView& view) { write(SourceType::BufferView); serialize(ar, view); },
+				[&](sources::URI& uri) { write(SourceType::URI); serialize(ar, uri); },
+				[&](sources::Array& array) {
+					write(SourceType::Bytes);
+					serializeBytes(ar, source, span<const std::byte>(array.bytes.data(), array.bytes.size()), array.mimeType);
+				},
+				[&](sources::Vector& vector) {
+					write(SourceType::Bytes);
+					serializeBytes(ar, source, span<const std::byte>(vector.bytes.data(), vector.bytes.size()), vector.mimeType);
+				},
+				[&](sources::ByteView& view) {
+					write(SourceType::Bytes);
+					serializeBytes(ar, source, view.bytes, view.mimeType);
+				},
+				[&](sources::CustomBuffer& buffer) { write(SourceType::CustomBuffer); serialize(ar, buffer); },
+				[&](sources::Fallback&) { write(SourceType::Fallback); },
+			}, source);
+		}
+	}
+
+	template <typename A> void serialize(A& ar, sources::BufferView& v) { serializeFields(ar, v.bufferViewIndex, v.mimeType); }
+	template <typename A> void serialize(A& ar, sources::URI& v) { serializeFields(ar, v.fileByteOffset, v.uri, v.mimeType); }
+	template <typename A> void serialize(A& ar, sources::CustomBuffer& v) { serializeFields(ar, v.id, v.mimeType); }
 
-	options = _options;
-	directory = std::move(_directory);
+	template <typename A> void serialize(A& ar, AssetInfo& v) { serializeFields(ar, v.gltfVersion, v.copyright, v.generator); }
 
-#if !defined(__ANDROID__)
-    // If we never have to load the files ourselves, we're fine with the directory being invalid/blank.
-    if (std::error_code ec; hasBit(_options, Options::LoadExternalBuffers) && (!fs::is_directory(directory, ec) || ec)) {
-        return Error::InvalidPath;
-    }
-#endif
+	template <typename A> void serialize(A& ar, SparseAccessor& v) {
+		serializeFields(ar, v.count, v.indicesBufferView, v.indicesByteOffset, v.valuesBufferView, v.valuesByteOffset, v.indexComponentType);
+	}
+	template <typename A> void serialize(A& ar, Accessor& v) {
+		serializeFields(ar, v.byteOffset, v.count, v.type, v.componentType, v.normalized, v.max, v.min, v.bufferViewIndex, v.sparse, v.name);
+	}
 
-	data.reset();
-	auto jsonSpan = data.read(data.totalSize(), SIMDJSON_PADDING);
-	padded_string_view view(reinterpret_cast<const std::uint8_t*>(jsonSpan.data()),
-									  data.totalSize(),
-									  data.totalSize() + SIMDJSON_PADDING);
-	dom::object root;
-    if (auto error = jsonParser->parse(view).get(root); error != SUCCESS) FASTGLTF_UNLIKELY {
-	    return Error::InvalidJson;
-    }
+	template <typename A> void serialize(A& ar, AnimationChannel& v) { serializeFields(ar, v.samplerIndex, v.nodeIndex, v.path); }
+	template <typename A> void serialize(A& ar, AnimationSampler& v) { serializeFields(ar, v.inputAccessor, v.outputAccessor, v.interpolation); }
+	template <typename A> void serialize(A& ar, Animation& v) { serializeFields(ar, v.channels, v.samplers, v.name); }
 
-	return parse(root, categories);
-}
+	template <typename A> void serialize(A& ar, Buffer& v) { serializeFields(ar, v.byteLength, v.data, v.name); }
+	template <typename A> void serialize(A& ar, CompressedBufferView& v) {
+		serializeFields(ar, v.bufferIndex, v.byteOffset, v.byteLength, v.count, v.mode, v.filter, v.byteStride);
+	}
+	template <typename A> void serialize(A& ar, BufferView& v) {
+		serializeFields(ar, v.bufferIndex, v.byteOffset, v.byteLength, v.byteStride, v.target, v.meshoptCompression, v.name);
+	}
 
-fg::Expected<fg::Asset> fg::Parser::loadGltfBinary(GltfDataGetter& data, fs::path _directory, Options _options, Category categories) {
-    using namespace simdjson;
+	template <typename A> void serialize(A& ar, Camera::Orthographic& v) { serializeFields(ar, v.xmag, v.ymag, v.zfar, v.znear); }
+	template <typename A> void serialize(A& ar, Camera::Perspective& v) { serializeFields(ar, v.aspectRatio, v.yfov, v.zfar, v.znear); }
+	template <typename A> void serialize(A& ar, Camera& v) { serializeFields(ar, v.camera, v.name); }
 
-	options = _options;
-	directory = std::move(_directory);
+	template <typename A> void serialize(A& ar, Image& v) { serializeFields(ar, v.data, v.name); }
 
-    // If we never have to load the files ourselves, we're fine with the directory being invalid/blank.
-    if (std::error_code ec; hasBit(options, Options::LoadExternalBuffers) && (!fs::is_directory(directory, ec) || ec)) {
-	    return Error::InvalidPath;
-    }
+	template <typename A> void serialize(A& ar, Light& v) {
+		serializeFields(ar, v.type, v.color, v.intensity, v.range, v.innerConeAngle, v.outerConeAngle, v.name);
+	}
 
-	data.reset();
+	template <typename A> void serialize(A& ar, TextureTransform& v) { serializeFields(ar, v.rotation, v.uvOffset, v.uvScale, v.texCoordIndex); }
+	template <typename A> void serialize(A& ar, TextureInfo& v) { serializeFields(ar, v.textureIndex, v.texCoordIndex, v.transform); }
+	template <typename A> void serialize(A& ar, NormalTextureInfo& v) { serializeFields(ar, static_cast<TextureInfo&>(v), v.scale); }
+	template <typename A> void serialize(A& ar, OcclusionTextureInfo& v) { serializeFields(ar, static_cast<TextureInfo&>(v), v.strength); }
 
-    auto header = readBinaryHeader(data);
-    if (header.magic != binaryGltfHeaderMagic) {
-	    return Error::InvalidGLB;
-    }
-	if (header.version != 2) {
-		return Error::UnsupportedVersion;
+	template <typename A> void serialize(A& ar, PBRData& v) {
+		serializeFields(ar, v.baseColorFactor, v.metallicFactor, v.roughnessFactor, v.baseColorTexture, v.metallicRoughnessTexture);
+	}
+	template <typename A> void serialize(A& ar, MaterialAnisotropy& v) { serializeFields(ar, v.anisotropyStrength, v.anisotropyRotation, v.anisotropyTexture); }
+	template <typename A> void serialize(A& ar, MaterialSpecular& v) {
+		serializeFields(ar, v.specularFactor, v.specularTexture, v.specularColorFactor, v.specularColorTexture);
+	}
+	template <typename A> void serialize(A& ar, MaterialIridescence& v) {
+		serializeFields(ar, v.iridescenceFactor, v.iridescenceTexture, v.iridescenceIor, v.iridescenceThicknessMinimum,
+			v.iridescenceThicknessMaximum, v.iridescenceThicknessTexture);
+	}
+	template <typename A> void serialize(A& ar, MaterialVolume& v) {
+		serializeFields(ar, v.thicknessFactor, v.thicknessTexture, v.attenuationDistance, v.attenuationColor);
+	}
+	template <typename A> void serialize(A& ar, MaterialTransmission& v) { serializeFields(ar, v.transmissionFactor, v.transmissionTexture); }
+	template <typename A> void serialize(A& ar, MaterialClearcoat& v) {
+		serializeFields(ar, v.clearcoatFactor, v.clearcoatTexture, v.clearcoatRoughnessFactor, v.clearcoatRoughnessTexture, v.clearcoatNormalTexture);
+	}
+	template <typename A> void serialize(A& ar, MaterialSheen& v) {
+		serializeFields(ar, v.sheenColorFactor, v.sheenColorTexture, v.sheenRoughnessFactor, v.sheenRoughnessTexture);
+	}
+#if FASTGLTF_ENABLE_DEPRECATED_EXT
+	template <typename A> void serialize(A& ar, MaterialSpecularGlossiness& v) {
+		serializeFields(ar, v.diffuseFactor, v.diffuseTexture, v.specularFactor, v.glossinessFactor, v.specularGlossinessTexture);
+	}
+#endif
+	template <typename A> void serialize(A& ar, MaterialPackedTextures& v) {
+		serializeFields(ar, v.occlusionRoughnessMetallicTexture, v.roughnessMetallicOcclusionTexture, v.normalTexture);
+	}
+	template <typename A> void serialize(A& ar, Material& v) {
+		serializeFields(ar, v.pbrData, v.normalTexture, v.occlusionTexture, v.emissiveTexture, v.emissiveFactor, v.alphaMode,
+			v.doubleSided, v.unlit, v.alphaCutoff, v.emissiveStrength, v.ior, v.dispersion, v.anisotropy, v.clearcoat,
+			v.iridescence, v.sheen, v.specular, v.transmission, v.volume, v.packedNormalMetallicRoughnessTexture,
+			v.packedOcclusionRoughnessMetallicTextures, v.name);
+#if FASTGLTF_ENABLE_DEPRECATED_EXT
+		serialize(ar, v.specularGlossiness);
+#endif
 	}
-    if (header.length > data.totalSize()) {
-	    return Error::InvalidGLB;
-    }
-
-    // The glTF 2 spec specifies that in GLB files the order of chunks is predefined. Specifically,
-    //  1. JSON chunk
-    //  2. BIN chunk (optional)
-    auto jsonChunk = readBinaryChunk(data);
-    if (jsonChunk.chunkType != binaryGltfJsonChunkMagic) {
-	    return Error::InvalidGLB;
-    }
 
-    // Create a string view of the JSON chunk in the GLB data buffer. The documentation of parse()
-    // says the padding can be initialised to anything, apparently. Therefore, this should work.
-	auto jsonSpan = data.read(jsonChunk.chunkLength, SIMDJSON_PADDING);
-    simdjson::padded_string_view jsonChunkView(reinterpret_cast<const std::uint8_t*>(jsonSpan.data()),
-                                               jsonChunk.chunkLength,
-                                               jsonChunk.chunkLength + SIMDJSON_PADDING);
+	template <typename A> void serialize(A& ar, Attribute& v) { serializeFields(ar, v.name, v.accessorIndex); }
+	template <typename A> void serialize(A& ar, DracoCompressedPrimitive& v) { serializeFields(ar, v.bufferView, v.attributes); }
+	template <typename A> void serialize(A& ar, Primitive& v) {
+		serializeFields(ar, v.attributes, v.type, v.targets, v.indicesAccessor, v.materialIndex, v.mappings, v.dracoCompression);
+	}
+	template <typename A> void serialize(A& ar, Mesh& v) { serializeFields(ar, v.primitives, v.weights, v.name); }
 
-	simdjson::dom::object root;
-    if (jsonParser->parse(jsonChunkView).get(root) != SUCCESS) FASTGLTF_UNLIKELY {
-	    return Error::InvalidJson;
-    }
+	template <typename A> void serialize(A& ar, TRS& v) { serializeFields(ar, v.translation, v.rotation, v.scale); }
+	template <typename A> void serialize(A& ar, Node& v) {
+		serializeFields(ar, v.meshIndex, v.skinIndex, v.cameraIndex, v.lightIndex, v.children, v.weights, v.transform,
+			v.instancingAttributes, v.name);
+	}
 
-    // Is there enough room for another chunk header?
-    if (header.length > (data.bytesRead() + sizeof(BinaryGltfChunk))) {
-        auto binaryChunk = readBinaryChunk(data);
+	template <typename A> void serialize(A& ar, Sampler& v) { serializeFields(ar, v.magFilter, v.minFilter, v.wrapS, v.wrapT, v.name); }
+	template <typename A> void serialize(A& ar, Scene& v) { serializeFields(ar, v.nodeIndices, v.name); }
+	template <typename A> void serialize(A& ar, Skin& v) { serializeFields(ar, v.inverseBindMatrices, v.skeleton, v.joints, v.name); }
+	template <typename A> void serialize(A& ar, Texture& v) {
+		serializeFields(ar, v.samplerIndex, v.imageIndex, v.basisuImageIndex, v.ddsImageIndex, v.webpImageIndex, v.name);
+	}
 
-        if (binaryChunk.chunkType != binaryGltfDataChunkMagic) {
-	        return Error::InvalidGLB;
-        }
+	template <typename A> void serialize(A& ar, Asset& v) {
+		serializeFields(ar, v.assetInfo, v.extensionsUsed, v.extensionsRequired, v.defaultScene,
+			v.accessors, v.animations, v.buffers, v.bufferViews, v.cameras, v.images, v.lights, v.materials,
+			v.meshes, v.nodes, v.samplers, v.scenes, v.skins, v.textures, v.materialVariants, v.availableCategories);
+	}
+} // namespace fastgltf
 
-		// TODO: Somehow allow skipping the binary part in the future?
-		if (binaryChunk.chunkLength != 0) {
-			if (config.mapCallback != nullptr) {
-				auto info = config.mapCallback(binaryChunk.chunkLength, config.userPointer);
-				if (info.mappedMemory != nullptr) {
-					data.read(info.mappedMemory, binaryChunk.chunkLength);
-					if (config.unmapCallback != nullptr) {
-						config.unmapCallback(&info, config.userPointer);
-					}
-					glbBuffer = sources::CustomBuffer{info.customId, MimeType::None};
-				}
-			} else {
-				StaticVector<std::byte> binaryData(binaryChunk.chunkLength);
-				data.read(binaryData.data(), binaryChunk.chunkLength);
+std::uint64_t fg::hashGltfData(GltfDataGetter& data) {
+	std::call_once(crcInitialisation, initialiseCrc);
 
-				sources::Array vectorData = {
-					std::move(binaryData),
-					MimeType::GltfBuffer,
-				};
-				glbBuffer = std::move(vectorData);
-			}
-		}
-    }
+	data.reset();
+	const auto size = data.totalSize();
+	auto bytes = data.read(size, 0);
+	data.reset();
 
-	return parse(root, categories);
+	const auto crc = crcStringFunction(std::string_view(reinterpret_cast<const char*>(bytes.data()), bytes.size()));
+	return (static_cast<std::uint64_t>(crc) << 32) | (static_cast<std::uint64_t>(size) & 0xFFFFFFFF);
 }
 
-void fg::Parser::setBufferAllocationCallback(BufferMapCallback* mapCallback, BufferUnmapCallback* unmapCallback) noexcept {
-	if (mapCallback == nullptr)
-		unmapCallback = nullptr;
-	config.mapCallback = mapCallback;
-	config.unmapCallback = unmapCallback;
+std::vector<std::byte> fg::writeAssetCache(const Asset& asset, std::uint64_t sourceHash) {
+	std::call_once(crcInitialisation, initialiseCrc);
+
+	AssetCacheWriter writer;
+	writer.bytes.resize(sizeof(AssetCacheHeader));
+
+	// The writer never modifies the asset, but shares the serialization functions with the reader.
+	serialize(writer, const_cast<Asset&>(asset));
+
+	const auto payloadSize = writer.bytes.size() - sizeof(AssetCacheHeader);
+	AssetCacheHeader header {};
+	header.magic = assetCacheMagic;
+	header.version = assetCacheVersion;
+	header.layoutHash = getAssetCacheLayoutHash();
+	header.payloadHash = crcStringFunction(std::string_view(
+		reinterpret_cast<const char*>(writer.bytes.data() + sizeof(AssetCacheHeader)), payloadSize));
+	header.sourceHash = sourceHash;
+	header.payloadSize = payloadSize;
+	std::memcpy(writer.bytes.data(), &header, sizeof header);
+	return std::move(writer.bytes);
 }
 
-void fg::Parser::setBase64DecodeCallback(Base64DecodeCallback* decodeCallback) noexcept {
-    config.decodeCallback = decodeCallback;
+fg::Expected<fg::Asset> fg::Parser::parseAssetCache(span<const std::byte> bytes, bool referenceData, std::uint64_t sourceHash) {
+	if (bytes.size() < sizeof(AssetCacheHeader))
+		return Error::InvalidCache;
+
+	AssetCacheHeader header;
+	std::memcpy(&header, bytes.data(), sizeof header);
+	if (header.magic != assetCacheMagic || header.version != assetCacheVersion
+			|| header.layoutHash != getAssetCacheLayoutHash() || header.sourceHash != sourceHash
+			|| header.payloadSize != bytes.size() - sizeof(AssetCacheHeader)) {
+		return Error::InvalidCache;
+	}
+
+	const auto payloadHash = crcStringFunction(std::string_view(
+		reinterpret_cast<const char*>(bytes.data() + sizeof(AssetCacheHeader)), header.payloadSize));
+	if (payloadHash != header.payloadHash)
+		return Error::InvalidCache;
+
+	// Embedded buffers and images are not copied into the arena when referencing them.
+	auto asset = createAsset(referenceData ? header.payloadSize / 4 : header.payloadSize);
+
+	AssetCacheReader reader(bytes, sizeof(AssetCacheHeader), referenceData);
+	serialize(reader, asset);
+	if (reader.failed || reader.remaining() != 0)
+		return Error::InvalidCache;
+	return asset;
 }
 
-void fg::Parser::setExtrasParseCallback(ExtrasParseCallback *extrasCallback) noexcept {
-	config.extrasCallback = extrasCallback;
+fg::Expected<fg::Asset> fg::Parser::loadAssetCache(GltfDataGetter& data, std::uint64_t sourceHash) {
+	data.reset();
+	auto bytes = data.read(data.totalSize(), 0);
+	if (auto error = data.readError(); error != Error::None) {
+		return error;
+	}
+	return parseAssetCache(span<const std::byte>(bytes.data(), bytes.size()), false, sourceHash);
 }
 
-void fg::Parser::setUserPointer(void* pointer) noexcept {
-    config.userPointer = pointer;
+fg::Expected<fg::Asset> fg::Parser::loadAssetCache(std::shared_ptr<GltfDataGetter> data, std::uint64_t sourceHash) {
+	auto bytes = data->persistentBytes();
+	if (bytes.empty())
+		return loadAssetCache(*data, sourceHash);
+
+	auto asset = parseAssetCache(bytes, true, sourceHash);
+	if (asset.error() == Error::None) {
+		asset->dataGetter = std::move(data);
+	}
+	return asset;
 }
 #pragma endregion
 
 #pragma region Exporter
 void fg::prettyPrintJson(std::string& json) {
-    std::size_t i = 0;
-    std::size_t depth = 0;
-    auto insertNewline = [&i, &depth, &json]() {
-        json.insert(i, 1, '\n');
-        json.insert(i + 1, depth, '\t');
-        i += 1 + depth;
-    };
-
-    while (i < json.size()) {
-        if (json[i] == '"') {
-            // Skip to the end of the string
-            do {
-                ++i;
-                if (json[i] == '"' && json[i - 1] != '\\') {
-                    break;
-                }
-            } while (true);
-            ++i; // Skip over the last "
-        }
-
-        switch (json[i]) {
-            case '{': case '[':
-                ++depth;
-                ++i; // Insert \n after the character
-                insertNewline();
-                break;
-            case '}': case ']':
-                --depth;
-                insertNewline();
-                ++i; // Insert \n before the character
-                break;
-            case ',':
-                ++i;  // Insert \n after the character
-                insertNewline();
-                break;
-            default:
-                ++i;
-                break;
-        }
-    }
+	JsonOutput output(true);
+	output.reserve(json.size() * 2);
+	output += json;
+	json = std::move(output.str());
 }
 
 namespace fastgltf {
@@ -4117,6 +6381,16 @@ namespace fastgltf {
 		escapeString(string);
 		return string;
 	}
+
+	/** Writes the bytes as a base64 data URI value, encoding them directly into the JSON string. */
+	static void writeDataUri(JsonOutput& json, MimeType mimeType, span<const std::byte> bytes) {
+		json += R"("uri":"data:)";
+		json += getMimeTypeString(mimeType == MimeType::None ? MimeType::OctetStream : mimeType);
+		json += ";base64,";
+		auto* output = json.appendRaw(base64::getEncodedSize(bytes.size()));
+		base64::encode_inplace(reinterpret_cast<const std::uint8_t*>(bytes.data()), bytes.size(), output);
+		json += '"';
+	}
 } // namespace fastgltf
 
 std::string fg::escapeString(std::string_view string) {
@@ -4143,11 +6417,15 @@ void fg::Exporter::setExtrasWriteCallback(ExtrasWriteCallback* callback) noexcep
 	extrasWriteCallback = callback;
 }
 
+void fg::Exporter::setTaskExecutorCallback(TaskExecutorCallback* callback) noexcept {
+	executorCallback = callback;
+}
+
 void fg::Exporter::setUserPointer(void* pointer) noexcept {
 	userPointer = pointer;
 }
 
-void fg::Exporter::writeAccessors(const Asset& asset, std::string& json) {
+void fg::Exporter::writeAccessors(const Asset& asset, JsonOutput& json) {
 	if (asset.accessors.empty())
 		return;
 	if (json.back() == ']' || json.back() == '}')
@@ -4158,30 +6436,30 @@ void fg::Exporter::writeAccessors(const Asset& asset, std::string& json) {
 		json += '{';
 
 		if (it->byteOffset != 0) {
-			json += "\"byteOffset\":" + std::to_string(it->byteOffset) + ',';
+			json.write("\"byteOffset\":", it->byteOffset, ',');
 		}
 
-		json += "\"count\":" + std::to_string(it->count) + ',';
-		json += R"("type":")" + std::string(getAccessorTypeName(it->type)) + "\",";
-		json += "\"componentType\":" + std::to_string(getGLComponentType(it->componentType));
+		json.write("\"count\":", it->count, ',');
+		json.write(R"("type":")", getAccessorTypeName(it->type), "\",");
+		json.write("\"componentType\":", getGLComponentType(it->componentType));
 
 		if (it->normalized) {
 			json += ",\"normalized\":true";
 		}
 
 		if (it->bufferViewIndex.has_value()) {
-			json += ",\"bufferView\":" + std::to_string(it->bufferViewIndex.value());
+			json.write(",\"bufferView\":", it->bufferViewIndex.value());
 		}
 
 		auto writeMinMax = [&](const decltype(Accessor::max)& ref, std::string_view name) {
 			if (std::holds_alternative<std::monostate>(ref))
 				return;
-			json += ",\"" + std::string(name) + "\":[";
+			json.write(",\"", name, "\":[");
 			std::visit(visitor {
 				[](std::monostate) {},
 				[&](const auto& arg) {
 					for (auto it = arg.begin(); it != arg.end(); ++it) {
-						json += std::to_string(*it);
+						json.write(*it);
 						if (uabs(std::distance(arg.begin(), it)) + 1 < arg.size())
 							json += ',';
 					}
@@ -4195,12 +6473,12 @@ void fg::Exporter::writeAccessors(const Asset& asset, std::string& json) {
 		if (extrasWriteCallback != nullptr) {
 			auto extras = extrasWriteCallback(uabs(std::distance(asset.accessors.begin(), it)), fastgltf::Category::Accessors, userPointer);
 			if (extras.has_value()) {
-				json += std::string(",\"extras\":") + *extras;
+				json.write(",\"extras\":", *extras);
 			}
 		}
 
 		if (!it->name.empty())
-			json += R"(,"name":")" + fg::escapeString(it->name) + '"';
+			json.write(R"(,"name":")", fg::escapeString(it->name), '"');
 
 		json += '}';
 		if (uabs(std::distance(asset.accessors.begin(), it)) + 1 <asset.accessors.size())
@@ -4209,7 +6487,7 @@ void fg::Exporter::writeAccessors(const Asset& asset, std::string& json) {
 	json += ']';
 }
 
-void fg::Exporter::writeAnimations(const Asset& asset, std::string& json)
+void fg::Exporter::writeAnimations(const Asset& asset, JsonOutput& json)
 {
 	if (asset.animations.empty())
 		return;
@@ -4223,10 +6501,10 @@ void fg::Exporter::writeAnimations(const Asset& asset, std::string& json)
 		json += R"("channels":[)";
 		for (auto ci = it->channels.begin(); ci != it->channels.end(); ++ci) {
 			json += "{";
-			json += R"("sampler":)" + std::to_string(ci->samplerIndex) + ",";
+			json.write(R"("sampler":)", ci->samplerIndex, ",");
 			json += R"("target":{)";
 			if (ci->nodeIndex.has_value()) {
-				json += R"("node":)" + std::to_string(ci->nodeIndex.value()) + ",";
+				json.write(R"("node":)", ci->nodeIndex.value(), ",");
 			}
 			json += R"("path":")";
 			switch (ci->path) {
@@ -4253,7 +6531,7 @@ void fg::Exporter::writeAnimations(const Asset& asset, std::string& json)
 		json += R"("samplers":[)";
 		for (auto si = it->samplers.begin(); si != it->samplers.end(); ++si) {
 			json += '{';
-			json += R"("input":)" + std::to_string(si->inputAccessor) + ',';
+			json.write(R"("input":)", si->inputAccessor, ',');
 
 			if (si->interpolation != fg::AnimationInterpolation::Linear) {
 				json += R"("interpolation":")";
@@ -4264,7 +6542,7 @@ void fg::Exporter::writeAnimations(const Asset& asset, std::string& json)
 				}
 			}
 
-			json += R"("output":)" + std::to_string(si->outputAccessor);
+			json.write(R"("output":)", si->outputAccessor);
 			json += '}';
 
 			if (uabs(std::distance(it->samplers.begin(), si)) + 1 < it->samplers.size())
@@ -4275,12 +6553,12 @@ void fg::Exporter::writeAnimations(const Asset& asset, std::string& json)
 		if (extrasWriteCallback != nullptr) {
 			auto extras = extrasWriteCallback(uabs(std::distance(asset.animations.begin(), it)), fastgltf::Category::Animations, userPointer);
 			if (extras.has_value()) {
-				json += std::string(",\"extras\":") + *extras;
+				json.write(",\"extras\":", *extras);
 			}
 		}
 
 		if (!it->name.empty())
-			json += R"(,"name":")" + fg::escapeString(it->name) + '"';
+			json.write(R"(,"name":")", fg::escapeString(it->name), '"');
 
 		json += '}';
 		if (uabs(std::distance(asset.animations.begin(), it)) + 1 < asset.animations.size())
@@ -4289,51 +6567,79 @@ void fg::Exporter::writeAnimations(const Asset& asset, std::string& json)
 	json += ']';
 }
 
-void fg::Exporter::writeBuffers(const Asset& asset, std::string& json) {
+void fg::Exporter::writeBuffers(const Asset& asset, JsonOutput& json) {
 	if (asset.buffers.empty())
 		return;
 	if (json.back() == ']' || json.back() == '}')
 		json += ',';
 
 	json += "\"buffers\":[";
+
+	// All merged buffers are replaced by the BIN chunk's buffer, which has to be the first one.
+	const bool mergingBuffers = !bufferIndices.empty();
+	if (mergingBuffers) {
+		json.write("{\"byteLength\":", mergedBufferLength, '}');
+	}
+
 	for (auto it = asset.buffers.begin(); it != asset.buffers.end(); ++it) {
+        auto bufferIdx = uabs(std::distance(asset.buffers.begin(), it));
+		if (mergingBuffers && bufferIndices[bufferIdx] == 0) {
+			bufferPaths.emplace_back(std::nullopt);
+			continue;
+		}
+
+		if (json.back() != '[')
+			json += ',';
 		json += '{';
 
-        auto bufferIdx = uabs(std::distance(asset.buffers.begin(), it));
+		auto embedBuffer = [&]() {
+			if (!hasBit(options, ExportOptions::EmbedDataUris))
+				return false;
+			writeDataUri(json, MimeType::OctetStream, getLoadedBufferBytes(*it));
+			json += ',';
+			bufferPaths.emplace_back(std::nullopt);
+			return true;
+		};
 		std::visit(visitor {
 			[&](auto&) {
 				// Covers BufferView and CustomBuffer.
 				errorCode = Error::InvalidGltf;
 			},
 			[&]([[maybe_unused]] const sources::Array& vector) {
-                if (bufferIdx == 0 && exportingBinary) {
+                if (bufferIdx == 0 && exportingBinary && !mergingBuffers) {
                     bufferPaths.emplace_back(std::nullopt);
                     return;
                 }
+                if (embedBuffer())
+                    return;
                 auto path = getBufferFilePath(asset, bufferIdx);
-                json += std::string(R"("uri":")") + fg::normalizeAndFormatPath(path) + '"' + ',';
+                json.write(R"("uri":")", fg::normalizeAndFormatPath(path), '"', ',');
                 bufferPaths.emplace_back(path);
 			},
 			[&]([[maybe_unused]] const sources::Vector& vector) {
-				if (bufferIdx == 0 && exportingBinary) {
+				if (bufferIdx == 0 && exportingBinary && !mergingBuffers) {
 					bufferPaths.emplace_back(std::nullopt);
 					return;
 				}
+				if (embedBuffer())
+					return;
 				auto path = getBufferFilePath(asset, bufferIdx);
-				json += std::string(R"("uri":")") + fg::normalizeAndFormatPath(path) + '"' + ',';
+				json.write(R"("uri":")", fg::normalizeAndFormatPath(path), '"', ',');
 				bufferPaths.emplace_back(path);
 			},
 			[&]([[maybe_unused]] const sources::ByteView& view) {
-				if (bufferIdx == 0 && exportingBinary) {
+				if (bufferIdx == 0 && exportingBinary && !mergingBuffers) {
 					bufferPaths.emplace_back(std::nullopt);
 					return;
 				}
+				if (embedBuffer())
+					return;
                 auto path = getBufferFilePath(asset, bufferIdx);
-                json += std::string(R"("uri":")") + fg::normalizeAndFormatPath(path) + '"' + ',';
+                json.write(R"("uri":")", fg::normalizeAndFormatPath(path), '"', ',');
                 bufferPaths.emplace_back(path);
 			},
 			[&](const sources::URI& uri) {
-				json += std::string(R"("uri":")") + fg::escapeString(uri.uri.string()) + '"' + ',';
+				json.write(R"("uri":")", fg::escapeString(uri.uri.string()), '"', ',');
                 bufferPaths.emplace_back(std::nullopt);
 			},
 			[&]([[maybe_unused]] const sources::Fallback& fallback) {
@@ -4342,25 +6648,31 @@ void fg::Exporter::writeBuffers(const Asset& asset, std::string& json) {
 			},
 		}, it->data);
 
-		json += "\"byteLength\":" + std::to_string(it->byteLength);
+		json.write("\"byteLength\":", it->byteLength);
 
 		if (extrasWriteCallback != nullptr) {
 			auto extras = extrasWriteCallback(uabs(std::distance(asset.buffers.begin(), it)), fastgltf::Category::Buffers, userPointer);
 			if (extras.has_value()) {
-				json += std::string(",\"extras\":") + *extras;
+				json.write(",\"extras\":", *extras);
 			}
 		}
 
 		if (!it->name.empty())
-			json += R"(,"name":")" + fg::escapeString(it->name) + '"';
+			json.write(R"(,"name":")", fg::escapeString(it->name), '"');
 		json += '}';
-		if (uabs(std::distance(asset.buffers.begin(), it)) + 1 <asset.buffers.size())
-			json += ',';
 	}
 	json += "]";
 }
 
-void fg::Exporter::writeBufferViews(const Asset& asset, std::string& json) {
+std::size_t fg::Exporter::getExportedBufferIndex(std::size_t bufferIndex) const noexcept {
+	return bufferIndices.empty() ? bufferIndex : bufferIndices[bufferIndex];
+}
+
+std::size_t fg::Exporter::getExportedBufferOffset(std::size_t bufferIndex) const noexcept {
+	return bufferOffsets.empty() ? 0 : bufferOffsets[bufferIndex];
+}
+
+void fg::Exporter::writeBufferViews(const Asset& asset, JsonOutput& json) {
 	if (asset.bufferViews.empty())
 		return;
 	if (json.back() == ']' || json.back() == '}')
@@ -4370,31 +6682,31 @@ void fg::Exporter::writeBufferViews(const Asset& asset, std::string& json) {
 	for (auto it = asset.bufferViews.begin(); it != asset.bufferViews.end(); ++it) {
 		json += '{';
 
-		json += "\"buffer\":" + std::to_string(it->bufferIndex) + ',';
-		json += "\"byteLength\":" + std::to_string(it->byteLength);
+		json.write("\"buffer\":", getExportedBufferIndex(it->bufferIndex), ',');
+		json.write("\"byteLength\":", it->byteLength);
 
-		if (it->byteOffset != 0) {
-			json += ",\"byteOffset\":" + std::to_string(it->byteOffset);
+		if (auto byteOffset = getExportedBufferOffset(it->bufferIndex) + it->byteOffset; byteOffset != 0) {
+			json.write(",\"byteOffset\":", byteOffset);
 		}
 
 		if (it->byteStride.has_value()) {
-			json += ",\"byteStride\":" + std::to_string(it->byteStride.value());
+			json.write(",\"byteStride\":", it->byteStride.value());
 		}
 
 		if (it->target.has_value()) {
-			json += ",\"target\":" + std::to_string(to_underlying(it->target.value()));
+			json.write(",\"target\":", to_underlying(it->target.value()));
 		}
 
         if (it->meshoptCompression != nullptr) {
             json += R"(,"extensions":{"EXT_meshopt_compression":{)";
             const auto& meshopt = *it->meshoptCompression;
-            json += "\"buffer\":" + std::to_string(meshopt.bufferIndex);
-            if (meshopt.byteOffset != 0) {
-                json += ",\"byteOffset\":" + std::to_string(meshopt.byteOffset);
+            json.write("\"buffer\":", getExportedBufferIndex(meshopt.bufferIndex));
+            if (auto byteOffset = getExportedBufferOffset(meshopt.bufferIndex) + meshopt.byteOffset; byteOffset != 0) {
+                json.write(",\"byteOffset\":", byteOffset);
             }
-            json += ",\"byteLength\":" + std::to_string(meshopt.byteLength);
-            json += ",\"byteStride\":" + std::to_string(meshopt.byteStride);
-            json += ",\"count\":" + std::to_string(meshopt.count);
+            json.write(",\"byteLength\":", meshopt.byteLength);
+            json.write(",\"byteStride\":", meshopt.byteStride);
+            json.write(",\"count\":", meshopt.count);
 
             json += ",\"mode\":";
             if (meshopt.mode == MeshoptCompressionMode::Attributes) {
@@ -4420,12 +6732,12 @@ void fg::Exporter::writeBufferViews(const Asset& asset, std::string& json) {
 		if (extrasWriteCallback != nullptr) {
 			auto extras = extrasWriteCallback(uabs(std::distance(asset.bufferViews.begin(), it)), fastgltf::Category::BufferViews, userPointer);
 			if (extras.has_value()) {
-				json += std::string(",\"extras\":") + *extras;
+				json.write(",\"extras\":", *extras);
 			}
 		}
 
 		if (!it->name.empty())
-			json += R"(,"name":")" + fg::escapeString(it->name) + '"';
+			json.write(R"(,"name":")", fg::escapeString(it->name), '"');
 
 		json += '}';
 		if (uabs(std::distance(asset.bufferViews.begin(), it)) + 1 <asset.bufferViews.size())
@@ -4434,7 +6746,7 @@ void fg::Exporter::writeBufferViews(const Asset& asset, std::string& json) {
 	json += ']';
 }
 
-void fg::Exporter::writeCameras(const Asset& asset, std::string& json) {
+void fg::Exporter::writeCameras(const Asset& asset, JsonOutput& json) {
 	if (asset.cameras.empty())
 		return;
 	if (json.back() == ']' || json.back() == '}')
@@ -4450,25 +6762,25 @@ void fg::Exporter::writeCameras(const Asset& asset, std::string& json) {
 				json += "\"perspective\":{";
 
 				if (perspective.aspectRatio.has_value()) {
-					json += "\"aspectRatio\":" + std::to_string(perspective.aspectRatio.value()) + ',';
+					json.write("\"aspectRatio\":", perspective.aspectRatio.value(), ',');
 				}
 
-				json += "\"yfov\":" + std::to_string(perspective.yfov) + ',';
+				json.write("\"yfov\":", perspective.yfov, ',');
 
 				if (perspective.zfar.has_value()) {
-					json += "\"zfar\":" + std::to_string(perspective.zfar.value()) + ',';
+					json.write("\"zfar\":", perspective.zfar.value(), ',');
 				}
 
-				json += "\"znear\":" + std::to_string(perspective.znear);
+				json.write("\"znear\":", perspective.znear);
 
 				json += R"(},"type":"perspective")";
 			},
 			[&](const Camera::Orthographic& orthographic) {
 				json += "\"orthographic\":{";
-				json += "\"xmag\":" + std::to_string(orthographic.xmag) + ',';
-				json += "\"ymag\":" + std::to_string(orthographic.ymag) + ',';
-				json += "\"zfar\":" + std::to_string(orthographic.zfar) + ',';
-				json += "\"znear\":" + std::to_string(orthographic.znear);
+				json.write("\"xmag\":", orthographic.xmag, ',');
+				json.write("\"ymag\":", orthographic.ymag, ',');
+				json.write("\"zfar\":", orthographic.zfar, ',');
+				json.write("\"znear\":", orthographic.znear);
 				json += R"(},"type":"orthographic")";
 			}
 		}, it->camera);
@@ -4476,12 +6788,12 @@ void fg::Exporter::writeCameras(const Asset& asset, std::string& json) {
 		if (extrasWriteCallback != nullptr) {
 			auto extras = extrasWriteCallback(uabs(std::distance(asset.cameras.begin(), it)), fastgltf::Category::Cameras, userPointer);
 			if (extras.has_value()) {
-				json += std::string(",\"extras\":") + *extras;
+				json.write(",\"extras\":", *extras);
 			}
 		}
 
 		if (!it->name.empty())
-			json += R"(,"name":")" + fg::escapeString(it->name) + '"';
+			json.write(R"(,"name":")", fg::escapeString(it->name), '"');
 
 		json += '}';
 		if (uabs(std::distance(asset.cameras.begin(), it)) + 1 <asset.cameras.size())
@@ -4490,7 +6802,7 @@ void fg::Exporter::writeCameras(const Asset& asset, std::string& json) {
 	json += ']';
 }
 
-void fg::Exporter::writeImages(const Asset& asset, std::string& json) {
+void fg::Exporter::writeImages(const Asset& asset, JsonOutput& json) {
 	if (asset.images.empty())
 		return;
 	if (json.back() == ']' || json.back() == '}')
@@ -4506,28 +6818,38 @@ void fg::Exporter::writeImages(const Asset& asset, std::string& json) {
 				errorCode = Error::InvalidGltf;
 			},
             [&](const sources::BufferView& bufferView) {
-                json += std::string(R"("bufferView":)") + std::to_string(bufferView.bufferViewIndex) + ',';
-				json += std::string(R"("mimeType":")") + std::string(getMimeTypeString(bufferView.mimeType)) + '"';
+                json.write(R"("bufferView":)", bufferView.bufferViewIndex, ',');
+				json.write(R"("mimeType":")", getMimeTypeString(bufferView.mimeType), '"');
                 imagePaths.emplace_back(std::nullopt);
             },
             [&](const sources::Array& vector) {
+                if (hasBit(options, ExportOptions::EmbedDataUris)) {
+                    writeDataUri(json, vector.mimeType, span(vector.bytes.data(), vector.bytes.size()));
+                    imagePaths.emplace_back(std::nullopt);
+                    return;
+                }
                 auto path = getImageFilePath(asset, imageIdx, vector.mimeType);
-                json += std::string(R"("uri":")") + fg::normalizeAndFormatPath(path) + '"';
+                json.write(R"("uri":")", fg::normalizeAndFormatPath(path), '"');
 				if (vector.mimeType != MimeType::None) {
-					json += std::string(R"(,"mimeType":")") + std::string(getMimeTypeString(vector.mimeType)) + '"';
+					json.write(R"(,"mimeType":")", getMimeTypeString(vector.mimeType), '"');
 				}
                 imagePaths.emplace_back(path);
             },
 			[&](const sources::Vector& vector) {
+				if (hasBit(options, ExportOptions::EmbedDataUris)) {
+					writeDataUri(json, vector.mimeType, span(vector.bytes.data(), vector.bytes.size()));
+					imagePaths.emplace_back(std::nullopt);
+					return;
+				}
 				auto path = getImageFilePath(asset, imageIdx, vector.mimeType);
-				json += std::string(R"("uri":")") + fg::normalizeAndFormatPath(path) + '"';
+				json.write(R"("uri":")", fg::normalizeAndFormatPath(path), '"');
 				if (vector.mimeType != MimeType::None) {
-					json += std::string(R"(,"mimeType":")") + std::string(getMimeTypeString(vector.mimeType)) + '"';
+					json.write(R"(,"mimeType":")", getMimeTypeString(vector.mimeType), '"');
 				}
 				imagePaths.emplace_back(path);
 			},
 			[&](const sources::URI& uri) {
-				json += std::string(R"("uri":")") + fg::escapeString(uri.uri.string()) + '"';
+				json.write(R"("uri":")", fg::escapeString(uri.uri.string()), '"');
                 imagePaths.emplace_back(std::nullopt);
 			},
 		}, it->data);
@@ -4537,12 +6859,12 @@ void fg::Exporter::writeImages(const Asset& asset, std::string& json) {
 		if (extrasWriteCallback != nullptr) {
 			auto extras = extrasWriteCallback(uabs(std::distance(asset.images.begin(), it)), fastgltf::Category::Images, userPointer);
 			if (extras.has_value()) {
-				json += std::string(",\"extras\":") + *extras;
+				json.write(",\"extras\":", *extras);
 			}
 		}
 
 		if (!it->name.empty())
-			json += R"(,"name":")" + fg::escapeString(it->name) + '"';
+			json.write(R"(,"name":")", fg::escapeString(it->name), '"');
 		json += '}';
 		if (uabs(std::distance(asset.images.begin(), it)) + 1 <asset.images.size())
 			json += ',';
@@ -4550,7 +6872,7 @@ void fg::Exporter::writeImages(const Asset& asset, std::string& json) {
 	json += ']';
 }
 
-void fg::Exporter::writeLights(const Asset& asset, std::string& json) {
+void fg::Exporter::writeLights(const Asset& asset, JsonOutput& json) {
 	if (asset.lights.empty())
 		return;
 	if (json.back() == ']' || json.back() == '}')
@@ -4563,12 +6885,12 @@ void fg::Exporter::writeLights(const Asset& asset, std::string& json) {
 		// [1.0f, 1.0f, 1.0f] is the default.
 		if (it->color[0] != 1.0f && it->color[1] != 1.0f && it->color[2] != 1.0f) {
 			json += R"("color":[)";
-			json += std::to_string(it->color[0]) + ',' + std::to_string(it->color[1]) + ',' + std::to_string(it->color[2]);
+			json.write(it->color[0], ',', it->color[1], ',', it->color[2]);
 			json += "],";
 		}
 
 		if (it->intensity != 1.0f) {
-			json += R"("intensity":)" + std::to_string(it->intensity) + ',';
+			json.write(R"("intensity":)", it->intensity, ',');
 		}
 
 		switch (it->type) {
@@ -4587,19 +6909,19 @@ void fg::Exporter::writeLights(const Asset& asset, std::string& json) {
 		}
 
 		if (it->range.has_value()) {
-			json += R"(,"range":)" + std::to_string(it->range.value());
+			json.write(R"(,"range":)", it->range.value());
 		}
 
 		if (it->type == LightType::Spot) {
 			if (it->innerConeAngle.has_value())
-				json += R"("innerConeAngle":)" + std::to_string(it->innerConeAngle.value()) + ',';
+				json.write(R"("innerConeAngle":)", it->innerConeAngle.value(), ',');
 
 			if (it->outerConeAngle.has_value())
-				json += R"("outerConeAngle":)" + std::to_string(it->outerConeAngle.value()) + ',';
+				json.write(R"("outerConeAngle":)", it->outerConeAngle.value(), ',');
 		}
 
 		if (!it->name.empty())
-			json += R"(,"name":")" + fg::escapeString(it->name) + '"';
+			json.write(R"(,"name":")", fg::escapeString(it->name), '"');
 		json += '}';
 		if (uabs(std::distance(asset.lights.begin(), it)) + 1 <asset.lights.size())
 			json += ',';
@@ -4607,7 +6929,7 @@ void fg::Exporter::writeLights(const Asset& asset, std::string& json) {
 	json += "]}";
 }
 
-void fg::Exporter::writeMaterials(const Asset& asset, std::string& json) {
+void fg::Exporter::writeMaterials(const Asset& asset, JsonOutput& json) {
 	if (asset.materials.empty())
 		return;
 	if (json.back() == ']' || json.back() == '}')
@@ -4620,8 +6942,7 @@ void fg::Exporter::writeMaterials(const Asset& asset, std::string& json) {
 		json += "\"pbrMetallicRoughness\":{";
 		if (it->pbrData.baseColorFactor != math::nvec4(1)) {
 			json += R"("baseColorFactor":[)";
-			json += std::to_string(it->pbrData.baseColorFactor[0]) + ',' + std::to_string(it->pbrData.baseColorFactor[1]) + ',' +
-				std::to_string(it->pbrData.baseColorFactor[2]) + ',' + std::to_string(it->pbrData.baseColorFactor[3]);
+			json.write(it->pbrData.baseColorFactor[0], ',', it->pbrData.baseColorFactor[1], ',', it->pbrData.baseColorFactor[2], ',', it->pbrData.baseColorFactor[3]);
 			json += "]";
 		}
 
@@ -4633,12 +6954,12 @@ void fg::Exporter::writeMaterials(const Asset& asset, std::string& json) {
 
 		if (it->pbrData.metallicFactor != 1.0f) {
 			if (json.back() != '{') json += ',';
-			json += "\"metallicFactor\":" + std::to_string(it->pbrData.metallicFactor);
+			json.write("\"metallicFactor\":", it->pbrData.metallicFactor);
 		}
 
 		if (it->pbrData.roughnessFactor != 1.0f) {
 			if (json.back() != '{') json += ',';
-			json += "\"roughnessFactor\":" + std::to_string(it->pbrData.roughnessFactor);
+			json.write("\"roughnessFactor\":", it->pbrData.roughnessFactor);
 		}
 
 		if (it->pbrData.metallicRoughnessTexture.has_value()) {
@@ -4670,7 +6991,7 @@ void fg::Exporter::writeMaterials(const Asset& asset, std::string& json) {
 		if (it->emissiveFactor != math::nvec3(0)) {
 			if (json.back() != ',') json += ',';
 			json += R"("emissiveFactor":[)";
-			json += std::to_string(it->emissiveFactor[0]) + ',' + std::to_string(it->emissiveFactor[1]) + ',' + std::to_string(it->emissiveFactor[2]);
+			json.write(it->emissiveFactor[0], ',', it->emissiveFactor[1], ',', it->emissiveFactor[2]);
 			json += "],";
 		}
 
@@ -4686,7 +7007,7 @@ void fg::Exporter::writeMaterials(const Asset& asset, std::string& json) {
 
 		if (it->alphaMode == AlphaMode::Mask && it->alphaCutoff != 0.5f) {
 			if (json.back() != ',') json += ',';
-			json += R"("alphaCutoff":)" + std::to_string(it->alphaCutoff);
+			json.write(R"("alphaCutoff":)", it->alphaCutoff);
 		}
 
 		if (it->doubleSided) {
@@ -4700,11 +7021,11 @@ void fg::Exporter::writeMaterials(const Asset& asset, std::string& json) {
 		if (it->anisotropy) {
 			json += R"("KHR_materials_anisotropy":{)";
 			if (it->anisotropy->anisotropyStrength != 0.0f) {
-				json += R"("anisotropyStrength":)" + std::to_string(it->anisotropy->anisotropyStrength);
+				json.write(R"("anisotropyStrength":)", it->anisotropy->anisotropyStrength);
 			}
 			if (it->anisotropy->anisotropyRotation != 0.0f) {
 				if (json.back() != '{') json += ',';
-				json += R"("anisotropyRotation":)" + std::to_string(it->anisotropy->anisotropyRotation);
+				json.write(R"("anisotropyRotation":)", it->anisotropy->anisotropyRotation);
 			}
 			if (it->anisotropy->anisotropyTexture.has_value()) {
 				if (json.back() != '{') json += ',';
@@ -4718,7 +7039,7 @@ void fg::Exporter::writeMaterials(const Asset& asset, std::string& json) {
 			if (json.back() == '}') json += ',';
 			json += R"("KHR_materials_clearcoat":{)";
 			if (it->clearcoat->clearcoatFactor != 0.0f) {
-				json += R"("clearcoatFactor":)" + std::to_string(it->clearcoat->clearcoatFactor);
+				json.write(R"("clearcoatFactor":)", it->clearcoat->clearcoatFactor);
 			}
 			if (it->clearcoat->clearcoatTexture.has_value()) {
 				if (json.back() != '{') json += ',';
@@ -4727,7 +7048,7 @@ void fg::Exporter::writeMaterials(const Asset& asset, std::string& json) {
 			}
 			if (it->clearcoat->clearcoatRoughnessFactor != 0.0f) {
 				if (json.back() != '{') json += ',';
-				json += R"("clearcoatRoughnessFactor":)" + std::to_string(it->clearcoat->clearcoatRoughnessFactor);
+				json.write(R"("clearcoatRoughnessFactor":)", it->clearcoat->clearcoatRoughnessFactor);
 			}
 			if (it->clearcoat->clearcoatRoughnessTexture.has_value()) {
 				if (json.back() != '{') json += ',';
@@ -4744,24 +7065,24 @@ void fg::Exporter::writeMaterials(const Asset& asset, std::string& json) {
 
 		if (it->dispersion != 0.0f) {
 			if (json.back() == '}') json += ',';
-			json += R"("KHR_materials_dispersion":{"dispersion":)" + std::to_string(it->dispersion) + '}';
+			json.write(R"("KHR_materials_dispersion":{"dispersion":)", it->dispersion, '}');
 		}
 
 		if (it->emissiveStrength != 1.0f) {
 			if (json.back() == '}') json += ',';
-			json += R"("KHR_materials_emissive_strength":{"emissiveStrength":)" + std::to_string(it->emissiveStrength) + '}';
+			json.write(R"("KHR_materials_emissive_strength":{"emissiveStrength":)", it->emissiveStrength, '}');
 		}
 
 		if (it->ior != 1.5f) {
 			if (json.back() == '}') json += ',';
-			json += R"("KHR_materials_ior":{"ior":)" + std::to_string(it->ior) + '}';
+			json.write(R"("KHR_materials_ior":{"ior":)", it->ior, '}');
 		}
 
 		if (it->iridescence) {
 			if (json.back() == '}') json += ',';
 			json += R"("KHR_materials_iridescence":{)";
 			if (it->iridescence->iridescenceFactor != 0.0f) {
-				json += R"("iridescenceFactor":)" + std::to_string(it->iridescence->iridescenceFactor);
+				json.write(R"("iridescenceFactor":)", it->iridescence->iridescenceFactor);
 			}
 			if (it->iridescence->iridescenceTexture.has_value()) {
 				if (json.back() != '{') json += ',';
@@ -4770,15 +7091,15 @@ void fg::Exporter::writeMaterials(const Asset& asset, std::string& json) {
 			}
 			if (it->iridescence->iridescenceIor != 1.3f) {
 				if (json.back() != '{') json += ',';
-				json += R"("iridescenceIor":)" + std::to_string(it->iridescence->iridescenceIor);
+				json.write(R"("iridescenceIor":)", it->iridescence->iridescenceIor);
 			}
 			if (it->iridescence->iridescenceThicknessMinimum != 100.0f) {
 				if (json.back() != '{') json += ',';
-				json += R"("iridescenceThicknessMinimum":)" + std::to_string(it->iridescence->iridescenceThicknessMinimum);
+				json.write(R"("iridescenceThicknessMinimum":)", it->iridescence->iridescenceThicknessMinimum);
 			}
 			if (it->iridescence->iridescenceThicknessMaximum != 400.0f) {
 				if (json.back() != '{') json += ',';
-				json += R"("iridescenceThicknessMaximum":)" + std::to_string(it->iridescence->iridescenceThicknessMaximum);
+				json.write(R"("iridescenceThicknessMaximum":)", it->iridescence->iridescenceThicknessMaximum);
 			}
 			if (it->iridescence->iridescenceThicknessTexture.has_value()) {
 				if (json.back() != '{') json += ',';
@@ -4792,10 +7113,7 @@ void fg::Exporter::writeMaterials(const Asset& asset, std::string& json) {
 			if (json.back() == '}') json += ',';
 			json += R"("KHR_materials_sheen":{)";
 			if (it->sheen->sheenColorFactor != math::nvec3(0)) {
-				json += R"("sheenColorFactor":[)" +
-					std::to_string(it->sheen->sheenColorFactor[0]) + ',' +
-					std::to_string(it->sheen->sheenColorFactor[1]) + ',' +
-					std::to_string(it->sheen->sheenColorFactor[2]) + ']';
+				json.write(R"("sheenColorFactor":[)", it->sheen->sheenColorFactor[0], ',', it->sheen->sheenColorFactor[1], ',', it->sheen->sheenColorFactor[2], ']');
 			}
 			if (it->sheen->sheenColorTexture.has_value()) {
 				if (json.back() != '{') json += ',';
@@ -4804,7 +7122,7 @@ void fg::Exporter::writeMaterials(const Asset& asset, std::string& json) {
 			}
 			if (it->sheen->sheenRoughnessFactor != 0.0f) {
 				if (json.back() != '{') json += ',';
-				json += R"("sheenRoughnessFactor":)" + std::to_string(it->sheen->sheenRoughnessFactor);
+				json.write(R"("sheenRoughnessFactor":)", it->sheen->sheenRoughnessFactor);
 			}
 			if (it->sheen->sheenRoughnessTexture.has_value()) {
 				if (json.back() != '{') json += ',';
@@ -4818,7 +7136,7 @@ void fg::Exporter::writeMaterials(const Asset& asset, std::string& json) {
 			if (json.back() == '}') json += ',';
 			json += R"("KHR_materials_specular":{)";
 			if (it->specular->specularFactor != 1.0f) {
-				json += R"("specularFactor":)" + std::to_string(it->specular->specularFactor);
+				json.write(R"("specularFactor":)", it->specular->specularFactor);
 			}
 			if (it->specular->specularTexture.has_value()) {
 				if (json.back() != '{') json += ',';
@@ -4827,10 +7145,7 @@ void fg::Exporter::writeMaterials(const Asset& asset, std::string& json) {
 			}
 			if (it->specular->specularColorFactor != math::nvec3(1)) {
 				if (json.back() != '{') json += ',';
-				json += R"("specularColorFactor":[)" +
-						std::to_string(it->specular->specularColorFactor[0]) + ',' +
-						std::to_string(it->specular->specularColorFactor[1]) + ',' +
-						std::to_string(it->specular->specularColorFactor[2]) + ']';
+				json.write(R"("specularColorFactor":[)", it->specular->specularColorFactor[0], ',', it->specular->specularColorFactor[1], ',', it->specular->specularColorFactor[2], ']');
 			}
 			if (it->specular->specularColorTexture.has_value()) {
 				if (json.back() != '{') json += ',';
@@ -4844,7 +7159,7 @@ void fg::Exporter::writeMaterials(const Asset& asset, std::string& json) {
 			if (json.back() == '}') json += ',';
 			json += R"("KHR_materials_transmission":{)";
 			if (it->transmission->transmissionFactor != 0.0f) {
-				json += R"("transmissionFactor":)" + std::to_string(it->transmission->transmissionFactor);
+				json.write(R"("transmissionFactor":)", it->transmission->transmissionFactor);
 			}
 			if (it->transmission->transmissionTexture.has_value()) {
 				if (json.back() != '{') json += ',';
@@ -4863,7 +7178,7 @@ void fg::Exporter::writeMaterials(const Asset& asset, std::string& json) {
 			if (json.back() == '}') json += ',';
 			json += R"("KHR_materials_volume":{)";
 			if (it->volume->thicknessFactor != 0.0f) {
-				json += R"("thicknessFactor":)" + std::to_string(it->volume->thicknessFactor);
+				json.write(R"("thicknessFactor":)", it->volume->thicknessFactor);
 			}
 			if (it->volume->thicknessTexture.has_value()) {
 				if (json.back() != '{') json += ',';
@@ -4872,14 +7187,11 @@ void fg::Exporter::writeMaterials(const Asset& asset, std::string& json) {
 			}
 			if (it->volume->attenuationDistance != std::numeric_limits<num>::infinity()) {
 				if (json.back() != '{') json += ',';
-				json += R"("attenuationDistance":)" + std::to_string(it->volume->attenuationDistance);
+				json.write(R"("attenuationDistance":)", it->volume->attenuationDistance);
 			}
 			if (it->volume->attenuationColor != math::nvec3(1)) {
 				if (json.back() != '{') json += ',';
-				json += R"("attenuationColor":[)" +
-						std::to_string(it->volume->attenuationColor[0]) + ',' +
-						std::to_string(it->volume->attenuationColor[1]) + ',' +
-						std::to_string(it->volume->attenuationColor[2]) + ']';
+				json.write(R"("attenuationColor":[)", it->volume->attenuationColor[0], ',', it->volume->attenuationColor[1], ',', it->volume->attenuationColor[2], ']');
 			}
 			json += '}';
 		}
@@ -4916,13 +7228,13 @@ void fg::Exporter::writeMaterials(const Asset& asset, std::string& json) {
 			if (extras.has_value()) {
 				if (json.back() != '{')
 					json += ',';
-				json += std::string("\"extras\":") + *extras;
+				json.write("\"extras\":", *extras);
 			}
 		}
 
 		if (!it->name.empty()) {
 			if (json.back() != ',') json += ',';
-			json += R"("name":")" + fg::escapeString(it->name) + '"';
+			json.write(R"("name":")", fg::escapeString(it->name), '"');
 		}
 		json += '}';
 		if (uabs(std::distance(asset.materials.begin(), it)) + 1 <asset.materials.size())
@@ -4931,7 +7243,7 @@ void fg::Exporter::writeMaterials(const Asset& asset, std::string& json) {
 	json += ']';
 }
 
-void fg::Exporter::writeMeshes(const Asset& asset, std::string& json) {
+void fg::Exporter::writeMeshes(const Asset& asset, JsonOutput& json) {
 	if (asset.meshes.empty())
 		return;
 	if (json.back() == ']' || json.back() == '}')
@@ -4950,7 +7262,7 @@ void fg::Exporter::writeMeshes(const Asset& asset, std::string& json) {
                 {
                     json += R"("attributes":{)";
                     for (auto ita = itp->attributes.begin(); ita != itp->attributes.end(); ++ita) {
-                        json += '"' + std::string(ita->name) + "\":" + std::to_string(ita->accessorIndex);
+                        json.write('"', ita->name, "\":", ita->accessorIndex);
                         if (uabs(std::distance(itp->attributes.begin(), ita)) + 1 <itp->attributes.size())
                             json += ',';
                     }
@@ -4958,15 +7270,15 @@ void fg::Exporter::writeMeshes(const Asset& asset, std::string& json) {
                 }
 
                 if (itp->indicesAccessor.has_value()) {
-                    json += R"(,"indices":)" + std::to_string(itp->indicesAccessor.value());
+                    json.write(R"(,"indices":)", itp->indicesAccessor.value());
                 }
 
                 if (itp->materialIndex.has_value()) {
-                    json += R"(,"material":)" + std::to_string(itp->materialIndex.value());
+                    json.write(R"(,"material":)", itp->materialIndex.value());
                 }
 
                 if (itp->type != PrimitiveType::Triangles) {
-                    json += R"(,"mode":)" + std::to_string(to_underlying(itp->type));
+                    json.write(R"(,"mode":)", to_underlying(itp->type));
                 }
 
 				if (!itp->mappings.empty()) {
@@ -4977,7 +7289,7 @@ void fg::Exporter::writeMeshes(const Asset& asset, std::string& json) {
 							continue;
 						if (json.back() == '}')
 							json += ',';
-						json += "{\"material\":" + std::to_string(itp->mappings[i].value()) + ",\"variants\":[" + std::to_string(i) + "]}";
+						json.write("{\"material\":", itp->mappings[i].value(), ",\"variants\":[", i, "]}");
 					}
 					json += "]}}";
 				}
@@ -4996,7 +7308,7 @@ void fg::Exporter::writeMeshes(const Asset& asset, std::string& json) {
 			json += R"("weights":[)";
 			auto itw = it->weights.begin();
 			while (itw != it->weights.end()) {
-				json += std::to_string(*itw);
+				json.write(*itw);
 				++itw;
 				if (uabs(std::distance(it->weights.begin(), itw)) < it->weights.size())
 					json += ',';
@@ -5009,14 +7321,14 @@ void fg::Exporter::writeMeshes(const Asset& asset, std::string& json) {
 			if (extras.has_value()) {
 				if (json.back() != '{')
 					json += ',';
-				json += std::string("\"extras\":") + *extras;
+				json.write("\"extras\":", *extras);
 			}
 		}
 
 		if (!it->name.empty()) {
             if (json.back() != '{')
                 json += ',';
-            json += R"("name":")" + fg::escapeString(it->name) + '"';
+            json.write(R"("name":")", fg::escapeString(it->name), '"');
         }
 		json += '}';
 		if (uabs(std::distance(asset.meshes.begin(), it)) + 1 <asset.meshes.size())
@@ -5025,7 +7337,7 @@ void fg::Exporter::writeMeshes(const Asset& asset, std::string& json) {
 	json += ']';
 }
 
-void fg::Exporter::writeNodes(const Asset& asset, std::string& json) {
+void fg::Exporter::writeNodes(const Asset& asset, JsonOutput& json) {
 	if (asset.nodes.empty())
 		return;
 	if (json.back() == ']' || json.back() == '}')
@@ -5036,17 +7348,17 @@ void fg::Exporter::writeNodes(const Asset& asset, std::string& json) {
 		json += '{';
 
 		if (it->meshIndex.has_value()) {
-			json += R"("mesh":)" + std::to_string(it->meshIndex.value());
+			json.write(R"("mesh":)", it->meshIndex.value());
 		}
 		if (it->cameraIndex.has_value()) {
 			if (json.back() != '{')
 				json += ',';
-			json += R"("camera":)" + std::to_string(it->cameraIndex.value());
+			json.write(R"("camera":)", it->cameraIndex.value());
 		}
 		if (it->skinIndex.has_value()) {
 			if (json.back() != '{')
 				json += ',';
-			json += R"("skin":)" + std::to_string(it->skinIndex.value());
+			json.write(R"("skin":)", it->skinIndex.value());
 		}
 
 		if (!it->children.empty()) {
@@ -5055,7 +7367,7 @@ void fg::Exporter::writeNodes(const Asset& asset, std::string& json) {
 			json += R"("children":[)";
 			auto itc = it->children.begin();
 			while (itc != it->children.end()) {
-				json += std::to_string(*itc);
+				json.write(*itc);
 				++itc;
 				if (uabs(std::distance(it->children.begin(), itc)) < it->children.size())
 					json += ',';
@@ -5069,7 +7381,7 @@ void fg::Exporter::writeNodes(const Asset& asset, std::string& json) {
 			json += R"("weights":[)";
 			auto itw = it->weights.begin();
 			while (itw != it->weights.end()) {
-				json += std::to_string(*itw);
+				json.write(*itw);
 				++itw;
 				if (uabs(std::distance(it->weights.begin(), itw)) < it->weights.size())
 					json += ',';
@@ -5083,7 +7395,7 @@ void fg::Exporter::writeNodes(const Asset& asset, std::string& json) {
 					if (json.back() != '{')
 						json += ',';
 					json += R"("rotation":[)";
-					json += std::to_string(trs.rotation[0]) + ',' + std::to_string(trs.rotation[1]) + ',' + std::to_string(trs.rotation[2]) + ',' + std::to_string(trs.rotation[3]);
+					json.write(trs.rotation[0], ',', trs.rotation[1], ',', trs.rotation[2], ',', trs.rotation[3]);
 					json += "]";
 				}
 
@@ -5091,7 +7403,7 @@ void fg::Exporter::writeNodes(const Asset& asset, std::string& json) {
 					if (json.back() != '{')
 						json += ',';
 					json += R"("scale":[)";
-					json += std::to_string(trs.scale[0]) + ',' + std::to_string(trs.scale[1]) + ',' + std::to_string(trs.scale[2]);
+					json.write(trs.scale[0], ',', trs.scale[1], ',', trs.scale[2]);
 					json += "]";
 				}
 
@@ -5099,7 +7411,7 @@ void fg::Exporter::writeNodes(const Asset& asset, std::string& json) {
 					if (json.back() != '{')
 						json += ',';
 					json += R"("translation":[)";
-					json += std::to_string(trs.translation[0]) + ',' + std::to_string(trs.translation[1]) + ',' + std::to_string(trs.translation[2]);
+					json.write(trs.translation[0], ',', trs.translation[1], ',', trs.translation[2]);
 					json += "]";
 				}
 			},
@@ -5109,7 +7421,7 @@ void fg::Exporter::writeNodes(const Asset& asset, std::string& json) {
 				json += R"("matrix":[)";
 				for (std::size_t i = 0; i < matrix.columns(); ++i) {
 					for (std::size_t j = 0; j < matrix.rows(); ++j) {
-						json += std::to_string(matrix.col(i)[j]);
+						json.write(matrix.col(i)[j]);
 						if (i * matrix.columns() + j + 1 < matrix.columns() * matrix.rows()) {
 							json += ',';
 						}
@@ -5125,7 +7437,7 @@ void fg::Exporter::writeNodes(const Asset& asset, std::string& json) {
 			if (!it->instancingAttributes.empty()) {
 				json += R"("EXT_mesh_gpu_instancing":{"attributes":{)";
 				for (auto ait = it->instancingAttributes.begin(); ait != it->instancingAttributes.end(); ++ait) {
-					json += '"' + std::string(ait->name) + "\":" + std::to_string(ait->accessorIndex);
+					json.write('"', ait->name, "\":", ait->accessorIndex);
 					if (uabs(std::distance(it->instancingAttributes.begin(), ait)) + 1 <
 						it->instancingAttributes.size())
 						json += ',';
@@ -5134,7 +7446,7 @@ void fg::Exporter::writeNodes(const Asset& asset, std::string& json) {
 			}
 			if (it->lightIndex.has_value()) {
 				if (json.back() != '{') json += ',';
-				json += R"("KHR_lights_punctual":{"light":)" + std::to_string(it->lightIndex.value()) + "}";
+				json.write(R"("KHR_lights_punctual":{"light":)", it->lightIndex.value(), "}");
 			}
 			json += "}";
 		}
@@ -5144,14 +7456,14 @@ void fg::Exporter::writeNodes(const Asset& asset, std::string& json) {
 			if (extras.has_value()) {
 				if (json.back() != '{')
 					json += ',';
-				json += std::string("\"extras\":") + *extras;
+				json.write("\"extras\":", *extras);
 			}
 		}
 
 		if (!it->name.empty()) {
 			if (json.back() != '{')
 				json += ',';
-			json += R"("name":")" + fg::escapeString(it->name) + '"';
+			json.write(R"("name":")", fg::escapeString(it->name), '"');
 		}
 		json += '}';
 		if (uabs(std::distance(asset.nodes.begin(), it)) + 1 <asset.nodes.size())
@@ -5160,7 +7472,7 @@ void fg::Exporter::writeNodes(const Asset& asset, std::string& json) {
 	json += ']';
 }
 
-void fg::Exporter::writeSamplers(const Asset& asset, std::string& json) {
+void fg::Exporter::writeSamplers(const Asset& asset, JsonOutput& json) {
 	if (asset.samplers.empty())
 		return;
 	if (json.back() == ']' || json.back() == '}')
@@ -5171,19 +7483,19 @@ void fg::Exporter::writeSamplers(const Asset& asset, std::string& json) {
 		json += '{';
 
 		if (it->magFilter.has_value()) {
-			json += R"("magFilter":)" + std::to_string(to_underlying(it->magFilter.value()));
+			json.write(R"("magFilter":)", to_underlying(it->magFilter.value()));
 		}
 		if (it->minFilter.has_value()) {
 			if (json.back() != '{') json += ',';
-			json += R"("minFilter":)" + std::to_string(to_underlying(it->minFilter.value()));
+			json.write(R"("minFilter":)", to_underlying(it->minFilter.value()));
 		}
 		if (it->wrapS != Wrap::Repeat) {
 			if (json.back() != '{') json += ',';
-			json += R"("wrapS":)" + std::to_string(to_underlying(it->wrapS));
+			json.write(R"("wrapS":)", to_underlying(it->wrapS));
 		}
 		if (it->wrapT != Wrap::Repeat) {
 			if (json.back() != '{') json += ',';
-			json += R"("wrapT":)" + std::to_string(to_underlying(it->wrapT));
+			json.write(R"("wrapT":)", to_underlying(it->wrapT));
 		}
 
 		if (extrasWriteCallback != nullptr) {
@@ -5191,13 +7503,13 @@ void fg::Exporter::writeSamplers(const Asset& asset, std::string& json) {
 			if (extras.has_value()) {
 				if (json.back() != '{')
 					json += ',';
-				json += std::string("\"extras\":") + *extras;
+				json.write("\"extras\":", *extras);
 			}
 		}
 
 		if (!it->name.empty()) {
 			if (json.back() != '{') json += ',';
-			json += R"("name":")" + fg::escapeString(it->name) + '"';
+			json.write(R"("name":")", fg::escapeString(it->name), '"');
 		}
 		json += '}';
 		if (uabs(std::distance(asset.samplers.begin(), it)) + 1 <asset.samplers.size())
@@ -5206,14 +7518,14 @@ void fg::Exporter::writeSamplers(const Asset& asset, std::string& json) {
 	json += ']';
 }
 
-void fg::Exporter::writeScenes(const Asset& asset, std::string& json) {
+void fg::Exporter::writeScenes(const Asset& asset, JsonOutput& json) {
 	if (asset.scenes.empty())
 		return;
 	if (json.back() == ']' || json.back() == '}')
 		json += ',';
 
 	if (asset.defaultScene.has_value()) {
-		json += "\"scene\":" + std::to_string(asset.defaultScene.value()) + ',';
+		json.write("\"scene\":", asset.defaultScene.value(), ',');
 	}
 
 	json += "\"scenes\":[";
@@ -5223,7 +7535,7 @@ void fg::Exporter::writeScenes(const Asset& asset, std::string& json) {
 		json += R"("nodes":[)";
 		auto itn = it->nodeIndices.begin();
 		while (itn != it->nodeIndices.end()) {
-			json += std::to_string(*itn);
+			json.write(*itn);
 			++itn;
 			if (uabs(std::distance(it->nodeIndices.begin(), itn)) < it->nodeIndices.size())
 				json += ',';
@@ -5235,12 +7547,12 @@ void fg::Exporter::writeScenes(const Asset& asset, std::string& json) {
 			if (extras.has_value()) {
 				if (json.back() != '{')
 					json += ',';
-				json += std::string("\"extras\":") + *extras;
+				json.write("\"extras\":", *extras);
 			}
 		}
 
 		if (!it->name.empty())
-			json += R"(,"name":")" + fg::escapeString(it->name) + '"';
+			json.write(R"(,"name":")", fg::escapeString(it->name), '"');
 		json += '}';
 		if (uabs(std::distance(asset.scenes.begin(), it)) + 1 <asset.scenes.size())
 			json += ',';
@@ -5248,7 +7560,7 @@ void fg::Exporter::writeScenes(const Asset& asset, std::string& json) {
 	json += ']';
 }
 
-void fg::Exporter::writeSkins(const Asset& asset, std::string& json) {
+void fg::Exporter::writeSkins(const Asset& asset, JsonOutput& json) {
 	if (asset.skins.empty())
 		return;
 	if (json.back() == ']' || json.back() == '}')
@@ -5259,15 +7571,15 @@ void fg::Exporter::writeSkins(const Asset& asset, std::string& json) {
 		json += '{';
 
 		if (it->inverseBindMatrices.has_value())
-			json += R"("inverseBindMatrices":)" + std::to_string(it->inverseBindMatrices.value()) + ',';
+			json.write(R"("inverseBindMatrices":)", it->inverseBindMatrices.value(), ',');
 
 		if (it->skeleton.has_value())
-			json += R"("skeleton":)" + std::to_string(it->skeleton.value()) + ',';
+			json.write(R"("skeleton":)", it->skeleton.value(), ',');
 
 		json += R"("joints":[)";
 		auto itj = it->joints.begin();
 		while (itj != it->joints.end()) {
-			json += std::to_string(*itj);
+			json.write(*itj);
 			++itj;
 			if (uabs(std::distance(it->joints.begin(), itj)) < it->joints.size())
 				json += ',';
@@ -5279,12 +7591,12 @@ void fg::Exporter::writeSkins(const Asset& asset, std::string& json) {
 			if (extras.has_value()) {
 				if (json.back() != '{')
 					json += ',';
-				json += std::string("\"extras\":") + *extras;
+				json.write("\"extras\":", *extras);
 			}
 		}
 
 		if (!it->name.empty())
-			json += R"(,"name":")" + fg::escapeString(it->name) + '"';
+			json.write(R"(,"name":")", fg::escapeString(it->name), '"');
 		json += '}';
 		if (uabs(std::distance(asset.skins.begin(), it)) + 1 <asset.skins.size())
 			json += ',';
@@ -5292,7 +7604,7 @@ void fg::Exporter::writeSkins(const Asset& asset, std::string& json) {
 	json += ']';
 }
 
-void fg::Exporter::writeTextures(const Asset& asset, std::string& json) {
+void fg::Exporter::writeTextures(const Asset& asset, JsonOutput& json) {
 	if (asset.textures.empty())
 		return;
 	if (json.back() == ']' || json.back() == '}')
@@ -5303,26 +7615,26 @@ void fg::Exporter::writeTextures(const Asset& asset, std::string& json) {
 		json += '{';
 
 		if (it->samplerIndex.has_value())
-			json += R"("sampler":)" + std::to_string(it->samplerIndex.value());
+			json.write(R"("sampler":)", it->samplerIndex.value());
 
 		if (it->imageIndex.has_value()) {
 			if (json.back() != '{') json += ',';
-			json += R"("source":)" + std::to_string(it->imageIndex.value());
+			json.write(R"("source":)", it->imageIndex.value());
 		}
 
 		if (it->basisuImageIndex.has_value() || it->ddsImageIndex.has_value() || it->webpImageIndex.has_value()) {
 			if (json.back() != '{') json += ',';
 			json += R"("extensions":{)";
 			if (it->basisuImageIndex.has_value()) {
-				json += R"("KHR_texture_basisu":{"source":)" + std::to_string(it->basisuImageIndex.value()) + '}';
+				json.write(R"("KHR_texture_basisu":{"source":)", it->basisuImageIndex.value(), '}');
 			}
 			if (it->ddsImageIndex.has_value()) {
 				if (json.back() == '}') json += ',';
-				json += R"("MSFT_texture_dds":{"source":)" + std::to_string(it->ddsImageIndex.value()) + '}';
+				json.write(R"("MSFT_texture_dds":{"source":)", it->ddsImageIndex.value(), '}');
 			}
 			if (it->webpImageIndex.has_value()) {
 				if (json.back() == '}') json += ',';
-				json += R"("EXT_texture_webp":{"source":)" + std::to_string(it->webpImageIndex.value()) + '}';
+				json.write(R"("EXT_texture_webp":{"source":)", it->webpImageIndex.value(), '}');
 			}
 			json += "}";
 		}
@@ -5332,12 +7644,12 @@ void fg::Exporter::writeTextures(const Asset& asset, std::string& json) {
 			if (extras.has_value()) {
 				if (json.back() != '{')
 					json += ',';
-				json += std::string("\"extras\":") + *extras;
+				json.write("\"extras\":", *extras);
 			}
 		}
 
 		if (!it->name.empty())
-			json += R"(,"name":")" + fg::escapeString(it->name) + '"';
+			json.write(R"(,"name":")", fg::escapeString(it->name), '"');
 		json += '}';
 		if (uabs(std::distance(asset.textures.begin(), it)) + 1 <asset.textures.size())
 			json += ',';
@@ -5345,7 +7657,7 @@ void fg::Exporter::writeTextures(const Asset& asset, std::string& json) {
 	json += ']';
 }
 
-void fg::Exporter::writeExtensions(const fastgltf::Asset& asset, std::string& json) {
+void fg::Exporter::writeExtensions(const fastgltf::Asset& asset, JsonOutput& json) {
 	if (json.back() == ']' || json.back() == '}')
 		json += ',';
     json += "\"extensions\":{";
@@ -5359,7 +7671,7 @@ void fg::Exporter::writeExtensions(const fastgltf::Asset& asset, std::string& js
 		for (const auto& variant : asset.materialVariants) {
 			if (json.back() == '}')
 				json += ',';
-			json += R"({"name":")" + variant + "\"}";
+			json.write(R"({"name":")", variant, "\"}");
 		}
 		json += "]}";
 	}
@@ -5405,9 +7717,34 @@ fs::path fg::Exporter::getImageFilePath(const Asset& asset, std::size_t index, M
 	return imageFolder / (std::string(imageName) + std::string(extension));
 }
 
+namespace fastgltf {
+	/** A rough estimate of the compact JSON size, so that the output rarely needs to grow while writing. */
+	static std::size_t estimateJsonSize(const Asset& asset) {
+		std::size_t size = 256;
+		size += asset.accessors.size() * 160;
+		size += asset.bufferViews.size() * 80;
+		size += (asset.buffers.size() + asset.images.size()) * 96;
+		size += asset.materials.size() * 256;
+		size += asset.nodes.size() * 128;
+		size += (asset.textures.size() + asset.samplers.size() + asset.cameras.size() + asset.skins.size()) * 64;
+		for (const auto& mesh : asset.meshes)
+			size += 32 + mesh.primitives.size() * 160;
+		for (const auto& animation : asset.animations)
+			size += 32 + (animation.channels.size() + animation.samplers.size()) * 64;
+		for (const auto& scene : asset.scenes)
+			size += 32 + scene.nodeIndices.size() * 8;
+		return size;
+	}
+} // namespace fastgltf
+
 std::string fg::Exporter::writeJson(const fastgltf::Asset &asset) {
-    // Fairly rudimentary approach of just composing the JSON string using a std::string.
-    std::string outputString;
+	errorCode = Error::None;
+
+	// The JSON is composed directly into a string, which is pretty-printed while writing if requested.
+	const bool pretty = hasBit(options, ExportOptions::PrettyPrintJson);
+	JsonOutput outputString(pretty);
+	outputString.reserve(pretty ? estimateJsonSize(asset) * 3 / 2 : estimateJsonSize(asset));
+
 
     outputString += "{";
 
@@ -5415,10 +7752,10 @@ std::string fg::Exporter::writeJson(const fastgltf::Asset &asset) {
     outputString += "\"asset\":{";
     if (asset.assetInfo.has_value()) {
         if (!asset.assetInfo->copyright.empty())
-            outputString += R"("copyright":")" + fg::escapeString(asset.assetInfo->copyright) + "\",";
+            outputString.write(R"("copyright":")", fg::escapeString(asset.assetInfo->copyright), "\",");
         if (!asset.assetInfo->generator.empty())
-            outputString += R"("generator":")" + fg::escapeString(asset.assetInfo->generator) + "\",";
-        outputString += R"("version":")" + asset.assetInfo->gltfVersion + '"';
+            outputString.write(R"("generator":")", fg::escapeString(asset.assetInfo->generator), "\",");
+        outputString.write(R"("version":")", asset.assetInfo->gltfVersion, '"');
     } else {
         outputString += R"("generator":"fastgltf",)";
         outputString += R"("version":"2.0")";
@@ -5430,7 +7767,7 @@ std::string fg::Exporter::writeJson(const fastgltf::Asset &asset) {
 		if (outputString.back() != '{') outputString += ',';
 		outputString += "\"extensionsUsed\":[";
 		for (auto it = asset.extensionsUsed.begin(); it != asset.extensionsUsed.end(); ++it) {
-			outputString += '\"' + *it + '\"';
+			outputString.write('\"', *it, '\"');
 			if (uabs(std::distance(asset.extensionsUsed.begin(), it)) + 1 <asset.extensionsUsed.size())
 				outputString += ',';
 		}
@@ -5440,35 +7777,57 @@ std::string fg::Exporter::writeJson(const fastgltf::Asset &asset) {
 		if (outputString.back() != '{') outputString += ',';
 		outputString += "\"extensionsRequired\":[";
 		for (auto it = asset.extensionsRequired.begin(); it != asset.extensionsRequired.end(); ++it) {
-			outputString += '\"' + *it + '\"';
+			outputString.write('\"', *it, '\"');
 			if (uabs(std::distance(asset.extensionsRequired.begin(), it)) + 1 <asset.extensionsRequired.size())
 				outputString += ',';
 		}
 		outputString += ']';
 	}
 
-    writeAccessors(asset, outputString);
-    writeAnimations(asset, outputString);
-    writeBuffers(asset, outputString);
-    writeBufferViews(asset, outputString);
-    writeCameras(asset, outputString);
-    writeImages(asset, outputString);
-    writeMaterials(asset, outputString);
-    writeMeshes(asset, outputString);
-    writeNodes(asset, outputString);
-    writeSamplers(asset, outputString);
-    writeScenes(asset, outputString);
-    writeSkins(asset, outputString);
-    writeTextures(asset, outputString);
-    writeExtensions(asset, outputString);
-
-    outputString += "}";
-
-    if (hasBit(options, ExportOptions::PrettyPrintJson)) {
-        prettyPrintJson(outputString);
-    }
+	// The categories in the order they appear in the JSON.
+	using CategoryWriter = void (Exporter::*)(const Asset&, JsonOutput&);
+	static constexpr std::array<CategoryWriter, 14> categoryWriters = {{
+		&Exporter::writeAccessors, &Exporter::writeAnimations, &Exporter::writeBuffers, &Exporter::writeBufferViews,
+		&Exporter::writeCameras, &Exporter::writeImages, &Exporter::writeMaterials, &Exporter::writeMeshes,
+		&Exporter::writeNodes, &Exporter::writeSamplers, &Exporter::writeScenes, &Exporter::writeSkins,
+		&Exporter::writeTextures, &Exporter::writeExtensions,
+	}};
+
+	if (hasBit(options, ExportOptions::WriteCategoriesInParallel)) {
+		// Every category is written into its own output, which starts out with the state the sequential
+		// output would have, and the outputs are then concatenated in order. This works because each
+		// category only looks at the previous character to decide whether it needs a comma, which is always
+		// the end of either the asset info or an array.
+		std::vector<JsonOutput> outputs(categoryWriters.size(), JsonOutput(pretty, 1, outputString.back()));
+
+		// The buffers and images modify the exporter's state, so they're written on this thread.
+		constexpr std::size_t buffersIndex = 2;
+		constexpr std::size_t imagesIndex = 5;
+		writeBuffers(asset, outputs[buffersIndex]);
+		writeImages(asset, outputs[imagesIndex]);
+
+		struct CategoryTaskData {
+			Exporter* exporter;
+			const Asset* asset;
+			JsonOutput* outputs;
+		} taskData { this, &asset, outputs.data() };
+		executeTasks(categoryWriters.size(), [](std::size_t taskIndex, void* data) {
+			if (taskIndex == buffersIndex || taskIndex == imagesIndex)
+				return;
+			auto& task = *static_cast<CategoryTaskData*>(data);
+			(task.exporter->*categoryWriters[taskIndex])(*task.asset, task.outputs[taskIndex]);
+		}, &taskData, executorCallback, userPointer);
+
+		for (const auto& output : outputs)
+			outputString.append(output);
+	} else {
+		for (auto writer : categoryWriters)
+			(this->*writer)(asset, outputString);
+	}
+
+	outputString += '}';
 
-    return outputString;
+	return std::move(outputString.str());
 }
 
 fg::Expected<fg::ExportResult<std::string>> fg::Exporter::writeGltfJson(const Asset& asset, ExportOptions _options) {
@@ -5497,34 +7856,63 @@ fg::Expected<fg::ExportResult<std::string>> fg::Exporter::writeGltfJson(const As
     return std::move(result);
 }
 
-fg::Expected<fg::ExportResult<std::vector<std::byte>>> fg::Exporter::writeGltfBinary(const Asset& asset, ExportOptions _options) {
+fg::Expected<std::size_t> fg::Exporter::writeBinaryRanges(const Asset& asset, ExportOptions _options, std::string& json,
+		std::array<std::byte, 28>& headers, std::vector<span<const std::byte>>& ranges) {
     bufferPaths.clear();
     imagePaths.clear();
+	bufferIndices.clear();
+	bufferOffsets.clear();
+	mergedBufferLength = 0;
     options = _options;
 	exportingBinary = true;
 
     options &= (~ExportOptions::PrettyPrintJson);
 
-    ExportResult<std::vector<std::byte>> result;
-    auto json = writeJson(asset);
+	// We only support writing Vectors, Arrays, and ByteViews as embedded buffers.
+	auto isEmbeddable = [](const Buffer& buffer) {
+		return std::holds_alternative<sources::Array>(buffer.data) || std::holds_alternative<sources::ByteView>(buffer.data)
+			|| std::holds_alternative<sources::Vector>(buffer.data);
+	};
+	constexpr auto maxChunkLength = static_cast<std::size_t>(std::numeric_limits<decltype(BinaryGltfChunk::chunkLength)>::max());
+	constexpr std::int64_t mergedBufferAlignment = 16;
+
+	SmallVector<std::size_t, 4> embeddedBuffers;
+	if (hasBit(options, ExportOptions::MergeBuffersIntoBinaryChunk)) {
+		bufferIndices.resize(asset.buffers.size());
+		bufferOffsets.resize(asset.buffers.size());
+		std::size_t nextBufferIndex = 1;
+		for (std::size_t i = 0; i < asset.buffers.size(); ++i) {
+			if (!isEmbeddable(asset.buffers[i])) {
+				bufferIndices[i] = nextBufferIndex++;
+				continue;
+			}
+			mergedBufferLength = alignUp(mergedBufferLength, mergedBufferAlignment);
+			bufferIndices[i] = 0;
+			bufferOffsets[i] = mergedBufferLength;
+			mergedBufferLength += asset.buffers[i].byteLength;
+			embeddedBuffers.emplace_back(i);
+		}
+		if (embeddedBuffers.empty()) {
+			bufferIndices.clear();
+			bufferOffsets.clear();
+		} else if (mergedBufferLength >= maxChunkLength) {
+			return Error::InvalidGLB;
+		}
+	} else if (!asset.buffers.empty() && isEmbeddable(asset.buffers.front()) && asset.buffers.front().byteLength < maxChunkLength) {
+		embeddedBuffers.emplace_back(0);
+		mergedBufferLength = asset.buffers.front().byteLength;
+	}
+
+    json = writeJson(asset);
     if (errorCode != Error::None) {
 		return errorCode;
     }
 
-    result.bufferPaths = std::move(bufferPaths);
-    result.imagePaths = std::move(imagePaths);
-
-	// TODO: Add ExportOption enumeration for disabling this?
-    const bool withEmbeddedBuffer = !asset.buffers.empty()
-			// We only support writing Vectors and ByteViews as embedded buffers
-			&& (std::holds_alternative<sources::Array>(asset.buffers.front().data) || std::holds_alternative<sources::ByteView>(asset.buffers.front().data) || std::holds_alternative<sources::Vector>(asset.buffers.front().data))
-			&& asset.buffers.front().byteLength < std::numeric_limits<decltype(BinaryGltfChunk::chunkLength)>::max();
-
     std::size_t binarySize = 0;
     binarySize += sizeof(BinaryGltfHeader); // glTF header
     binarySize += sizeof(BinaryGltfChunk) + alignUp(json.size(), 4); // JSON chunk
-    if (withEmbeddedBuffer) {
-        binarySize += sizeof(BinaryGltfChunk) + alignUp(asset.buffers.front().byteLength, 4); // BIN chunk
+    if (!embeddedBuffers.empty()) {
+        binarySize += sizeof(BinaryGltfChunk) + alignUp(mergedBufferLength, 4); // BIN chunk
     }
 
 	// A GLB is limited to 2^32 bytes since the length field in the file header is a 32-bit integer.
@@ -5532,68 +7920,112 @@ fg::Expected<fg::ExportResult<std::vector<std::byte>>> fg::Exporter::writeGltfBi
 		return Error::InvalidGLB;
 	}
 
-    result.output.resize(binarySize);
-    auto write = [output = result.output.data()](const void* data, std::size_t size) mutable {
-        std::memcpy(output, data, size);
-        output += size;
-    };
+	// The padding is taken from these, so that it can be referenced just like the data itself.
+	static constexpr std::array<std::byte, 16> zeros {};
+	static constexpr std::array<std::byte, 4> spaces { std::byte(0x20), std::byte(0x20), std::byte(0x20), std::byte(0x20) };
+
+	ranges.clear();
+	auto* headerBytes = headers.data();
+	auto addHeader = [&](const auto& bytes) {
+		std::memcpy(headerBytes, bytes.data(), bytes.size());
+		ranges.emplace_back(headerBytes, bytes.size());
+		headerBytes += bytes.size();
+	};
+	auto addRange = [&](const std::byte* data, std::size_t size) {
+		if (size != 0)
+			ranges.emplace_back(data, size);
+	};
 
 	// Write glTF header
 	BinaryGltfHeader header {};
 	header.magic = binaryGltfHeaderMagic;
 	header.version = 2;
 	header.length = static_cast<std::uint32_t>(binarySize);
-	auto headerBytes = writeBinaryHeader(header);
-	write(headerBytes.data(), headerBytes.size());
+	addHeader(writeBinaryHeader(header));
 
-	// Write JSON chunk
+	// Write JSON chunk, padded with space characters (0x20)
 	BinaryGltfChunk jsonChunk {};
 	jsonChunk.chunkType = binaryGltfJsonChunkMagic;
 	jsonChunk.chunkLength = static_cast<std::uint32_t>(alignUp(json.size(), 4));
-	auto chunkBytes = writeBinaryChunk(jsonChunk);
-	write(chunkBytes.data(), chunkBytes.size());
-
-    write(json.data(), json.size());
-
-    // 4 bytes padding with space character (0x20)
-    for (std::size_t i = json.size(); i % 4 != 0; ++i) {
-        static constexpr std::uint8_t space = 0x20U;
-        write(&space, sizeof space);
-    }
-
-    if (withEmbeddedBuffer) {
-        const auto& buffer = asset.buffers.front();
+	addHeader(writeBinaryChunk(jsonChunk));
+	addRange(reinterpret_cast<const std::byte*>(json.data()), json.size());
+	addRange(spaces.data(), jsonChunk.chunkLength - json.size());
 
-        // Write BIN chunk
+    if (!embeddedBuffers.empty()) {
+        // Write BIN chunk, padded with zeros
         BinaryGltfChunk dataChunk {};
         dataChunk.chunkType = binaryGltfDataChunkMagic;
-        dataChunk.chunkLength = static_cast<std::uint32_t>(alignUp(buffer.byteLength, 4));
-		chunkBytes = writeBinaryChunk(dataChunk);
-		write(chunkBytes.data(), chunkBytes.size());
+        dataChunk.chunkLength = static_cast<std::uint32_t>(alignUp(mergedBufferLength, 4));
+		addHeader(writeBinaryChunk(dataChunk));
+
+		std::size_t offset = 0;
+		for (auto bufferIndex : embeddedBuffers) {
+			const auto& buffer = asset.buffers[bufferIndex];
+			const auto bufferOffset = getExportedBufferOffset(bufferIndex);
+			addRange(zeros.data(), bufferOffset - offset);
+			addRange(getLoadedBufferBytes(buffer).data(), buffer.byteLength);
+			offset = bufferOffset + buffer.byteLength;
+		}
+		addRange(zeros.data(), dataChunk.chunkLength - offset);
+    }
 
-		std::visit(visitor {
-			[](auto&) {},
-			[&](const sources::Array& vector) {
-				write(vector.bytes.data(), buffer.byteLength);
-			},
-			[&](const sources::Vector& vector) {
-				write(vector.bytes.data(), buffer.byteLength);
-			},
-			[&](const sources::ByteView& byteView) {
-				write(byteView.bytes.data(), buffer.byteLength);
-			},
-		}, buffer.data);
+	return binarySize;
+}
 
-        // 4 bytes padding with zeros
-        for (std::size_t i = buffer.byteLength; i % 4 != 0; ++i) {
-            static constexpr std::uint8_t zero = 0x0U;
-            write(&zero, sizeof zero);
-        }
-    }
+fg::Expected<fg::ExportResult<std::vector<std::byte>>> fg::Exporter::writeGltfBinary(const Asset& asset, ExportOptions _options) {
+	std::string json;
+	std::array<std::byte, 28> headers {};
+	std::vector<span<const std::byte>> ranges;
+	auto binarySize = writeBinaryRanges(asset, _options, json, headers, ranges);
+	if (binarySize.error() != Error::None) {
+		return binarySize.error();
+	}
 
+    ExportResult<std::vector<std::byte>> result;
+    result.output.resize(binarySize.get());
+	auto* output = result.output.data();
+	for (const auto& range : ranges) {
+		std::memcpy(output, range.data(), range.size());
+		output += range.size();
+	}
+
+    result.bufferPaths = std::move(bufferPaths);
+    result.imagePaths = std::move(imagePaths);
     return std::move(result);
 }
 
+fg::Expected<fg::ExportResult<std::size_t>> fg::Exporter::writeGltfBinary(const Asset& asset, BinaryWriteCallback* callback,
+		void* callbackUserPointer, ExportOptions _options) {
+	assert(callback != nullptr);
+	std::string json;
+	std::array<std::byte, 28> headers {};
+	std::vector<span<const std::byte>> ranges;
+	auto binarySize = writeBinaryRanges(asset, _options, json, headers, ranges);
+	if (binarySize.error() != Error::None) {
+		return binarySize.error();
+	}
+
+	if (!callback(span<const span<const std::byte>>(ranges.data(), ranges.size()), callbackUserPointer)) {
+		return Error::FailedWritingFiles;
+	}
+
+	ExportResult<std::size_t> result;
+	result.output = binarySize.get();
+	result.bufferPaths = std::move(bufferPaths);
+	result.imagePaths = std::move(imagePaths);
+	return std::move(result);
+}
+
+fg::Expected<fg::ExportResult<std::size_t>> fg::Exporter::writeGltfBinary(const Asset& asset, std::ostream& stream, ExportOptions _options) {
+	return writeGltfBinary(asset, [](span<const span<const std::byte>> ranges, void* pointer) {
+		auto& output = *static_cast<std::ostream*>(pointer);
+		for (std::size_t i = 0; i < ranges.size(); ++i) {
+			output.write(reinterpret_cast<const char*>(ranges[i].data()), static_cast<std::streamsize>(ranges[i].size()));
+		}
+		return output.good();
+	}, &stream, _options);
+}
+
 namespace fastgltf {
 	bool writeFile(const DataSource& dataSource, const fs::path& baseFolder, const fs::path& filePath) {
 		// Get the final normalized path. TODO: Perhaps move these filesystem checks to the parent function?
@@ -5690,6 +8122,78 @@ fg::Error fg::FileExporter::writeGltfJson(const Asset& asset, fs::path target, E
     return Error::None;
 }
 
+namespace fastgltf {
+	/** The target of FileExporter::writeGltfBinary, which is only opened once the GLB has been written successfully. */
+	struct BinaryFileTarget {
+		const fs::path& path;
+		bool openFailed = false;
+#if defined(__APPLE__) || defined(__linux__)
+		int file = -1;
+#else
+		std::ofstream file;
+#endif
+	};
+
+	/**
+	 * Opens the target file and writes all ranges to it. On POSIX systems this uses writev, continuing after
+	 * partial writes.
+	 */
+	static bool writeRangesToFile(span<const span<const std::byte>> ranges, void* userPointer) {
+		auto& target = *static_cast<BinaryFileTarget*>(userPointer);
+#if defined(__APPLE__) || defined(__linux__)
+		target.file = ::open(target.path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0666);
+		if (target.file == -1) {
+			target.openFailed = true;
+			return false;
+		}
+
+		std::array<iovec, 64> vectors {};
+		const auto maxVectors = min(static_cast<std::size_t>(IOV_MAX), vectors.size());
+
+		std::size_t index = 0;
+		std::size_t offset = 0; // Offset into ranges[index] of the first byte which wasn't written yet
+		while (index < ranges.size()) {
+			std::size_t count = 0;
+			for (auto i = index; i < ranges.size() && count < maxVectors; ++i, ++count) {
+				const auto skip = i == index ? offset : 0;
+				vectors[count].iov_base = const_cast<std::byte*>(ranges[i].data() + skip);
+				vectors[count].iov_len = ranges[i].size() - skip;
+			}
+
+			const auto written = ::writev(target.file, vectors.data(), static_cast<int>(count));
+			if (written < 0) {
+				if (errno == EINTR)
+					continue;
+				return false;
+			}
+
+			auto remaining = static_cast<std::size_t>(written);
+			while (remaining != 0) {
+				const auto left = ranges[index].size() - offset;
+				if (remaining < left) {
+					offset += remaining;
+					break;
+				}
+				remaining -= left;
+				offset = 0;
+				++index;
+			}
+		}
+		return true;
+#else
+		target.file.open(target.path, std::ios::out | std::ios::binary);
+		if (!target.file.is_open()) {
+			target.openFailed = true;
+			return false;
+		}
+		for (const auto& range : ranges) {
+			target.file.write(reinterpret_cast<const char*>(range.data()), static_cast<std::streamsize>(range.size()));
+		}
+		return target.file.good();
+#endif
+	}
+} // namespace fastgltf
+
 fg::Error fg::FileExporter::writeGltfBinary(const Asset& asset, fs::path target, ExportOptions _options) {
 	if (std::error_code ec; !fs::exists(target.parent_path(), ec) || ec) {
 		fs::create_directory(target.parent_path(), ec);
@@ -5698,21 +8202,24 @@ fg::Error fg::FileExporter::writeGltfBinary(const Asset& asset, fs::path target,
 		}
 	}
 
-    auto expected = Exporter::writeGltfBinary(asset, _options);
+	// The GLB is streamed to the file directly from the asset's buffers, using scatter-gather writes where possible.
+	// The file is only opened by the write callback, so that a failed export leaves an existing file untouched.
+	BinaryFileTarget file { target };
+	auto expected = Exporter::writeGltfBinary(asset, writeRangesToFile, &file, _options);
+	if (file.openFailed) {
+		return Error::InvalidPath;
+	}
+#if defined(__APPLE__) || defined(__linux__)
+	if (file.file != -1 && ::close(file.file) != 0 && expected) {
+		return Error::FailedWritingFiles;
+	}
+#endif
 
     if (!expected) {
         return expected.error();
     }
     auto& result = expected.get();
 
-    std::ofstream file(target, std::ios::out | std::ios::binary);
-    if (!file.is_open()) {
-        return fg::Error::InvalidPath;
-    }
-
-    file.write(reinterpret_cast<const char*>(result.output.data()),
-               static_cast<std::streamsize>(result.output.size()));
-
 	if (!writeFiles(asset, result, target.parent_path())) {
 		return Error::FailedWritingFiles;
 	}
@@ -24,10 +24,18 @@
  * OTHER DEALINGS IN THE SOFTWARE.
  */
 
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <system_error>
+#include <thread>
+
 #include <simdjson.h>
 
 #include <fastgltf/core.hpp>
 
+#include "profiling.hpp"
+
 #if defined(__APPLE__) || defined(__linux__)
 #include <fcntl.h>
 #include <unistd.h>
@@ -116,6 +124,10 @@ std::size_t fg::GltfDataBuffer::totalSize() {
 	return dataSize;
 }
 
+fg::span<const std::byte> fg::GltfDataBuffer::persistentBytes() {
+	return span<const std::byte>(buffer.get(), dataSize);
+}
+
 fg::GltfFileStream::GltfFileStream(const fs::path& path) : fileStream(path, std::ios::binary) {
 	fileSize = fs::file_size(path);
 }
@@ -193,7 +205,7 @@ fg::MappedGltfFile::MappedGltfFile(const fs::path& path) noexcept {
 fg::MappedGltfFile::MappedGltfFile(const fs::path& path) noexcept : mappedFile(MAP_FAILED) {
 	// Open the file
 	int fd = open(path.c_str(), O_RDONLY, 0);
-	if (fd == 0) {
+	if (fd < 0) {
 		// TODO: Cover actual error messages using std::strerror(errno)?
 		error = Error::InvalidPath;
 		return;
@@ -309,8 +321,183 @@ std::size_t fg::MappedGltfFile::bytesRead() {
 std::size_t fg::MappedGltfFile::totalSize() {
 	return fileSize;
 }
+
+fg::span<const std::byte> fg::MappedGltfFile::persistentBytes() {
+	return span<const std::byte>(static_cast<const std::byte*>(mappedFile), static_cast<std::size_t>(fileSize));
+}
 #endif // FASTGLTF_HAS_MEMORY_MAPPED_FILE
 
+#pragma region AsyncGltfFile
+struct fg::AsyncGltfFile::LoadState {
+	std::unique_ptr<std::byte[]> buffer;
+	std::size_t fileSize = 0;
+	std::ifstream file;
+
+	std::mutex mutex;
+	std::condition_variable condition;
+	std::size_t bytesLoaded = 0;
+	bool failed = false;
+	/** The number of bytes which were read successfully before reading the file failed. */
+	std::size_t validBytes = 0;
+
+	std::atomic_bool cancelled = false;
+	std::thread loader;
+
+	void load() {
+		// Read the file in chunks and publish the progress after each one, so that readers can already continue.
+		constexpr std::size_t chunkSize = 1 << 20;
+		std::size_t loaded = 0;
+		while (loaded < fileSize && !cancelled.load(std::memory_order_relaxed)) {
+			const auto count = std::min(chunkSize, fileSize - loaded);
+			file.read(reinterpret_cast<char*>(buffer.get() + loaded), static_cast<std::streamsize>(count));
+			const bool success = static_cast<std::size_t>(file.gcount()) == count;
+			if (!success) {
+				std::memset(buffer.get() + loaded, 0, fileSize - loaded);
+			}
+
+			{
+				std::lock_guard lock(mutex);
+				failed = !success;
+				validBytes = loaded;
+				bytesLoaded = loaded = success ? loaded + count : fileSize;
+			}
+			condition.notify_all();
+
+			if (!success)
+				break;
+		}
+	}
+};
+
+fg::AsyncGltfFile::AsyncGltfFile() noexcept = default;
+
+fg::AsyncGltfFile::AsyncGltfFile(const fs::path& path) noexcept : state(new(std::nothrow) LoadState()) {
+	if (state == nullptr) {
+		error = Error::FileBufferAllocationFailed;
+		return;
+	}
+
+	std::error_code ec;
+	state->fileSize = static_cast<std::size_t>(fs::file_size(path, ec));
+	if (ec) {
+		error = Error::InvalidPath;
+		return;
+	}
+
+	state->file.open(path, std::ios::binary);
+	if (!state->file.is_open() || state->file.bad()) {
+		error = Error::InvalidPath;
+		return;
+	}
+
+	const auto allocatedSize = state->fileSize + simdjson::SIMDJSON_PADDING;
+	state->buffer = decltype(state->buffer)(new(std::nothrow) std::byte[allocatedSize]);
+	if (state->buffer == nullptr) {
+		error = Error::FileBufferAllocationFailed;
+		return;
+	}
+	std::memset(state->buffer.get() + state->fileSize, 0, allocatedSize - state->fileSize);
+
+#ifdef __cpp_exceptions
+	try {
+		state->loader = std::thread([loadState = state.get()]() { loadState->load(); });
+	} catch (const std::system_error&) {
+		// If no thread can be created, read the file on this thread instead.
+		state->load();
+	}
+#else
+	state->loader = std::thread([loadState = state.get()]() { loadState->load(); });
+#endif
+}
+
+fg::AsyncGltfFile::AsyncGltfFile(AsyncGltfFile&& other) noexcept
+	: state(std::move(other.state)), idx(other.idx), error(other.error), readFailed(other.readFailed) {}
+
+fg::AsyncGltfFile& fg::AsyncGltfFile::operator=(AsyncGltfFile&& other) noexcept {
+	if (state != nullptr && state->loader.joinable()) {
+		state->cancelled = true;
+		state->loader.join();
+	}
+	state = std::move(other.state);
+	idx = other.idx;
+	error = other.error;
+	readFailed = other.readFailed;
+	return *this;
+}
+
+fg::AsyncGltfFile::~AsyncGltfFile() noexcept {
+	if (state != nullptr && state->loader.joinable()) {
+		state->cancelled = true;
+		state->loader.join();
+	}
+}
+
+void fg::AsyncGltfFile::waitForBytes(std::size_t byteCount) {
+	if (state == nullptr)
+		return;
+	byteCount = std::min(byteCount, state->fileSize);
+	std::unique_lock lock(state->mutex);
+	state->condition.wait(lock, [this, byteCount]() {
+		return state->bytesLoaded >= byteCount;
+	});
+	if (state->failed && byteCount > state->validBytes)
+		readFailed = true;
+}
+
+fg::Error fg::AsyncGltfFile::wait() {
+	// A default-constructed or moved-from file has no data to wait for.
+	if (state == nullptr)
+		return Error::InvalidFileData;
+	waitForBytes(state->fileSize);
+	std::lock_guard lock(state->mutex);
+	return state->failed ? Error::InvalidFileData : Error::None;
+}
+
+void fg::AsyncGltfFile::read(void *ptr, std::size_t count) {
+	if (state == nullptr)
+		return;
+	waitForBytes(idx + count);
+	std::memcpy(ptr, state->buffer.get() + idx, count);
+	idx += count;
+}
+
+fg::span<std::byte> fg::AsyncGltfFile::read(std::size_t count, std::size_t padding) {
+	if (state == nullptr)
+		return {};
+	// The padding bytes may be read too, so we need to wait for them as well.
+	waitForBytes(idx + count + padding);
+	span<std::byte> sub(state->buffer.get() + idx, count);
+	idx += count;
+	return sub;
+}
+
+void fg::AsyncGltfFile::reset() {
+	idx = 0;
+}
+
+std::size_t fg::AsyncGltfFile::bytesRead() {
+	return idx;
+}
+
+std::size_t fg::AsyncGltfFile::totalSize() {
+	if (state == nullptr)
+		return 0;
+	return state->fileSize;
+}
+
+fg::Error fg::AsyncGltfFile::readError() {
+	if (state == nullptr || readFailed)
+		return Error::InvalidFileData;
+	return Error::None;
+}
+
+fg::span<const std::byte> fg::AsyncGltfFile::persistentBytes() {
+	if (wait() != Error::None)
+		return {};
+	return span<const std::byte>(state->buffer.get(), state->fileSize);
+}
+#pragma endregion
+
 #pragma region AndroidGltfDataBuffer
 #if defined(__ANDROID__)
 #include <android/asset_manager.h>
@@ -369,6 +556,7 @@ fg::AndroidGltfDataBuffer::AndroidGltfDataBuffer(const fs::path& path, std::uint
 #pragma region Parser I/O
 #if defined(__ANDROID__)
 fg::Expected<fg::DataSource> fg::Parser::loadFileFromApk(const fs::path& path) const noexcept {
+	FASTGLTF_PROFILE_STAGE(profilingScope, ParseStage::LoadExternalFile);
 	auto file = deletable_unique_ptr<AAsset, AAsset_close>(
 		AAssetManager_open(androidAssetManager, path.c_str(), AASSET_MODE_BUFFER));
 	if (file == nullptr) {
@@ -379,6 +567,7 @@ fg::Expected<fg::DataSource> fg::Parser::loadFileFromApk(const fs::path& path) c
 	if (length == 0) {
 		return Error::MissingExternalBuffer;
 	}
+	FASTGLTF_PROFILE_COUNTS(profilingScope, static_cast<std::size_t>(length), 1);
 
 	if (config.mapCallback != nullptr) {
 		auto info = config.mapCallback(static_cast<std::uint64_t>(length), config.userPointer);
@@ -402,12 +591,13 @@ fg::Expected<fg::DataSource> fg::Parser::loadFileFromApk(const fs::path& path) c
 }
 #endif
 
-fg::Expected<fg::DataSource> fg::Parser::loadFileFromUri(URIView& uri) const noexcept {
-	URI decodedUri(uri.path()); // Re-allocate so we can decode potential characters.
-	// JSON strings are always in UTF-8, so we can safely always use u8path here.
-	// Since u8path is deprecated with C++20 and newer, u8path is deprecated.
-	// As there is no other proper solution that doesn't do something illegal,
-	// we'll just disable related warnings here.
+namespace fastgltf {
+	static fs::path getFilePathFromUri(const fs::path& directory, URIView& uri) {
+		URI decodedUri(uri.path()); // Re-allocate so we can decode potential characters.
+		// JSON strings are always in UTF-8, so we can safely always use u8path here.
+		// Since u8path is deprecated with C++20 and newer, u8path is deprecated.
+		// As there is no other proper solution that doesn't do something illegal,
+		// we'll just disable related warnings here.
 #if defined(__GNUC__) || defined(__clang__)
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wdeprecated-declarations"
@@ -415,12 +605,18 @@ fg::Expected<fg::DataSource> fg::Parser::loadFileFromUri(URIView& uri) const noe
 #pragma warning(push)
 #pragma warning(disable : 4996)
 #endif
-	auto path = directory / fs::u8path(decodedUri.path());
+		return directory / fs::u8path(decodedUri.path());
 #if defined(__GNUC__) || defined(__clang__)
 #pragma GCC diagnostic pop
 #elif defined(_MSC_VER)
 #pragma warning(pop)
 #endif
+	}
+} // namespace fastgltf
+
+fg::Expected<fg::DataSource> fg::Parser::loadFileFromUri(URIView& uri) const noexcept {
+	FASTGLTF_PROFILE_STAGE(profilingScope, ParseStage::LoadExternalFile);
+	auto path = getFilePathFromUri(directory, uri);
 
 #if defined(__ANDROID__)
 	if (androidAssetManager != nullptr) {
@@ -441,6 +637,7 @@ fg::Expected<fg::DataSource> fg::Parser::loadFileFromUri(URIView& uri) const noe
 	if (error) {
 		return Error::InvalidURI;
 	}
+	FASTGLTF_PROFILE_COUNTS(profilingScope, static_cast<std::size_t>(length), 1);
 
 	std::ifstream file(path, std::ios::binary);
 
@@ -464,4 +661,84 @@ fg::Expected<fg::DataSource> fg::Parser::loadFileFromUri(URIView& uri) const noe
 	};
 	return { std::move(arraySource) };
 }
+
+fg::Expected<fg::DataSource> fg::Parser::mapFileFromUri(URIView& uri, Asset& asset) const noexcept {
+#if defined(FASTGLTF_HAS_MEMORY_MAPPED_FILE)
+	FASTGLTF_PROFILE_STAGE(profilingScope, ParseStage::LoadExternalFile);
+	auto path = getFilePathFromUri(directory, uri);
+
+	std::error_code error;
+	if (!fs::exists(path, error) || error) {
+		return Error::MissingExternalBuffer;
+	}
+
+	// Mapping empty files fails, so we just return an empty view for those.
+	if (fs::file_size(path, error) == 0 || error) {
+		if (error) {
+			return Error::InvalidURI;
+		}
+		return { sources::ByteView {} };
+	}
+
+	auto mappedFile = MappedGltfFile::FromPath(path);
+	if (mappedFile.error() != Error::None) {
+		return mappedFile.error();
+	}
+
+	auto& mapping = asset.mappedFiles.emplace_back(std::make_shared<MappedGltfFile>(std::move(mappedFile.get())));
+	FASTGLTF_PROFILE_COUNTS(profilingScope, mapping->totalSize(), 1);
+	sources::ByteView byteView {
+		mapping->persistentBytes(),
+	};
+	return { std::move(byteView) };
+#else
+	return loadFileFromUri(uri);
+#endif
+}
+
+namespace fastgltf {
+	static DataSource& getDeferredSource(const std::pair<Category, std::size_t>& load, Asset& asset) {
+		if (load.first == Category::Buffers)
+			return asset.buffers[load.second].data;
+		return asset.images[load.second].data;
+	}
+} // namespace fastgltf
+
+fg::Error fg::Parser::loadDeferredFiles(Asset& asset) const {
+	struct DeferredLoadData {
+		const Parser* parser;
+		Asset* asset;
+		std::vector<Expected<DataSource>> results;
+	} loadData { this, &asset, {} };
+	loadData.results.reserve(deferredFileLoads.size());
+	for (std::size_t i = 0; i < deferredFileLoads.size(); ++i) {
+		loadData.results.emplace_back(Error::None);
+	}
+
+	executeTasks(deferredFileLoads.size(), [](std::size_t taskIndex, void* taskData) {
+		auto* data = static_cast<DeferredLoadData*>(taskData);
+		const auto& load = data->parser->deferredFileLoads[taskIndex];
+		URIView uriView = std::get<sources::URI>(getDeferredSource(load, *data->asset)).uri;
+		data->results[taskIndex] = data->parser->loadFileFromUri(uriView);
+	}, &loadData);
+
+	// Assign the results in the order the files were referenced, so that the returned error is always the same.
+	for (std::size_t i = 0; i < deferredFileLoads.size(); ++i) {
+		auto& result = loadData.results[i];
+		if (result.error() != Error::None) {
+			return result.error();
+		}
+
+		auto& source = getDeferredSource(deferredFileLoads[i], asset);
+		const auto mimeType = std::get<sources::URI>(source).mimeType;
+		source = std::move(result.get());
+		std::visit([mimeType](auto& arg) {
+			using T = std::decay_t<decltype(arg)>;
+			if constexpr (is_any<T, sources::CustomBuffer, sources::Array>()) {
+				arg.mimeType = mimeType;
+			}
+		}, source);
+	}
+	return Error::None;
+}
 #pragma endregion
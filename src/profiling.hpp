@@ -0,0 +1,73 @@
+/*
+ * Copyright (C) 2022 - 2024 spnda
+ * This file is part of fastgltf <https://github.com/spnda/fastgltf>.
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#pragma once
+
+#include <chrono>
+
+#include <fastgltf/core.hpp>
+
+// Internal instrumentation of the parser, which reports the stages of loading a glTF to the ProfilingCallback.
+#if FASTGLTF_ENABLE_PROFILING
+namespace fastgltf {
+	/**
+	 * Measures a stage of loading a glTF, and reports it to the profiling callback once it goes out of scope.
+	 * The parser uses this through FASTGLTF_PROFILE_STAGE, which compiles to nothing without FASTGLTF_ENABLE_PROFILING.
+	 */
+	class ProfilingScope {
+		const ParserInternalConfig& config;
+		ProfilingEvent event;
+
+	public:
+		explicit ProfilingScope(const ParserInternalConfig& config, ParseStage stage, Category category = Category::None) noexcept
+				: config(config), event { stage, category, {}, {}, 0, 0 } {
+			if (config.profilingCallback != nullptr)
+				event.begin = std::chrono::steady_clock::now();
+		}
+
+		ProfilingScope(const ProfilingScope& other) = delete;
+		ProfilingScope& operator=(const ProfilingScope& other) = delete;
+
+		~ProfilingScope() {
+			if (config.profilingCallback != nullptr) {
+				event.end = std::chrono::steady_clock::now();
+				config.profilingCallback(event, config.userPointer);
+			}
+		}
+
+		void setCounts(std::size_t byteCount, std::size_t elementCount) noexcept {
+			event.byteCount = byteCount;
+			event.elementCount = elementCount;
+		}
+	};
+} // namespace fastgltf
+
+#define FASTGLTF_PROFILE_STAGE(scope, ...) ::fastgltf::ProfilingScope scope(config, __VA_ARGS__)
+#define FASTGLTF_PROFILE_COUNTS(scope, byteCount, elementCount) scope.setCounts(byteCount, elementCount)
+#else
+#define FASTGLTF_PROFILE_STAGE(scope, ...)
+#define FASTGLTF_PROFILE_COUNTS(scope, byteCount, elementCount)
+#endif
@@ -0,0 +1,757 @@
+/*
+ * Copyright (C) 2022 - 2024 spnda
+ * This file is part of fastgltf <https://github.com/spnda/fastgltf>.
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#if !defined(__cplusplus) || (!defined(_MSVC_LANG) && __cplusplus < 201703L) || (defined(_MSVC_LANG) && _MSVC_LANG < 201703L)
+#error "fastgltf requires C++17"
+#endif
+
+#include <algorithm>
+#include <cstring>
+
+#include "simdjson.h"
+
+#include <fastgltf/tools.hpp>
+
+#if defined(FASTGLTF_IS_X86)
+#if defined(__clang__) || defined(__GNUC__)
+// See base64.cpp on why we include the headers with the specific intrinsics manually.
+#include <immintrin.h>
+#include <smmintrin.h>
+#include <avxintrin.h>
+#include <avx2intrin.h>
+#else
+#include <intrin.h>
+#endif
+#elif defined(FASTGLTF_IS_A64)
+#include <arm_neon.h> // Includes arm64_neon.h on MSVC
+#endif
+
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable : 5030) // attribute 'x' is not recognized
+#pragma warning(disable : 4710) // function not inlined
+#endif
+
+namespace fg = fastgltf;
+
+namespace fastgltf {
+	enum class ConversionKernelSet {
+		Fallback,
+		SSE4,
+		AVX2,
+		Neon,
+	};
+
+	/**
+	 * Uses simdjson's runtime detection, just like the base64 decoder, to determine which of the
+	 * vectorized conversion kernels can be used on this machine.
+	 */
+	static ConversionKernelSet detectConversionKernelSet() {
+		const auto& impls = simdjson::get_available_implementations();
+#if defined(FASTGLTF_IS_X86)
+		if (const auto* avx2 = impls["haswell"]; avx2 != nullptr && avx2->supported_by_runtime_system()) {
+			return ConversionKernelSet::AVX2;
+		}
+		if (const auto* sse4 = impls["westmere"]; sse4 != nullptr && sse4->supported_by_runtime_system()) {
+			return ConversionKernelSet::SSE4;
+		}
+#elif defined(FASTGLTF_IS_A64)
+		if (const auto* neon = impls["arm64"]; neon && neon->supported_by_runtime_system()) {
+			return ConversionKernelSet::Neon;
+		}
+#endif
+		return ConversionKernelSet::Fallback;
+	}
+
+	static ConversionKernelSet getConversionKernelSet() {
+		static const auto kernelSet = detectConversionKernelSet();
+		return kernelSet;
+	}
+
+	template <typename SourceType, typename DestType, bool Normalized>
+	void fallback_convert(const std::byte* source, void* destination, std::size_t componentCount) {
+		auto* dst = static_cast<DestType*>(destination);
+		for (std::size_t i = 0; i < componentCount; ++i) {
+			dst[i] = internal::convertComponent<DestType>(internal::deserializeComponent<SourceType>(source, i), Normalized);
+		}
+	}
+} // namespace fastgltf
+
+#if defined(FASTGLTF_IS_X86)
+namespace fastgltf {
+	// Loads four components and sign- or zero-extends them to 32-bit integers.
+	template <typename SourceType>
+	[[gnu::target("sse4.1")]] FASTGLTF_FORCEINLINE __m128i sse4_load_widened(const std::byte* source) {
+		if constexpr (sizeof(SourceType) == 1) {
+			std::int32_t bits;
+			std::memcpy(&bits, source, sizeof bits);
+			const auto packed = _mm_cvtsi32_si128(bits);
+			if constexpr (std::is_signed_v<SourceType>) {
+				return _mm_cvtepi8_epi32(packed);
+			} else {
+				return _mm_cvtepu8_epi32(packed);
+			}
+		} else {
+			const auto packed = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(source));
+			if constexpr (std::is_signed_v<SourceType>) {
+				return _mm_cvtepi16_epi32(packed);
+			} else {
+				return _mm_cvtepu16_epi32(packed);
+			}
+		}
+	}
+
+	template <typename SourceType, typename DestType, bool Normalized>
+	[[gnu::target("sse4.1")]] void sse4_convert(const std::byte* source, void* destination, std::size_t componentCount) {
+		constexpr std::size_t lanes = 4;
+		auto* dst = static_cast<DestType*>(destination);
+
+		std::size_t i = 0;
+		for (; i + lanes <= componentCount; i += lanes) {
+			const auto widened = sse4_load_widened<SourceType>(source + i * sizeof(SourceType));
+			if constexpr (std::is_same_v<DestType, float>) {
+				auto value = _mm_cvtepi32_ps(widened);
+				if constexpr (Normalized) {
+					// We divide instead of multiplying with the reciprocal so that the results
+					// are bit-identical to internal::convertComponent.
+					value = _mm_div_ps(value, _mm_set1_ps(static_cast<float>(std::numeric_limits<SourceType>::max())));
+					if constexpr (std::is_signed_v<SourceType>) {
+						value = _mm_max_ps(value, _mm_set1_ps(-1.0f));
+					}
+				}
+				_mm_storeu_ps(dst + i, value);
+			} else {
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), widened);
+			}
+		}
+
+		fallback_convert<SourceType, DestType, Normalized>(source + i * sizeof(SourceType), dst + i, componentCount - i);
+	}
+
+	// Loads eight components and sign- or zero-extends them to 32-bit integers.
+	template <typename SourceType>
+	[[gnu::target("avx2")]] FASTGLTF_FORCEINLINE __m256i avx2_load_widened(const std::byte* source) {
+		if constexpr (sizeof(SourceType) == 1) {
+			const auto packed = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(source));
+			if constexpr (std::is_signed_v<SourceType>) {
+				return _mm256_cvtepi8_epi32(packed);
+			} else {
+				return _mm256_cvtepu8_epi32(packed);
+			}
+		} else {
+			const auto packed = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source));
+			if constexpr (std::is_signed_v<SourceType>) {
+				return _mm256_cvtepi16_epi32(packed);
+			} else {
+				return _mm256_cvtepu16_epi32(packed);
+			}
+		}
+	}
+
+	template <typename SourceType, typename DestType, bool Normalized>
+	[[gnu::target("avx2")]] void avx2_convert(const std::byte* source, void* destination, std::size_t componentCount) {
+		constexpr std::size_t lanes = 8;
+		auto* dst = static_cast<DestType*>(destination);
+
+		std::size_t i = 0;
+		for (; i + lanes <= componentCount; i += lanes) {
+			const auto widened = avx2_load_widened<SourceType>(source + i * sizeof(SourceType));
+			if constexpr (std::is_same_v<DestType, float>) {
+				auto value = _mm256_cvtepi32_ps(widened);
+				if constexpr (Normalized) {
+					value = _mm256_div_ps(value, _mm256_set1_ps(static_cast<float>(std::numeric_limits<SourceType>::max())));
+					if constexpr (std::is_signed_v<SourceType>) {
+						value = _mm256_max_ps(value, _mm256_set1_ps(-1.0f));
+					}
+				}
+				_mm256_storeu_ps(dst + i, value);
+			} else {
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), widened);
+			}
+		}
+
+		// The SSE4 kernel handles the remaining components, since AVX2 implies SSE4.1.
+		sse4_convert<SourceType, DestType, Normalized>(source + i * sizeof(SourceType), dst + i, componentCount - i);
+	}
+} // namespace fastgltf
+#elif defined(FASTGLTF_IS_A64)
+namespace fastgltf {
+	// Loads eight components and converts them to two vectors of four floats each.
+	template <typename SourceType>
+	FASTGLTF_FORCEINLINE float32x4x2_t neon_load_float(const std::byte* source) {
+		float32x4x2_t result;
+		if constexpr (std::is_same_v<SourceType, std::uint8_t>) {
+			const auto wide = vmovl_u8(vld1_u8(reinterpret_cast<const std::uint8_t*>(source)));
+			result.val[0] = vcvtq_f32_u32(vmovl_u16(vget_low_u16(wide)));
+			result.val[1] = vcvtq_f32_u32(vmovl_u16(vget_high_u16(wide)));
+		} else if constexpr (std::is_same_v<SourceType, std::int8_t>) {
+			const auto wide = vmovl_s8(vld1_s8(reinterpret_cast<const std::int8_t*>(source)));
+			result.val[0] = vcvtq_f32_s32(vmovl_s16(vget_low_s16(wide)));
+			result.val[1] = vcvtq_f32_s32(vmovl_s16(vget_high_s16(wide)));
+		} else if constexpr (std::is_same_v<SourceType, std::uint16_t>) {
+			// We load bytes and reinterpret them, as the source data is not necessarily aligned to 2 bytes.
+			const auto wide = vreinterpretq_u16_u8(vld1q_u8(reinterpret_cast<const std::uint8_t*>(source)));
+			result.val[0] = vcvtq_f32_u32(vmovl_u16(vget_low_u16(wide)));
+			result.val[1] = vcvtq_f32_u32(vmovl_u16(vget_high_u16(wide)));
+		} else {
+			const auto wide = vreinterpretq_s16_u8(vld1q_u8(reinterpret_cast<const std::uint8_t*>(source)));
+			result.val[0] = vcvtq_f32_s32(vmovl_s16(vget_low_s16(wide)));
+			result.val[1] = vcvtq_f32_s32(vmovl_s16(vget_high_s16(wide)));
+		}
+		return result;
+	}
+
+	// Loads eight unsigned components and zero-extends them to 32-bit integers.
+	template <typename SourceType>
+	FASTGLTF_FORCEINLINE uint32x4x2_t neon_load_widened(const std::byte* source) {
+		uint16x8_t wide;
+		if constexpr (std::is_same_v<SourceType, std::uint8_t>) {
+			wide = vmovl_u8(vld1_u8(reinterpret_cast<const std::uint8_t*>(source)));
+		} else {
+			wide = vreinterpretq_u16_u8(vld1q_u8(reinterpret_cast<const std::uint8_t*>(source)));
+		}
+		uint32x4x2_t result;
+		result.val[0] = vmovl_u16(vget_low_u16(wide));
+		result.val[1] = vmovl_u16(vget_high_u16(wide));
+		return result;
+	}
+
+	template <typename SourceType, typename DestType, bool Normalized>
+	void neon_convert(const std::byte* source, void* destination, std::size_t componentCount) {
+		constexpr std::size_t lanes = 8;
+		auto* dst = static_cast<DestType*>(destination);
+
+		std::size_t i = 0;
+		for (; i + lanes <= componentCount; i += lanes) {
+			if constexpr (std::is_same_v<DestType, float>) {
+				auto values = neon_load_float<SourceType>(source + i * sizeof(SourceType));
+				for (auto& value : values.val) {
+					if constexpr (Normalized) {
+						value = vdivq_f32(value, vdupq_n_f32(static_cast<float>(std::numeric_limits<SourceType>::max())));
+						if constexpr (std::is_signed_v<SourceType>) {
+							value = vmaxq_f32(value, vdupq_n_f32(-1.0f));
+						}
+					}
+				}
+				vst1q_f32(dst + i, values.val[0]);
+				vst1q_f32(dst + i + 4, values.val[1]);
+			} else {
+				const auto values = neon_load_widened<SourceType>(source + i * sizeof(SourceType));
+				vst1q_u32(dst + i, values.val[0]);
+				vst1q_u32(dst + i + 4, values.val[1]);
+			}
+		}
+
+		fallback_convert<SourceType, DestType, Normalized>(source + i * sizeof(SourceType), dst + i, componentCount - i);
+	}
+} // namespace fastgltf
+#endif
+
+namespace fastgltf {
+	template <typename SourceType, typename DestType, bool Normalized>
+	static internal::ComponentConversionFunction* selectConversionKernel() {
+		switch (getConversionKernelSet()) {
+#if defined(FASTGLTF_IS_X86)
+			case ConversionKernelSet::AVX2:
+				return avx2_convert<SourceType, DestType, Normalized>;
+			case ConversionKernelSet::SSE4:
+				return sse4_convert<SourceType, DestType, Normalized>;
+#elif defined(FASTGLTF_IS_A64)
+			case ConversionKernelSet::Neon:
+				return neon_convert<SourceType, DestType, Normalized>;
+#endif
+			default:
+				return fallback_convert<SourceType, DestType, Normalized>;
+		}
+	}
+
+	template <typename SourceType>
+	static internal::ComponentConversionFunction* selectFloatConversionKernel(bool normalized) {
+		if (normalized) {
+			return selectConversionKernel<SourceType, float, true>();
+		}
+		return selectConversionKernel<SourceType, float, false>();
+	}
+} // namespace fastgltf
+
+fg::internal::ComponentConversionFunction* fg::internal::getComponentConversionFunction(ComponentType sourceType,
+		ComponentType destinationType, bool normalized) {
+	if (destinationType == ComponentType::Float) {
+		switch (sourceType) {
+			case ComponentType::Byte:
+				return selectFloatConversionKernel<std::int8_t>(normalized);
+			case ComponentType::UnsignedByte:
+				return selectFloatConversionKernel<std::uint8_t>(normalized);
+			case ComponentType::Short:
+				return selectFloatConversionKernel<std::int16_t>(normalized);
+			case ComponentType::UnsignedShort:
+				return selectFloatConversionKernel<std::uint16_t>(normalized);
+			default:
+				return nullptr;
+		}
+	}
+
+	if (destinationType == ComponentType::UnsignedInt) {
+		// Normalization has no effect on integer to integer conversions.
+		switch (sourceType) {
+			case ComponentType::UnsignedByte:
+				return selectConversionKernel<std::uint8_t, std::uint32_t, false>();
+			case ComponentType::UnsignedShort:
+				return selectConversionKernel<std::uint16_t, std::uint32_t, false>();
+			default:
+				return nullptr;
+		}
+	}
+
+	return nullptr;
+}
+
+fg::FlattenedScene::FlattenedScene(const Asset& asset, std::size_t sceneIndex, const math::fmat4x4& base) : baseMatrix(base) {
+	assert(asset.scenes.size() > sceneIndex);
+	const auto& scene = asset.scenes[sceneIndex];
+	flattenedIndices.assign(asset.nodes.size(), noParent);
+
+	// The node indices double as the queue for the breadth first traversal.
+	auto addNode = [&](std::size_t nodeIndex, std::size_t parent) {
+		assert(asset.nodes.size() > nodeIndex);
+		if (flattenedIndices[nodeIndex] != noParent)
+			return;
+		flattenedIndices[nodeIndex] = nodeIndices.size();
+		nodeIndices.emplace_back(nodeIndex);
+		parents.emplace_back(parent);
+	};
+	for (auto nodeIndex : scene.nodeIndices) {
+		addNode(nodeIndex, noParent);
+	}
+	for (std::size_t i = 0; i < nodeIndices.size(); ++i) {
+		for (auto child : asset.nodes[nodeIndices[i]].children) {
+			addNode(child, i);
+		}
+	}
+
+	const auto count = nodeIndices.size();
+	translations.resize(count);
+	rotations.resize(count);
+	scales.resize(count);
+	flags.resize(count);
+	localMatrices.resize(count);
+	worldMatrices.resize(count);
+	for (std::size_t i = 0; i < count; ++i) {
+		visit_exhaustive(visitor {
+			[&](const math::fmat4x4& matrix) {
+				math::decomposeTransformMatrix(matrix, scales[i], rotations[i], translations[i]);
+				localMatrices[i] = matrix;
+				flags[i] = LocalMatrix | WorldDirty;
+			},
+			[&](const TRS& trs) {
+				translations[i] = trs.translation;
+				rotations[i] = trs.rotation;
+				scales[i] = trs.scale;
+				flags[i] = LocalDirty | WorldDirty;
+			}
+		}, asset.nodes[nodeIndices[i]].transform);
+	}
+
+	firstDirty = 0;
+	updateWorldMatrices();
+}
+
+void fg::FlattenedScene::markDirty(std::size_t index, std::uint8_t dirtyFlags) noexcept {
+	assert(index < flags.size());
+	flags[index] |= dirtyFlags;
+	firstDirty = min(firstDirty, index);
+}
+
+void fg::FlattenedScene::setTranslation(std::size_t index, const math::fvec3& translation) noexcept {
+	translations[index] = translation;
+	flags[index] &= static_cast<std::uint8_t>(~LocalMatrix);
+	markDirty(index, LocalDirty | WorldDirty);
+}
+
+void fg::FlattenedScene::setRotation(std::size_t index, const math::fquat& rotation) noexcept {
+	rotations[index] = rotation;
+	flags[index] &= static_cast<std::uint8_t>(~LocalMatrix);
+	markDirty(index, LocalDirty | WorldDirty);
+}
+
+void fg::FlattenedScene::setScale(std::size_t index, const math::fvec3& scale) noexcept {
+	scales[index] = scale;
+	flags[index] &= static_cast<std::uint8_t>(~LocalMatrix);
+	markDirty(index, LocalDirty | WorldDirty);
+}
+
+void fg::FlattenedScene::setLocalMatrix(std::size_t index, const math::fmat4x4& matrix) noexcept {
+	math::decomposeTransformMatrix(matrix, scales[index], rotations[index], translations[index]);
+	localMatrices[index] = matrix;
+	flags[index] = static_cast<std::uint8_t>((flags[index] & ~LocalDirty) | LocalMatrix);
+	markDirty(index, WorldDirty);
+}
+
+void fg::FlattenedScene::setBaseMatrix(const math::fmat4x4& base) noexcept {
+	baseMatrix = base;
+	for (std::size_t i = 0; i < parents.size() && parents[i] == noParent; ++i) {
+		markDirty(i, WorldDirty);
+	}
+}
+
+void fg::FlattenedScene::updateWorldMatrices() noexcept {
+	const auto count = nodeIndices.size();
+	for (auto i = firstDirty; i < count; ++i) {
+		const auto parent = parents[i];
+		if (parent != noParent && (flags[parent] & WorldDirty) != 0)
+			flags[i] |= WorldDirty;
+		if ((flags[i] & WorldDirty) == 0)
+			continue;
+
+		if ((flags[i] & LocalDirty) != 0) {
+			localMatrices[i] = math::composeTransformMatrix(translations[i], rotations[i], scales[i]);
+		}
+
+		worldMatrices[i] = (parent == noParent ? baseMatrix : worldMatrices[parent]) * localMatrices[i];
+	}
+
+	for (auto i = firstDirty; i < count; ++i) {
+		flags[i] &= static_cast<std::uint8_t>(~(LocalDirty | WorldDirty));
+	}
+	firstDirty = count;
+}
+
+fg::AnimationEvaluator::AnimationEvaluator(const DecodedAnimation& decoded, const FlattenedScene& scene) : animation(&decoded) {
+	const auto channels = decoded.getChannels();
+	targets.resize(channels.size());
+	cursors.resize(channels.size());
+	for (std::size_t i = 0; i < channels.size(); ++i) {
+		targets[i] = scene.getFlattenedIndex(channels[i].nodeIndex);
+	}
+}
+
+void fg::AnimationEvaluator::resetCursors() noexcept {
+	std::fill(cursors.begin(), cursors.end(), 0);
+}
+
+namespace fastgltf {
+	/**
+	 * Returns the keyframe k for which times[k] <= time < times[k + 1], starting from the given cursor.
+	 * Sequential playback at most moves a step or two, anything further is resolved with a binary search.
+	 */
+	std::size_t findKeyframe(const float* times, std::size_t count, float time, std::size_t cursor) noexcept {
+		constexpr std::size_t maxLinearSteps = 2;
+		cursor = min(cursor, count - 2);
+		if (time < times[cursor]) {
+			for (std::size_t i = 0; i < maxLinearSteps && cursor > 0; ++i) {
+				if (times[--cursor] <= time)
+					return cursor;
+			}
+		} else {
+			for (std::size_t i = 0; i < maxLinearSteps; ++i) {
+				if (cursor + 1 == count - 1 || time < times[cursor + 1])
+					return cursor;
+				++cursor;
+			}
+			if (time < times[cursor + 1])
+				return cursor;
+		}
+
+		const auto* upper = std::upper_bound(times, times + count - 1, time);
+		return upper == times ? 0 : static_cast<std::size_t>(upper - times) - 1;
+	}
+
+	template <std::size_t N>
+	math::vec<float, N> loadKeyframeValue(const float* values) noexcept {
+		math::vec<float, N> ret;
+		std::memcpy(ret.data(), values, sizeof(ret));
+		return ret;
+	}
+
+	template <std::size_t N>
+	math::vec<float, N> sampleKeyframes(const DecodedAnimation::Sampler& sampler, const float* times, const float* values,
+			float time, std::size_t& cursor) noexcept {
+		const bool cubic = sampler.interpolation == AnimationInterpolation::CubicSpline;
+		const std::size_t keyframeStride = cubic ? N * 3 : N;
+		const std::size_t valueOffset = cubic ? N : 0;
+		const auto last = sampler.keyframeCount - 1;
+
+		if (sampler.keyframeCount == 1 || time <= times[0]) {
+			cursor = 0;
+			return loadKeyframeValue<N>(values + valueOffset);
+		}
+		if (time >= times[last]) {
+			cursor = last - 1;
+			return loadKeyframeValue<N>(values + keyframeStride * last + valueOffset);
+		}
+
+		cursor = findKeyframe(times, sampler.keyframeCount, time, cursor);
+		const auto* current = values + keyframeStride * cursor;
+		const auto* next = current + keyframeStride;
+		const auto delta = times[cursor + 1] - times[cursor];
+		const auto t = (time - times[cursor]) / delta;
+
+		switch (sampler.interpolation) {
+			case AnimationInterpolation::Step:
+				return loadKeyframeValue<N>(current);
+			case AnimationInterpolation::Linear: {
+				auto a = loadKeyframeValue<N>(current);
+				auto b = loadKeyframeValue<N>(next);
+				if constexpr (N == 4) {
+					auto q = math::slerp(math::fquat(a.x(), a.y(), a.z(), a.w()), math::fquat(b.x(), b.y(), b.z(), b.w()), t);
+					return math::fvec4(q.x(), q.y(), q.z(), q.w());
+				} else {
+					return math::lerp(a, b, t);
+				}
+			}
+			case AnimationInterpolation::CubicSpline: {
+				// The Hermite spline from appendix C of the glTF specification, using the out-tangent of the current
+				// keyframe and the in-tangent of the next one.
+				const auto t2 = t * t;
+				const auto t3 = t2 * t;
+				auto value = loadKeyframeValue<N>(current + N) * (2 * t3 - 3 * t2 + 1)
+					+ loadKeyframeValue<N>(current + N * 2) * (delta * (t3 - 2 * t2 + t))
+					+ loadKeyframeValue<N>(next + N) * (-2 * t3 + 3 * t2)
+					+ loadKeyframeValue<N>(next) * (delta * (t3 - t2));
+				if constexpr (N == 4) {
+					return math::normalize(value);
+				} else {
+					return value;
+				}
+			}
+		}
+		return loadKeyframeValue<N>(current);
+	}
+} // namespace fastgltf
+
+void fg::AnimationEvaluator::evaluate(float time, FlattenedScene& scene) noexcept {
+	if (animation == nullptr)
+		return;
+
+	const auto channels = animation->getChannels();
+	const auto samplers = animation->getSamplers();
+	const auto* times = animation->getTimes().data();
+	const auto* values = animation->getValues().data();
+	for (std::size_t i = 0; i < channels.size(); ++i) {
+		const auto& channel = channels[i];
+		const auto& sampler = samplers[channel.samplerIndex];
+		if (targets[i] == FlattenedScene::noParent || sampler.keyframeCount == 0)
+			continue;
+
+		const auto* samplerTimes = times + sampler.timesOffset;
+		const auto* samplerValues = values + sampler.valuesOffset;
+		switch (channel.path) {
+			case AnimationPath::Translation:
+				scene.setTranslation(targets[i], sampleKeyframes<3>(sampler, samplerTimes, samplerValues, time, cursors[i]));
+				break;
+			case AnimationPath::Rotation: {
+				auto rotation = sampleKeyframes<4>(sampler, samplerTimes, samplerValues, time, cursors[i]);
+				scene.setRotation(targets[i], math::fquat(rotation.x(), rotation.y(), rotation.z(), rotation.w()));
+				break;
+			}
+			case AnimationPath::Scale:
+				scene.setScale(targets[i], sampleKeyframes<3>(sampler, samplerTimes, samplerValues, time, cursors[i]));
+				break;
+			case AnimationPath::Weights:
+				break;
+		}
+	}
+}
+
+void fg::ReadRequestList::addRange(std::size_t bufferIndex, std::size_t byteOffset, std::size_t byteLength) {
+	if (bufferIndex >= asset->buffers.size() || byteLength == 0)
+		return;
+	const auto* uri = std::get_if<sources::URI>(&asset->buffers[bufferIndex].data);
+	if (uri == nullptr)
+		return;
+
+	requests.emplace_back(ReadRequest {
+		bufferIndex,
+		uri->fileByteOffset + byteOffset,
+		byteLength,
+		destinationSize,
+	});
+	destinationSize += byteLength;
+	coalesced = false;
+}
+
+void fg::ReadRequestList::addBufferViewRange(std::size_t bufferViewIndex, std::size_t byteOffset, std::size_t byteLength) {
+	if (bufferViewIndex >= asset->bufferViews.size())
+		return;
+	const auto& bufferView = asset->bufferViews[bufferViewIndex];
+
+	// The compressed data is always needed as a whole to decode any part of it.
+	if (bufferView.meshoptCompression) {
+		const auto& compression = *bufferView.meshoptCompression;
+		addRange(compression.bufferIndex, compression.byteOffset, compression.byteLength);
+		return;
+	}
+
+	if (granularity == ReadGranularity::BufferView || byteOffset >= bufferView.byteLength) {
+		byteOffset = 0;
+		byteLength = bufferView.byteLength;
+	}
+	addRange(bufferView.bufferIndex, bufferView.byteOffset + byteOffset,
+			 std::min(byteLength, bufferView.byteLength - byteOffset));
+}
+
+void fg::ReadRequestList::addBufferView(std::size_t bufferViewIndex) {
+	if (bufferViewIndex >= asset->bufferViews.size())
+		return;
+	addBufferViewRange(bufferViewIndex, 0, asset->bufferViews[bufferViewIndex].byteLength);
+}
+
+void fg::ReadRequestList::addAccessor(std::size_t accessorIndex) {
+	if (accessorIndex >= asset->accessors.size())
+		return;
+	const auto& accessor = asset->accessors[accessorIndex];
+	const auto elementSize = getElementByteSize(accessor.type, accessor.componentType);
+
+	if (accessor.bufferViewIndex.has_value() && accessor.count != 0 && *accessor.bufferViewIndex < asset->bufferViews.size()) {
+		const auto& bufferView = asset->bufferViews[*accessor.bufferViewIndex];
+		const auto stride = bufferView.byteStride.value_or(elementSize);
+		addBufferViewRange(*accessor.bufferViewIndex, accessor.byteOffset, stride * (accessor.count - 1) + elementSize);
+	}
+
+	if (accessor.sparse.has_value() && accessor.sparse->count != 0) {
+		const auto& sparse = *accessor.sparse;
+		addBufferViewRange(sparse.indicesBufferView, sparse.indicesByteOffset,
+						   sparse.count * getComponentByteSize(sparse.indexComponentType));
+		addBufferViewRange(sparse.valuesBufferView, sparse.valuesByteOffset, sparse.count * elementSize);
+	}
+}
+
+void fg::ReadRequestList::addPrimitive(const Primitive& primitive) {
+	// The indices and attributes are decoded from the Draco buffer view instead.
+	if (primitive.dracoCompression) {
+		addBufferView(primitive.dracoCompression->bufferView);
+	} else {
+		if (primitive.indicesAccessor.has_value())
+			addAccessor(*primitive.indicesAccessor);
+		for (const auto& attribute : primitive.attributes)
+			addAccessor(attribute.accessorIndex);
+	}
+
+	for (const auto& target : primitive.targets) {
+		for (const auto& attribute : target)
+			addAccessor(attribute.accessorIndex);
+	}
+}
+
+void fg::ReadRequestList::addMesh(std::size_t meshIndex) {
+	if (meshIndex >= asset->meshes.size())
+		return;
+	for (const auto& primitive : asset->meshes[meshIndex].primitives)
+		addPrimitive(primitive);
+}
+
+void fg::ReadRequestList::addAllMeshes() {
+	for (std::size_t i = 0; i < asset->meshes.size(); ++i)
+		addMesh(i);
+}
+
+void fg::ReadRequestList::coalesce(std::size_t alignment, std::size_t mergeDistance) {
+	if (alignment == 0)
+		alignment = 1;
+	const auto roundUp = [alignment](std::size_t value) {
+		return (value + alignment - 1) / alignment * alignment;
+	};
+
+	std::sort(requests.begin(), requests.end(), [](const ReadRequest& a, const ReadRequest& b) {
+		if (a.bufferIndex != b.bufferIndex)
+			return a.bufferIndex < b.bufferIndex;
+		return a.fileOffset < b.fileOffset;
+	});
+
+	std::size_t count = 0;
+	destinationSize = 0;
+	for (std::size_t i = 0; i < requests.size(); ++i) {
+		const auto& range = requests[i];
+		const auto start = alignDown(range.fileOffset, alignment);
+		const auto end = roundUp(range.fileOffset + range.size);
+
+		if (count != 0) {
+			auto& previous = requests[count - 1];
+			const auto previousEnd = previous.fileOffset + previous.size;
+			if (previous.bufferIndex == range.bufferIndex && start <= previousEnd + mergeDistance) {
+				if (end > previousEnd) {
+					const auto size = end - previous.fileOffset;
+					destinationSize += size - previous.size;
+					previous.size = size;
+				}
+				continue;
+			}
+		}
+
+		requests[count++] = ReadRequest { range.bufferIndex, start, end - start, destinationSize };
+		destinationSize += end - start;
+	}
+	requests.resize(count);
+	coalesced = true;
+}
+
+fg::Optional<std::size_t> fg::ReadRequestList::getDestinationOffset(std::size_t bufferIndex, std::size_t byteOffset) const noexcept {
+	if (bufferIndex >= asset->buffers.size())
+		return std::nullopt;
+	const auto* uri = std::get_if<sources::URI>(&asset->buffers[bufferIndex].data);
+	if (uri == nullptr)
+		return std::nullopt;
+	const auto fileOffset = uri->fileByteOffset + byteOffset;
+
+	const auto contains = [&](const ReadRequest& request) {
+		return request.bufferIndex == bufferIndex && fileOffset >= request.fileOffset
+			&& fileOffset < request.fileOffset + request.size;
+	};
+
+	const ReadRequest* request = nullptr;
+	if (coalesced) {
+		// The requests are sorted and disjoint, so only the last one starting before the offset can contain it.
+		auto it = std::upper_bound(requests.begin(), requests.end(), std::pair(bufferIndex, fileOffset),
+				[](const std::pair<std::size_t, std::size_t>& value, const ReadRequest& request) {
+			if (value.first != request.bufferIndex)
+				return value.first < request.bufferIndex;
+			return value.second < request.fileOffset;
+		});
+		if (it != requests.begin() && contains(*std::prev(it)))
+			request = &*std::prev(it);
+	} else {
+		auto it = std::find_if(requests.begin(), requests.end(), contains);
+		if (it != requests.end())
+			request = &*it;
+	}
+
+	if (request == nullptr)
+		return std::nullopt;
+	return request->destinationOffset + (fileOffset - request->fileOffset);
+}
+
+fg::Optional<std::size_t> fg::ReadRequestList::getDestinationOffset(const Accessor& accessor) const noexcept {
+	if (!accessor.bufferViewIndex.has_value() || *accessor.bufferViewIndex >= asset->bufferViews.size())
+		return std::nullopt;
+	const auto& bufferView = asset->bufferViews[*accessor.bufferViewIndex];
+	if (bufferView.meshoptCompression)
+		return std::nullopt;
+	return getDestinationOffset(bufferView.bufferIndex, bufferView.byteOffset + accessor.byteOffset);
+}
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
@@ -1,3 +1,6 @@
+#include <atomic>
+#include <cmath>
+
 #include <catch2/catch_approx.hpp>
 #include <catch2/catch_test_macros.hpp>
 
@@ -319,6 +322,28 @@ TEST_CASE("Test sparse accessor", "[gltf-tools]") {
 		REQUIRE(std::memcmp(dstCopy.get(), checkValues.get(), secondAccessor.count * sizeof(fastgltf::math::fvec3)) == 0);
 	}
 
+	SECTION("copyComponentsFromAccessor") {
+		auto dstCopy = std::make_unique<float[]>(secondAccessor.count * 3);
+		fastgltf::copyComponentsFromAccessor<float>(asset.get(), secondAccessor, dstCopy.get());
+		REQUIRE(std::memcmp(dstCopy.get(), checkValues.get(), secondAccessor.count * sizeof(fastgltf::math::fvec3)) == 0);
+	}
+
+	SECTION("Sparse accessor without buffer view") {
+		// Without a buffer view the dense data is all zeros, with only the sparse values overriding it.
+		auto accessor = secondAccessor;
+		accessor.bufferViewIndex.reset();
+
+		auto dstCopy = std::make_unique<fastgltf::math::fvec3[]>(accessor.count);
+		fastgltf::copyFromAccessor<fastgltf::math::fvec3>(asset.get(), accessor, dstCopy.get());
+		for (std::size_t i = 0, sparseIndex = 0; i < accessor.count; ++i) {
+			if (sparseIndex < accessor.sparse->count && dataIndices[sparseIndex] == i) {
+				REQUIRE(dstCopy[i] == dataValues[sparseIndex++]);
+			} else {
+				REQUIRE(dstCopy[i] == fastgltf::math::fvec3());
+			}
+		}
+	}
+
 	SECTION("Iterator test") {
 		auto dstCopy = std::make_unique<fastgltf::math::fvec3[]>(secondAccessor.count);
 		auto accessor = fastgltf::iterateAccessor<fastgltf::math::fvec3>(asset.get(), secondAccessor);
@@ -328,3 +353,549 @@ TEST_CASE("Test sparse accessor", "[gltf-tools]") {
 		REQUIRE(std::memcmp(dstCopy.get(), checkValues.get(), secondAccessor.count * sizeof(fastgltf::math::fvec3)) == 0);
 	}
 }
+
+TEST_CASE("Test vectorized accessor conversion", "[gltf-tools]") {
+	// 150 elements exercise the chunked gather path as well as the scalar remainder of the kernels.
+	constexpr std::size_t count = 150;
+	constexpr std::size_t stride = 8;
+
+	std::vector<std::byte> bytes(count * stride);
+	for (std::size_t i = 0; i < bytes.size(); ++i) {
+		bytes[i] = static_cast<std::byte>((i * 97 + 13) & 0xFF);
+	}
+
+	fastgltf::Asset asset;
+	asset.buffers.emplace_back(fastgltf::Buffer {
+		bytes.size(), fastgltf::sources::Vector { bytes, fastgltf::MimeType::None }, {} });
+	// One view over the interleaved data and one over the remainder of the data, tightly packed.
+	asset.bufferViews.emplace_back(fastgltf::BufferView { 0, 0, bytes.size(), stride, {}, {}, {} });
+	asset.bufferViews.emplace_back(fastgltf::BufferView { 0, 0, bytes.size(), {}, {}, {}, {} });
+
+	auto makeAccessor = [&](fastgltf::AccessorType type, fastgltf::ComponentType componentType, bool normalized, std::size_t view) {
+		fastgltf::Accessor accessor {};
+		accessor.count = count;
+		accessor.type = type;
+		accessor.componentType = componentType;
+		accessor.normalized = normalized;
+		accessor.bufferViewIndex = view;
+		return accessor;
+	};
+
+	SECTION("Strided normalized vectors to float") {
+		for (auto componentType : { fastgltf::ComponentType::Byte, fastgltf::ComponentType::UnsignedByte,
+				fastgltf::ComponentType::Short, fastgltf::ComponentType::UnsignedShort }) {
+			for (bool normalized : { true, false }) {
+				auto accessor = makeAccessor(fastgltf::AccessorType::Vec3, componentType, normalized, 0);
+
+				auto dstCopy = std::make_unique<fastgltf::math::fvec3[]>(count);
+				fastgltf::copyFromAccessor<fastgltf::math::fvec3>(asset, accessor, dstCopy.get());
+
+				auto components = std::make_unique<float[]>(count * 3);
+				fastgltf::copyComponentsFromAccessor<float>(asset, accessor, components.get());
+
+				for (std::size_t i = 0; i < count; ++i) {
+					for (std::size_t j = 0; j < 3; ++j) {
+						auto expected = fastgltf::internal::getAccessorComponentAt<float>(
+							componentType, accessor.type, &bytes[i * stride], j, normalized);
+						REQUIRE(dstCopy[i][j] == expected);
+						REQUIRE(components[i * 3 + j] == expected);
+					}
+				}
+			}
+		}
+	}
+
+	SECTION("Tightly packed indices to std::uint32_t") {
+		for (auto componentType : { fastgltf::ComponentType::UnsignedByte, fastgltf::ComponentType::UnsignedShort }) {
+			auto accessor = makeAccessor(fastgltf::AccessorType::Scalar, componentType, false, 1);
+
+			auto indices = std::make_unique<std::uint32_t[]>(count);
+			fastgltf::copyFromAccessor<std::uint32_t>(asset, accessor, indices.get());
+
+			for (std::size_t i = 0; i < count; ++i) {
+				REQUIRE(indices[i] == fastgltf::internal::getAccessorComponentAt<std::uint32_t>(
+					componentType, accessor.type, bytes.data(), i));
+			}
+		}
+	}
+
+	SECTION("Iteration with resolved component types") {
+		for (auto componentType : { fastgltf::ComponentType::Byte, fastgltf::ComponentType::UnsignedByte,
+				fastgltf::ComponentType::Short, fastgltf::ComponentType::UnsignedShort, fastgltf::ComponentType::UnsignedInt }) {
+			auto accessor = makeAccessor(fastgltf::AccessorType::Vec2, componentType, componentType != fastgltf::ComponentType::UnsignedInt, 0);
+
+			std::size_t count = 0;
+			fastgltf::iterateAccessorWithIndex<fastgltf::math::fvec2>(asset, accessor, [&](auto&& value, std::size_t index) {
+				REQUIRE(value == fastgltf::getAccessorElement<fastgltf::math::fvec2>(asset, accessor, index));
+				++count;
+			});
+			REQUIRE(count == accessor.count);
+
+			std::size_t index = 0;
+			for (auto value : fastgltf::iterateAccessor<fastgltf::math::fvec2>(asset, accessor)) {
+				REQUIRE(value == fastgltf::getAccessorElement<fastgltf::math::fvec2>(asset, accessor, index++));
+			}
+			REQUIRE(index == accessor.count);
+		}
+	}
+
+	SECTION("Strided destination") {
+		// Every converted element is written into the first half of a 32 byte destination element.
+		auto accessor = makeAccessor(fastgltf::AccessorType::Vec4, fastgltf::ComponentType::UnsignedByte, true, 0);
+
+		auto dstCopy = std::make_unique<fastgltf::math::fvec4[]>(count * 2);
+		fastgltf::copyFromAccessor<fastgltf::math::fvec4, sizeof(fastgltf::math::fvec4) * 2>(asset, accessor, dstCopy.get());
+
+		for (std::size_t i = 0; i < count; ++i) {
+			REQUIRE(dstCopy[i * 2] == fastgltf::internal::getAccessorElementAt<fastgltf::math::fvec4>(
+				accessor.componentType, &bytes[i * stride], true));
+		}
+	}
+}
+
+TEST_CASE("Test parallel accessor copy", "[gltf-tools]") {
+	// Large enough to be split into multiple chunks, with a sparse override on every seventh element.
+	constexpr std::size_t count = 100000;
+	constexpr std::size_t stride = 8;
+	constexpr std::size_t sparseCount = count / 7;
+
+	std::vector<std::byte> bytes(count * stride + sparseCount * sizeof(std::uint32_t) + sparseCount * 6);
+	for (std::size_t i = 0; i < bytes.size(); ++i) {
+		bytes[i] = static_cast<std::byte>((i * 97 + 13) & 0xFF);
+	}
+	for (std::uint32_t i = 0; i < sparseCount; ++i) {
+		const std::uint32_t index = i * 7 + 3;
+		std::memcpy(&bytes[count * stride + i * sizeof(index)], &index, sizeof(index));
+	}
+
+	fastgltf::Asset asset;
+	asset.buffers.emplace_back(fastgltf::Buffer {
+		bytes.size(), fastgltf::sources::Vector { bytes, fastgltf::MimeType::None }, {} });
+	asset.bufferViews.emplace_back(fastgltf::BufferView { 0, 0, count * stride, stride, {}, {}, {} });
+	asset.bufferViews.emplace_back(fastgltf::BufferView { 0, count * stride, sparseCount * sizeof(std::uint32_t), {}, {}, {}, {} });
+	asset.bufferViews.emplace_back(fastgltf::BufferView { 0, count * stride + sparseCount * sizeof(std::uint32_t), sparseCount * 6, {}, {}, {}, {} });
+
+	fastgltf::Accessor accessor {};
+	accessor.count = count;
+	accessor.type = fastgltf::AccessorType::Vec3;
+	accessor.componentType = fastgltf::ComponentType::Short;
+	accessor.normalized = true;
+	accessor.bufferViewIndex = 0;
+	accessor.sparse = fastgltf::SparseAccessor { sparseCount, 1, 0, 2, 0, fastgltf::ComponentType::UnsignedInt };
+
+	auto expected = std::make_unique<fastgltf::math::fvec3[]>(count);
+	fastgltf::copyFromAccessor<fastgltf::math::fvec3>(asset, accessor, expected.get());
+
+	// A custom executor which just runs the tasks serially, in reverse.
+	std::size_t executedTasks = 0;
+	fastgltf::TaskExecutor reverseExecutor { [](std::size_t taskCount, fastgltf::TaskFunction* task, void* taskData, void* userPointer) {
+		for (std::size_t i = taskCount; i > 0; --i) {
+			task(i - 1, taskData);
+		}
+		*static_cast<std::size_t*>(userPointer) += taskCount;
+	}, &executedTasks };
+
+	for (const auto& executor : { fastgltf::TaskExecutor {}, reverseExecutor }) {
+		auto dstCopy = std::make_unique<fastgltf::math::fvec3[]>(count);
+		fastgltf::copyFromAccessor<fastgltf::math::fvec3>(executor, asset, accessor, dstCopy.get());
+		REQUIRE(std::memcmp(dstCopy.get(), expected.get(), count * sizeof(fastgltf::math::fvec3)) == 0);
+
+		auto components = std::make_unique<float[]>(count * 3);
+		fastgltf::copyComponentsFromAccessor<float>(executor, asset, accessor, components.get());
+		REQUIRE(std::memcmp(components.get(), expected.get(), count * sizeof(fastgltf::math::fvec3)) == 0);
+
+		std::atomic_size_t mismatches = 0;
+		std::atomic_size_t visited = 0;
+		fastgltf::iterateAccessorWithIndex<fastgltf::math::fvec3>(executor, asset, accessor, [&](auto&& value, std::size_t index) {
+			if (!(value == expected[index]))
+				++mismatches;
+			++visited;
+		});
+		REQUIRE(mismatches == 0);
+		REQUIRE(visited == count);
+	}
+	REQUIRE(executedTasks > 3);
+}
+
+struct InterleavedTestVertex {
+	fastgltf::math::fvec3 position;
+	fastgltf::math::fvec3 normal;
+	fastgltf::math::fvec2 uv;
+	fastgltf::math::u8vec4 color;
+};
+
+template <>
+struct fastgltf::InterleavedVertexTraits<InterleavedTestVertex> {
+	static constexpr std::array attributes = {
+		makeInterleavedAttribute<math::fvec3>("POSITION", offsetof(InterleavedTestVertex, position)),
+		makeInterleavedAttribute<math::fvec3>("NORMAL", offsetof(InterleavedTestVertex, normal)),
+		makeInterleavedAttribute<math::fvec2>("TEXCOORD_0", offsetof(InterleavedTestVertex, uv)),
+		makeInterleavedAttribute<math::u8vec4>("COLOR_0", offsetof(InterleavedTestVertex, color)),
+	};
+};
+
+TEST_CASE("Test interleaved vertex writing", "[gltf-tools]") {
+	// Enough vertices for multiple chunks, with float positions, padded normalized short normals,
+	// and normalized unsigned short texture coordinates with sparse overrides. There are no colors.
+	constexpr std::size_t count = 1000;
+	constexpr std::size_t sparseCount = 10;
+	constexpr std::size_t normalOffset = count * 12;
+	constexpr std::size_t uvOffset = normalOffset + count * 8;
+	constexpr std::size_t sparseOffset = uvOffset + count * 4;
+
+	std::vector<std::byte> bytes(sparseOffset + sparseCount * sizeof(std::uint32_t) + sparseCount * 4);
+	for (std::size_t i = 0; i < bytes.size(); ++i) {
+		bytes[i] = static_cast<std::byte>((i * 31 + 7) & 0xFF);
+	}
+	for (std::size_t i = 0; i < count * 3; ++i) {
+		const auto position = static_cast<float>(i) * 0.25f;
+		std::memcpy(&bytes[i * sizeof(float)], &position, sizeof(float));
+	}
+	for (std::uint32_t i = 0; i < sparseCount; ++i) {
+		const std::uint32_t index = i * 97 + 5;
+		std::memcpy(&bytes[sparseOffset + i * sizeof(index)], &index, sizeof(index));
+	}
+
+	fastgltf::Asset asset;
+	asset.buffers.emplace_back(fastgltf::Buffer {
+		bytes.size(), fastgltf::sources::Vector { bytes, fastgltf::MimeType::None }, {} });
+	asset.bufferViews.emplace_back(fastgltf::BufferView { 0, 0, count * 12, {}, {}, {}, {} });
+	asset.bufferViews.emplace_back(fastgltf::BufferView { 0, normalOffset, count * 8, 8, {}, {}, {} });
+	asset.bufferViews.emplace_back(fastgltf::BufferView { 0, uvOffset, count * 4, {}, {}, {}, {} });
+	asset.bufferViews.emplace_back(fastgltf::BufferView { 0, sparseOffset, sparseCount * sizeof(std::uint32_t), {}, {}, {}, {} });
+	asset.bufferViews.emplace_back(fastgltf::BufferView { 0, sparseOffset + sparseCount * sizeof(std::uint32_t), sparseCount * 4, {}, {}, {}, {} });
+
+	auto addAccessor = [&](fastgltf::AccessorType type, fastgltf::ComponentType componentType, std::size_t bufferView) -> auto& {
+		auto& accessor = asset.accessors.emplace_back();
+		accessor.count = count;
+		accessor.type = type;
+		accessor.componentType = componentType;
+		accessor.normalized = componentType != fastgltf::ComponentType::Float;
+		accessor.bufferViewIndex = bufferView;
+		return accessor;
+	};
+	addAccessor(fastgltf::AccessorType::Vec3, fastgltf::ComponentType::Float, 0);
+	addAccessor(fastgltf::AccessorType::Vec3, fastgltf::ComponentType::Short, 1);
+	auto& uvAccessor = addAccessor(fastgltf::AccessorType::Vec2, fastgltf::ComponentType::UnsignedShort, 2);
+	uvAccessor.sparse = fastgltf::SparseAccessor { sparseCount, 3, 0, 4, 0, fastgltf::ComponentType::UnsignedInt };
+
+	fastgltf::Primitive primitive;
+	primitive.attributes.emplace_back(fastgltf::Attribute { "POSITION", 0 });
+	primitive.attributes.emplace_back(fastgltf::Attribute { "NORMAL", 1 });
+	primitive.attributes.emplace_back(fastgltf::Attribute { "TEXCOORD_0", 2 });
+
+	// Fill the vertices with garbage first, to check that the missing colors are zeroed.
+	std::vector<InterleavedTestVertex> vertices(count);
+	std::memset(vertices.data(), 0xFF, vertices.size() * sizeof(InterleavedTestVertex));
+	REQUIRE(fastgltf::writeInterleavedVertices(asset, primitive, vertices.data()) == count);
+
+	std::vector<fastgltf::math::fvec3> positions(count);
+	fastgltf::copyFromAccessor<fastgltf::math::fvec3>(asset, asset.accessors[0], positions.data());
+	std::vector<fastgltf::math::fvec3> normals(count);
+	fastgltf::copyFromAccessor<fastgltf::math::fvec3>(asset, asset.accessors[1], normals.data());
+	std::vector<fastgltf::math::fvec2> uvs(count);
+	fastgltf::copyFromAccessor<fastgltf::math::fvec2>(asset, asset.accessors[2], uvs.data());
+
+	for (std::size_t i = 0; i < count; ++i) {
+		REQUIRE(vertices[i].position == positions[i]);
+		REQUIRE(vertices[i].normal == normals[i]);
+		REQUIRE(vertices[i].uv == uvs[i]);
+		REQUIRE(vertices[i].color == fastgltf::math::u8vec4(0));
+	}
+
+	SECTION("Runtime layout") {
+		// Only write the positions as doubles, with a stride which is not the size of a struct.
+		constexpr std::size_t stride = 28;
+		const std::array layout = {
+			fastgltf::makeInterleavedAttribute<fastgltf::math::dvec3>("POSITION", 4),
+		};
+		std::vector<std::byte> interleaved(count * stride, std::byte(0xAB));
+		REQUIRE(fastgltf::writeInterleavedVertices(asset, primitive,
+			fastgltf::span<const fastgltf::InterleavedAttribute>(layout.data(), layout.size()), stride, interleaved.data()) == count);
+
+		for (std::size_t i = 0; i < count; ++i) {
+			fastgltf::math::dvec3 position;
+			std::memcpy(&position, &interleaved[i * stride + 4], sizeof(position));
+			REQUIRE(position == fastgltf::math::dvec3(positions[i].x(), positions[i].y(), positions[i].z()));
+			REQUIRE(interleaved[i * stride] == std::byte(0xAB));
+		}
+	}
+}
+
+TEST_CASE("Test flattened scene", "[gltf-tools]") {
+	// A small hierarchy with two roots, mixing TRS and matrix transforms:
+	// 0 -> (1 -> 3, 2), 4 -> 5, with node 6 not being part of the scene.
+	fastgltf::Asset asset;
+	asset.nodes.resize(7);
+	for (std::size_t i = 0; i < asset.nodes.size(); ++i) {
+		auto f = static_cast<float>(i);
+		asset.nodes[i].transform = fastgltf::TRS {
+			fastgltf::math::fvec3(f, 1.f - f, 0.5f * f),
+			normalize(fastgltf::math::fquat(0.1f * f, 0.2f, -0.3f * f, 1.f)),
+			fastgltf::math::fvec3(1.f + 0.1f * f),
+		};
+	}
+	asset.nodes[2].transform = fastgltf::getTransformMatrix(asset.nodes[2]);
+	asset.nodes[0].children = { 1, 2 };
+	asset.nodes[1].children = { 3 };
+	asset.nodes[4].children = { 5 };
+	auto& scene = asset.scenes.emplace_back();
+	scene.nodeIndices = { 0, 4 };
+
+	const fastgltf::math::fmat4x4 base = translate(fastgltf::math::fmat4x4(), fastgltf::math::fvec3(10.f, 0.f, 0.f));
+	fastgltf::FlattenedScene flattened(asset, 0, base);
+	REQUIRE(flattened.size() == 6);
+	REQUIRE(flattened.getFlattenedIndex(6) == fastgltf::FlattenedScene::noParent);
+
+	// Breadth first, so the roots come first and every parent is before its children.
+	const std::vector<std::size_t> expectedOrder = { 0, 4, 1, 2, 5, 3 };
+	for (std::size_t i = 0; i < flattened.size(); ++i) {
+		REQUIRE(flattened.getNodeIndices()[i] == expectedOrder[i]);
+		REQUIRE(flattened.getFlattenedIndex(expectedOrder[i]) == i);
+		auto parent = flattened.getParents()[i];
+		REQUIRE((parent == fastgltf::FlattenedScene::noParent || parent < i));
+	}
+
+	auto requireMatchesRecursion = [&]() {
+		std::size_t visited = 0;
+		fastgltf::iterateSceneNodes(asset, 0, base, [&](fastgltf::Node& node, const fastgltf::math::fmat4x4& matrix) {
+			auto nodeIndex = static_cast<std::size_t>(&node - asset.nodes.data());
+			const auto& world = flattened.getWorldMatrices()[flattened.getFlattenedIndex(nodeIndex)];
+			for (std::size_t i = 0; i < 4; ++i) {
+				for (std::size_t j = 0; j < 4; ++j) {
+					REQUIRE(world.col(i)[j] == Catch::Approx(matrix.col(i)[j]).margin(1e-4));
+				}
+			}
+			++visited;
+		});
+		REQUIRE(visited == flattened.size());
+	};
+	requireMatchesRecursion();
+
+	SECTION("Updating dirty subtrees") {
+		// Change node 1, whose subtree contains node 3, and check that the other world matrices stay untouched.
+		const auto unchanged = flattened.getWorldMatrices()[flattened.getFlattenedIndex(5)];
+		const fastgltf::math::fvec3 translation(-3.f, 2.f, 1.f);
+		std::get<fastgltf::TRS>(asset.nodes[1].transform).translation = translation;
+		flattened.setTranslation(flattened.getFlattenedIndex(1), translation);
+		flattened.updateWorldMatrices();
+		requireMatchesRecursion();
+		REQUIRE(flattened.getWorldMatrices()[flattened.getFlattenedIndex(5)] == unchanged);
+
+		// Matrix nodes can be changed as well.
+		const auto matrix = scale(fastgltf::math::fmat4x4(), fastgltf::math::fvec3(2.f));
+		asset.nodes[2].transform = matrix;
+		flattened.setLocalMatrix(flattened.getFlattenedIndex(2), matrix);
+		flattened.updateWorldMatrices();
+		requireMatchesRecursion();
+	}
+
+	SECTION("Changing the base matrix") {
+		const fastgltf::math::fmat4x4 newBase = scale(fastgltf::math::fmat4x4(), fastgltf::math::fvec3(0.5f));
+		flattened.setBaseMatrix(newBase);
+		flattened.updateWorldMatrices();
+
+		std::size_t visited = 0;
+		fastgltf::iterateSceneNodes(asset, 0, newBase, [&](fastgltf::Node& node, const fastgltf::math::fmat4x4& matrix) {
+			auto nodeIndex = static_cast<std::size_t>(&node - asset.nodes.data());
+			const auto& world = flattened.getWorldMatrices()[flattened.getFlattenedIndex(nodeIndex)];
+			REQUIRE(world.col(3).x() == Catch::Approx(matrix.col(3).x()).margin(1e-4));
+			++visited;
+		});
+		REQUIRE(visited == flattened.size());
+	}
+}
+
+TEST_CASE("Test animation evaluation", "[gltf-tools]") {
+	// Four keyframes shared by a linear translation, a linear rotation around Z, and a cubic spline scale.
+	std::vector<float> times = { 0.f, 1.f, 2.f, 3.f };
+	const float halfSqrt = std::sqrt(0.5f);
+	std::vector<float> translations = { 0.f, 0.f, 0.f, 2.f, -1.f, 0.f, 4.f, -2.f, 0.f, 6.f, -3.f, 0.f };
+	std::vector<float> rotations = { 0.f, 0.f, 0.f, 1.f, 0.f, 0.f, halfSqrt, halfSqrt, 0.f, 0.f, 1.f, 0.f, 0.f, 0.f, 1.f, 0.f };
+	std::vector<float> scales(4 * 3 * 3, 0.f);
+	for (std::size_t i = 0; i < 4; ++i) {
+		for (std::size_t j = 0; j < 3; ++j)
+			scales[i * 9 + 3 + j] = 1.f + static_cast<float>(i);
+	}
+
+	std::vector<std::byte> bytes;
+	fastgltf::Asset asset;
+	for (auto* values : { &times, &translations, &rotations, &scales }) {
+		const auto offset = bytes.size();
+		bytes.resize(offset + values->size() * sizeof(float));
+		std::memcpy(&bytes[offset], values->data(), values->size() * sizeof(float));
+		asset.bufferViews.emplace_back(fastgltf::BufferView { 0, offset, values->size() * sizeof(float), {}, {}, {}, {} });
+	}
+	asset.buffers.emplace_back(fastgltf::Buffer {
+		bytes.size(), fastgltf::sources::Vector { bytes, fastgltf::MimeType::None }, {} });
+
+	auto addAccessor = [&](fastgltf::AccessorType type, std::size_t count) {
+		auto& accessor = asset.accessors.emplace_back();
+		accessor.count = count;
+		accessor.type = type;
+		accessor.componentType = fastgltf::ComponentType::Float;
+		accessor.bufferViewIndex = asset.accessors.size() - 1;
+	};
+	addAccessor(fastgltf::AccessorType::Scalar, 4);
+	addAccessor(fastgltf::AccessorType::Vec3, 4);
+	addAccessor(fastgltf::AccessorType::Vec4, 4);
+	addAccessor(fastgltf::AccessorType::Vec3, 12);
+
+	asset.nodes.resize(2);
+	asset.nodes[0].children = { 1 };
+	asset.scenes.emplace_back().nodeIndices = { 0 };
+
+	auto& animation = asset.animations.emplace_back();
+	animation.samplers = {
+		{ 0, 1, fastgltf::AnimationInterpolation::Linear },
+		{ 0, 2, fastgltf::AnimationInterpolation::Linear },
+		{ 0, 3, fastgltf::AnimationInterpolation::CubicSpline },
+	};
+	animation.channels = {
+		{ 0, 1, fastgltf::AnimationPath::Translation },
+		{ 1, 1, fastgltf::AnimationPath::Rotation },
+		{ 2, 0, fastgltf::AnimationPath::Scale },
+		{ 0, 1, fastgltf::AnimationPath::Weights },
+	};
+
+	const fastgltf::DecodedAnimation decoded(asset, 0);
+	REQUIRE(decoded.getChannels().size() == 3);
+	REQUIRE(decoded.getSamplers().size() == 3);
+	REQUIRE(decoded.getTimes().size() == times.size());
+	REQUIRE(decoded.getDuration() == 3.f);
+
+	fastgltf::FlattenedScene scene(asset, 0);
+	fastgltf::AnimationEvaluator evaluator(decoded, scene);
+	const auto child = scene.getFlattenedIndex(1);
+	const auto root = scene.getFlattenedIndex(0);
+	auto requireState = [&](float time, float translationX, float angle, float scale) {
+		evaluator.evaluate(time, scene);
+		REQUIRE(scene.getTranslations()[child].x() == Catch::Approx(translationX));
+		REQUIRE(scene.getTranslations()[child].y() == Catch::Approx(-translationX / 2));
+		REQUIRE(scene.getRotations()[child].z() == Catch::Approx(std::sin(angle / 2)).margin(1e-5));
+		REQUIRE(scene.getRotations()[child].w() == Catch::Approx(std::cos(angle / 2)).margin(1e-5));
+		REQUIRE(scene.getScales()[root].x() == Catch::Approx(scale));
+	};
+
+	// Sequential playback, then jumping backwards, and finally times outside of the keyframes.
+	const float quarterTurn = std::acos(0.f);
+	requireState(0.5f, 1.f, quarterTurn * 0.5f, 1.5f);
+	requireState(1.5f, 3.f, quarterTurn * 1.5f, 2.5f);
+	requireState(2.25f, 4.5f, quarterTurn * 2.f, 3.15625f);
+	requireState(0.25f, 0.5f, quarterTurn * 0.25f, 1.15625f);
+	requireState(5.f, 6.f, quarterTurn * 2.f, 4.f);
+	requireState(-1.f, 0.f, 0.f, 1.f);
+
+	scene.updateWorldMatrices();
+	const auto expected = fastgltf::math::composeTransformMatrix(scene.getTranslations()[root], scene.getRotations()[root], scene.getScales()[root])
+		* fastgltf::math::composeTransformMatrix(scene.getTranslations()[child], scene.getRotations()[child], scene.getScales()[child]);
+	REQUIRE(scene.getWorldMatrices()[child] == expected);
+}
+
+TEST_CASE("Test read request list", "[gltf-tools]") {
+	// The first buffer has not been loaded and starts 100 bytes into its file, like the buffer of a GLB.
+	fastgltf::Asset asset;
+	auto& glbBuffer = asset.buffers.emplace_back();
+	glbBuffer.byteLength = 1000;
+	fastgltf::sources::URI uri;
+	uri.fileByteOffset = 100;
+	glbBuffer.data = std::move(uri);
+	auto& loadedBuffer = asset.buffers.emplace_back();
+	loadedBuffer.byteLength = 16;
+	loadedBuffer.data = fastgltf::sources::Vector {};
+
+	auto addBufferView = [&](std::size_t bufferIndex, std::size_t byteOffset, std::size_t byteLength) {
+		auto& bufferView = asset.bufferViews.emplace_back();
+		bufferView.bufferIndex = bufferIndex;
+		bufferView.byteOffset = byteOffset;
+		bufferView.byteLength = byteLength;
+	};
+	addBufferView(0, 0, 96);
+	addBufferView(0, 96, 24);
+	addBufferView(0, 400, 200);
+	addBufferView(1, 0, 16);
+
+	auto addAccessor = [&](std::size_t bufferViewIndex, std::size_t byteOffset, std::size_t count,
+			fastgltf::AccessorType type, fastgltf::ComponentType componentType) {
+		auto& accessor = asset.accessors.emplace_back();
+		accessor.bufferViewIndex = bufferViewIndex;
+		accessor.byteOffset = byteOffset;
+		accessor.count = count;
+		accessor.type = type;
+		accessor.componentType = componentType;
+	};
+	addAccessor(0, 12, 4, fastgltf::AccessorType::Vec3, fastgltf::ComponentType::Float);
+	addAccessor(1, 0, 6, fastgltf::AccessorType::Scalar, fastgltf::ComponentType::UnsignedShort);
+	addAccessor(3, 0, 4, fastgltf::AccessorType::Scalar, fastgltf::ComponentType::Float);
+
+	auto& primitive = asset.meshes.emplace_back().primitives.emplace_back();
+	primitive.attributes.emplace_back(fastgltf::Attribute { "POSITION", 0 });
+	primitive.attributes.emplace_back(fastgltf::Attribute { "_WEIGHT", 2 });
+	primitive.indicesAccessor = 1;
+
+	SECTION("Buffer view granularity") {
+		fastgltf::ReadRequestList list(asset);
+		list.addAllMeshes();
+
+		// The ranges can already be looked up before they are coalesced, in the order they were added in.
+		// The accessor of the loaded buffer is ignored.
+		REQUIRE(list.getRequests().size() == 2);
+		REQUIRE(list.getDestinationOffset(asset.accessors[0]).value() == 24 + 12);
+		REQUIRE(list.getDestinationOffset(asset.accessors[1]).value() == 0);
+		REQUIRE(!list.getDestinationOffset(asset.accessors[2]).has_value());
+
+		list.coalesce();
+		REQUIRE(list.getRequests().size() == 1);
+		const auto& request = list.getRequests()[0];
+		REQUIRE(request.bufferIndex == 0);
+		REQUIRE(request.fileOffset == 100);
+		REQUIRE(request.size == 120);
+		REQUIRE(request.destinationOffset == 0);
+		REQUIRE(list.getDestinationSize() == 120);
+		REQUIRE(list.getDestinationOffset(asset.accessors[0]).value() == 12);
+		REQUIRE(list.getDestinationOffset(asset.accessors[1]).value() == 96);
+		REQUIRE(!list.getDestinationOffset(0, 400).has_value());
+	}
+
+	SECTION("Accessor granularity") {
+		fastgltf::ReadRequestList list(asset, fastgltf::ReadGranularity::Accessor);
+		list.addMesh(0);
+		list.coalesce();
+		REQUIRE(list.getRequests().size() == 2);
+		REQUIRE(list.getRequests()[0].fileOffset == 112);
+		REQUIRE(list.getRequests()[0].size == 48);
+		REQUIRE(list.getRequests()[1].fileOffset == 196);
+		REQUIRE(list.getRequests()[1].size == 12);
+		REQUIRE(list.getDestinationSize() == 60);
+		REQUIRE(list.getDestinationOffset(asset.accessors[0]).value() == 0);
+		REQUIRE(list.getDestinationOffset(asset.accessors[1]).value() == 48);
+
+		// Merging the small gap between both ranges.
+		list.coalesce(1, 36);
+		REQUIRE(list.getRequests().size() == 1);
+		REQUIRE(list.getRequests()[0].size == 96);
+		REQUIRE(list.getDestinationOffset(asset.accessors[1]).value() == 84);
+	}
+
+	SECTION("Aligned requests") {
+		fastgltf::ReadRequestList list(asset, fastgltf::ReadGranularity::Accessor);
+		list.addPrimitive(primitive);
+		list.addBufferView(2);
+		list.coalesce(64);
+		REQUIRE(list.getRequests().size() == 2);
+		for (std::size_t i = 0; i < list.getRequests().size(); ++i) {
+			const auto& request = list.getRequests()[i];
+			REQUIRE(request.fileOffset % 64 == 0);
+			REQUIRE(request.size % 64 == 0);
+			REQUIRE(request.destinationOffset % 64 == 0);
+		}
+		REQUIRE(list.getRequests()[0].fileOffset == 64);
+		REQUIRE(list.getRequests()[0].size == 192);
+		REQUIRE(list.getRequests()[1].fileOffset == 448);
+		REQUIRE(list.getRequests()[1].size == 256);
+		REQUIRE(list.getDestinationSize() == 448);
+		REQUIRE(list.getDestinationOffset(asset.accessors[0]).value() == 48);
+		REQUIRE(list.getDestinationOffset(asset.accessors[1]).value() == 132);
+		REQUIRE(list.getDestinationOffset(0, 400).value() == 192 + 52);
+	}
+}
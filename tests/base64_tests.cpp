@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <fstream>
 #include <sstream>
 
@@ -44,6 +45,93 @@ TEST_CASE("Check all base64 decoders", "[base64]") {
 #endif
 }
 
+TEST_CASE("Check all base64 decoders with large data", "[base64]") {
+    // Every size up to a few AVX-512 blocks, so that the vectorized loops and all tail lengths are covered.
+    std::vector<std::uint8_t> data(600);
+    for (std::size_t i = 0; i < data.size(); ++i)
+        data[i] = static_cast<std::uint8_t>(i * 131 + 17);
+    for (std::size_t size = 1; size <= data.size(); ++size) {
+        std::string encoded(fastgltf::base64::getEncodedSize(size), '\0');
+        fastgltf::base64::fallback_encode_inplace(data.data(), size, encoded.data());
+        auto expected = fastgltf::base64::fallback_decode(encoded);
+        REQUIRE(std::equal(expected.begin(), expected.end(), data.begin(), data.begin() + size));
+
+#if defined(__x86_64__) || defined(_M_AMD64) || defined(_M_IX86)
+        REQUIRE(expected == fastgltf::base64::sse4_decode(encoded));
+        REQUIRE(expected == fastgltf::base64::avx2_decode(encoded));
+        if (fastgltf::base64::avx512_vbmi_supported()) {
+            REQUIRE(expected == fastgltf::base64::avx512_decode(encoded));
+        }
+#endif
+#if defined(__aarch64__)
+        REQUIRE(expected == fastgltf::base64::neon_decode(encoded));
+#endif
+    }
+}
+
+TEST_CASE("Check parallel base64 decoding", "[base64]") {
+    // Just above the threshold, with a final chunk that is not a multiple of the chunk size and that is padded.
+    const auto size = fastgltf::base64::getOutputSize(fastgltf::base64::parallelDecodeThreshold, 0) + 1001;
+    std::vector<std::uint8_t> data(size);
+    for (std::size_t i = 0; i < data.size(); ++i)
+        data[i] = static_cast<std::uint8_t>((i * 2654435761U) >> 13U);
+    std::string encoded(fastgltf::base64::getEncodedSize(size), '\0');
+    fastgltf::base64::encode_inplace(data.data(), size, encoded.data());
+    const auto padding = fastgltf::base64::getPadding(encoded);
+    REQUIRE(padding == 1);
+
+    std::vector<std::uint8_t> decoded(size);
+    fastgltf::base64::decode_inplace_parallel(encoded, decoded.data(), padding);
+    REQUIRE(decoded == data);
+
+    // A custom executor running the tasks in reverse, to make sure that the chunks are independent.
+    std::size_t taskCount = 0;
+    std::fill(decoded.begin(), decoded.end(), 0);
+    fastgltf::base64::decode_inplace_parallel(encoded, decoded.data(), padding,
+            [](std::size_t count, fastgltf::TaskFunction* task, void* taskData, void* userPointer) {
+        *static_cast<std::size_t*>(userPointer) = count;
+        for (std::size_t i = count; i > 0; --i)
+            task(i - 1, taskData);
+    }, &taskCount);
+    REQUIRE(taskCount > 1);
+    REQUIRE(decoded == data);
+}
+
+TEST_CASE("Check all base64 encoders", "[base64]") {
+    const std::string_view hello = "Hello World. Hello World. Hello World.";
+    std::string encoded(fastgltf::base64::getEncodedSize(hello.size()), '\0');
+    fastgltf::base64::encode_inplace(reinterpret_cast<const std::uint8_t*>(hello.data()), hello.size(), encoded.data());
+    REQUIRE(encoded == testBase64);
+
+    // Every size up to a few SIMD blocks, so that all tail lengths and paddings are covered by every encoder.
+    std::vector<std::uint8_t> data(200);
+    for (std::size_t i = 0; i < data.size(); ++i)
+        data[i] = static_cast<std::uint8_t>(i * 131 + 17);
+    for (std::size_t size = 0; size <= data.size(); ++size) {
+        std::string expected(fastgltf::base64::getEncodedSize(size), '\0');
+        fastgltf::base64::fallback_encode_inplace(data.data(), size, expected.data());
+
+        std::string result(expected.size(), '\0');
+        fastgltf::base64::encode_inplace(data.data(), size, result.data());
+        REQUIRE(result == expected);
+#if defined(__x86_64__) || defined(_M_AMD64) || defined(_M_IX86)
+        fastgltf::base64::avx2_encode_inplace(data.data(), size, result.data());
+        REQUIRE(result == expected);
+        fastgltf::base64::sse4_encode_inplace(data.data(), size, result.data());
+        REQUIRE(result == expected);
+#endif
+#if defined(__aarch64__)
+        fastgltf::base64::neon_encode_inplace(data.data(), size, result.data());
+        REQUIRE(result == expected);
+#endif
+
+        if (size != 0) {
+            auto decoded = fastgltf::base64::decode(expected);
+            REQUIRE(std::equal(decoded.begin(), decoded.end(), data.begin(), data.begin() + size));
+        }
+    }
+}
+
 TEST_CASE("Check big base64 data decoding", "[base64]") {
     std::ifstream file(path / "base64.txt");
     REQUIRE(file.is_open());
@@ -1,5 +1,6 @@
 #include <algorithm>
 #include <cstdlib>
+#include <cstring>
 
 #include <catch2/catch_approx.hpp>
 #include <catch2/catch_test_macros.hpp>
@@ -15,6 +16,7 @@
 #include <fastgltf/core.hpp>
 #include <fastgltf/types.hpp>
 #include <fastgltf/math.hpp>
+#include <fastgltf/tools.hpp>
 #include "gltf_path.hpp"
 #include <simdjson.h>
 
@@ -308,6 +310,115 @@ TEST_CASE("Validate models with re-used parser", "[gltf-loader]") {
 	}
 }
 
+#if !FASTGLTF_DISABLE_CUSTOM_MEMORY_POOL
+TEST_CASE("Test upstream memory resource and arena reuse", "[gltf-loader]") {
+	struct CountingResource : std::pmr::memory_resource {
+		std::size_t allocations = 0;
+		std::size_t liveAllocations = 0;
+
+		void* do_allocate(std::size_t bytes, std::size_t alignment) override {
+			++allocations;
+			++liveAllocations;
+			return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+		}
+		void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override {
+			--liveAllocations;
+			std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+		}
+		[[nodiscard]] bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+			return this == &other;
+		}
+	} upstream;
+
+	std::string json = R"({"asset":{"version":"2.0"},"nodes":[)";
+	for (std::size_t i = 0; i < 64; ++i) {
+		if (i != 0)
+			json += ',';
+		json += R"({"name":"A node with a name too long for small string optimization","children":[)" + std::to_string(i) + "]}";
+	}
+	json += "]}";
+	auto jsonData = fastgltf::GltfDataBuffer::FromBytes(reinterpret_cast<const std::byte*>(json.data()), json.size());
+	REQUIRE(jsonData.error() == fastgltf::Error::None);
+
+	{
+		fastgltf::Parser parser;
+		parser.setUpstreamMemoryResource(&upstream);
+
+		auto asset = parser.loadGltfJson(jsonData.get(), {});
+		REQUIRE(asset.error() == fastgltf::Error::None);
+		REQUIRE(asset->nodes.size() == 64);
+		REQUIRE(asset->nodes.get_allocator().resource() != std::pmr::get_default_resource());
+		REQUIRE(asset->nodes[63].name == "A node with a name too long for small string optimization");
+		REQUIRE(upstream.allocations != 0);
+
+		// While the first asset is alive, the next one needs its own memory.
+		auto allocations = upstream.allocations;
+		auto second = parser.loadGltfJson(jsonData.get(), {});
+		REQUIRE(second.error() == fastgltf::Error::None);
+		REQUIRE(upstream.allocations > allocations);
+
+		// Once the previous asset is gone, its memory is reused. The first reuse merges its chunks into a single one.
+		second = fastgltf::Expected<fastgltf::Asset>(fastgltf::Error::None);
+		second = parser.loadGltfJson(jsonData.get(), {});
+		REQUIRE(second.error() == fastgltf::Error::None);
+
+		second = fastgltf::Expected<fastgltf::Asset>(fastgltf::Error::None);
+		allocations = upstream.allocations;
+		auto third = parser.loadGltfJson(jsonData.get(), {});
+		REQUIRE(third.error() == fastgltf::Error::None);
+		REQUIRE(third->nodes[0].children.size() == 1);
+		REQUIRE(upstream.allocations == allocations);
+	}
+	REQUIRE(upstream.liveAllocations == 0);
+}
+#endif
+
+TEST_CASE("Load a batch of glTFs with a parser pool", "[gltf-loader]") {
+	// A tiny retained capacity makes every parser release its JSON buffers after each file.
+	fastgltf::ParserPool pool(fastgltf::Extensions::None, 3, 16);
+	REQUIRE(pool.parserCount() == 3);
+
+	std::vector<std::filesystem::path> paths;
+	for (std::size_t i = 0; i < 32; ++i)
+		paths.emplace_back(path / (i % 4 == 3 ? "empty_json.gltf" : "basic_gltf.gltf"));
+	paths.emplace_back(path / "does_not_exist.gltf");
+
+	SECTION("Load from paths") {
+		auto assets = pool.loadGltfs(fastgltf::span<const std::filesystem::path>(paths.data(), paths.size()));
+		REQUIRE(assets.size() == paths.size());
+		for (std::size_t i = 0; i < 32; ++i) {
+			if (i % 4 == 3) {
+				REQUIRE(assets[i].error() == fastgltf::Error::InvalidOrMissingAssetField);
+			} else {
+				REQUIRE(assets[i].error() == fastgltf::Error::None);
+				REQUIRE(fastgltf::validate(assets[i].get()) == fastgltf::Error::None);
+			}
+		}
+		REQUIRE(assets.back().error() != fastgltf::Error::None);
+	}
+
+	SECTION("Load from data getters") {
+		paths.pop_back();
+		std::vector<fastgltf::GltfDataBuffer> buffers;
+		std::vector<fastgltf::GltfDataGetter*> getters;
+		std::vector<std::filesystem::path> directories;
+		buffers.reserve(paths.size());
+		for (const auto& file : paths) {
+			auto buffer = fastgltf::GltfDataBuffer::FromPath(file);
+			REQUIRE(buffer.error() == fastgltf::Error::None);
+			getters.emplace_back(&buffers.emplace_back(std::move(buffer.get())));
+			directories.emplace_back(path);
+		}
+
+		auto assets = pool.loadGltfs(fastgltf::span<fastgltf::GltfDataGetter* const>(getters.data(), getters.size()),
+			fastgltf::span<const std::filesystem::path>(directories.data(), directories.size()));
+		REQUIRE(assets.size() == paths.size());
+		for (std::size_t i = 0; i < assets.size(); ++i) {
+			REQUIRE(assets[i].error() == (i % 4 == 3 ? fastgltf::Error::InvalidOrMissingAssetField : fastgltf::Error::None));
+		}
+	}
+}
+
 TEST_CASE("Test allocation callbacks for embedded buffers", "[gltf-loader]") {
     auto boxPath = sampleModels / "2.0" / "Box" / "glTF-Embedded";
 	fastgltf::GltfFileStream jsonData(boxPath / "Box.gltf");
@@ -366,6 +477,96 @@ TEST_CASE("Test base64 decoding callbacks", "[gltf-loader]") {
     REQUIRE(decodeCounter != 0);
 }
 
+TEST_CASE("Test decoding data URIs in parallel", "[gltf-loader]") {
+	// A buffer just large enough to be decoded in multiple chunks.
+	std::vector<std::uint8_t> data(fastgltf::base64::getOutputSize(fastgltf::base64::parallelDecodeThreshold, 0) + 2);
+	for (std::size_t i = 0; i < data.size(); ++i)
+		data[i] = static_cast<std::uint8_t>(i * 7 + i / 251);
+	std::string encoded(fastgltf::base64::getEncodedSize(data.size()), '\0');
+	fastgltf::base64::encode_inplace(data.data(), data.size(), encoded.data());
+
+	const auto json = R"({"asset": {"version": "2.0"}, "buffers": [{"byteLength": )" + std::to_string(data.size())
+		+ R"(, "uri": "data:application/octet-stream;base64,)" + encoded + R"("}]})";
+	auto jsonData = fastgltf::GltfDataBuffer::FromBytes(reinterpret_cast<const std::byte*>(json.data()), json.size());
+	REQUIRE(jsonData.error() == fastgltf::Error::None);
+
+	fastgltf::Parser parser;
+	auto asset = parser.loadGltfJson(jsonData.get(), {}, fastgltf::Options::DecodeDataUrisInParallel);
+	REQUIRE(asset.error() == fastgltf::Error::None);
+	REQUIRE(asset->buffers.size() == 1);
+	const auto* array = std::get_if<fastgltf::sources::Array>(&asset->buffers.front().data);
+	REQUIRE(array != nullptr);
+	REQUIRE(array->bytes.size() == data.size());
+	REQUIRE(std::memcmp(array->bytes.data(), data.data(), data.size()) == 0);
+
+	// The data is also decoded in parallel directly into mapped memory.
+	std::vector<std::uint8_t> mapped;
+	parser.setUserPointer(&mapped);
+	parser.setBufferAllocationCallback([](std::uint64_t bufferSize, void* userPointer) -> fastgltf::BufferInfo {
+		auto* memory = static_cast<std::vector<std::uint8_t>*>(userPointer);
+		memory->resize(bufferSize);
+		return fastgltf::BufferInfo { memory->data(), 0 };
+	}, nullptr);
+	auto mappedAsset = parser.loadGltfJson(jsonData.get(), {}, fastgltf::Options::DecodeDataUrisInParallel);
+	REQUIRE(mappedAsset.error() == fastgltf::Error::None);
+	REQUIRE(std::holds_alternative<fastgltf::sources::CustomBuffer>(mappedAsset->buffers.front().data));
+	REQUIRE(mapped == data);
+}
+
+TEST_CASE("Test parallel loading of external files", "[gltf-loader]") {
+	auto sponza = sampleModels / "2.0" / "Sponza" / "glTF";
+	constexpr auto loadOptions = fastgltf::Options::LoadExternalBuffers | fastgltf::Options::LoadExternalImages;
+
+	fastgltf::Parser parser;
+	fastgltf::GltfFileStream serialData(sponza / "Sponza.gltf");
+	REQUIRE(serialData.isOpen());
+	auto serial = parser.loadGltfJson(serialData, sponza, loadOptions);
+	REQUIRE(serial.error() == fastgltf::Error::None);
+
+	auto compareSources = [](const fastgltf::DataSource& lhs, const fastgltf::DataSource& rhs) {
+		REQUIRE(lhs.index() == rhs.index());
+		const auto* lhsArray = std::get_if<fastgltf::sources::Array>(&lhs);
+		const auto* rhsArray = std::get_if<fastgltf::sources::Array>(&rhs);
+		REQUIRE(lhsArray != nullptr);
+		REQUIRE(lhsArray->mimeType == rhsArray->mimeType);
+		REQUIRE(lhsArray->bytes.size() == rhsArray->bytes.size());
+		REQUIRE(std::equal(lhsArray->bytes.begin(), lhsArray->bytes.end(), rhsArray->bytes.begin()));
+	};
+
+	SECTION("Default thread pool") {
+		fastgltf::GltfFileStream jsonData(sponza / "Sponza.gltf");
+		REQUIRE(jsonData.isOpen());
+		auto asset = parser.loadGltfJson(jsonData, sponza, loadOptions | fastgltf::Options::LoadExternalFilesInParallel);
+		REQUIRE(asset.error() == fastgltf::Error::None);
+		REQUIRE(fastgltf::validate(asset.get()) == fastgltf::Error::None);
+
+		REQUIRE(asset->buffers.size() == serial->buffers.size());
+		for (std::size_t i = 0; i < asset->buffers.size(); ++i)
+			compareSources(asset->buffers[i].data, serial->buffers[i].data);
+		REQUIRE(asset->images.size() == serial->images.size());
+		for (std::size_t i = 0; i < asset->images.size(); ++i)
+			compareSources(asset->images[i].data, serial->images[i].data);
+	}
+
+	SECTION("Custom task executor") {
+		std::size_t taskCount = 0;
+		auto executor = [](std::size_t count, fastgltf::TaskFunction* task, void* taskData, void* userPointer) {
+			*static_cast<std::size_t*>(userPointer) += count;
+			for (std::size_t i = 0; i < count; ++i)
+				task(i, taskData);
+		};
+
+		parser.setUserPointer(&taskCount);
+		parser.setTaskExecutorCallback(executor);
+
+		fastgltf::GltfFileStream jsonData(sponza / "Sponza.gltf");
+		REQUIRE(jsonData.isOpen());
+		auto asset = parser.loadGltfJson(jsonData, sponza, loadOptions | fastgltf::Options::LoadExternalFilesInParallel);
+		REQUIRE(asset.error() == fastgltf::Error::None);
+		REQUIRE(taskCount == asset->buffers.size() + asset->images.size());
+	}
+}
+
 TEST_CASE("Validate sparse accessor parsing", "[gltf-loader]") {
     auto simpleSparseAccessor = sampleModels / "2.0" / "SimpleSparseAccessor" / "glTF";
 	fastgltf::GltfFileStream jsonData(simpleSparseAccessor / "SimpleSparseAccessor.gltf");
@@ -485,6 +686,104 @@ TEST_CASE("Test accessors min/max", "[gltf-loader]") {
     }
 }
 
+TEST_CASE("Test node weights", "[gltf-loader]") {
+	constexpr std::string_view json = R"({
+		"nodes": [{ "weights": [0.5, 1] }, {}]
+	})";
+	auto jsonData = fastgltf::GltfDataBuffer::FromBytes(reinterpret_cast<const std::byte*>(json.data()), json.size());
+	REQUIRE(jsonData.error() == fastgltf::Error::None);
+
+	fastgltf::Parser parser;
+	auto asset = parser.loadGltfJson(jsonData.get(), {}, fastgltf::Options::DontRequireValidAssetMember);
+	REQUIRE(asset.error() == fastgltf::Error::None);
+	REQUIRE(asset->nodes.size() == 2);
+
+	auto& weights = asset->nodes[0].weights;
+	REQUIRE(weights.size() == 2);
+	REQUIRE(weights[0] == 0.5f);
+	REQUIRE(weights[1] == 1.0f);
+	REQUIRE(asset->nodes[1].weights.empty());
+}
+
+TEST_CASE("Test parsing fields in any order", "[gltf-loader]") {
+	// Every object is parsed in a single pass, so fields which depend on other fields need to work
+	// regardless of whether those appear before or after them.
+	constexpr std::string_view json = R"({
+		"accessors": [
+			{ "min": [0, 1], "max": [2, 3], "count": 1, "type": "VEC2", "componentType": 5123 },
+			{ "max": [1.5], "min": [0.5], "componentType": 5126, "count": 1, "type": "SCALAR" }
+		],
+		"materials": [{
+			"pbrMetallicRoughness": {
+				"baseColorTexture": {
+					"extensions": { "KHR_texture_transform": { "rotation": 1.5 } },
+					"texCoord": 1,
+					"index": 2
+				}
+			},
+			"normalTexture": { "scale": 0.5, "index": 3 }
+		}],
+		"nodes": [
+			{ "translation": [1, 2, 3], "scale": [2, 2, 2], "matrix": [1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 4, 5, 6, 1] },
+			{ "matrix": [1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 4, 5, 6, 1], "rotation": [0, 0, 0, 1], "translation": [1, 2, 3] },
+			{ "rotation": [0, 0, 0, 1], "translation": [1, 2, 3] }
+		]
+	})";
+	auto jsonData = fastgltf::GltfDataBuffer::FromBytes(reinterpret_cast<const std::byte*>(json.data()), json.size());
+	REQUIRE(jsonData.error() == fastgltf::Error::None);
+
+	fastgltf::Parser parser(fastgltf::Extensions::KHR_texture_transform);
+	auto asset = parser.loadGltfJson(jsonData.get(), {}, fastgltf::Options::DontRequireValidAssetMember);
+	REQUIRE(asset.error() == fastgltf::Error::None);
+
+	// The bounds use the integer or floating point vector depending on the componentType.
+	REQUIRE(asset->accessors.size() == 2);
+	{
+		auto& accessor = asset->accessors[0];
+		REQUIRE(accessor.type == fastgltf::AccessorType::Vec2);
+		REQUIRE(accessor.componentType == fastgltf::ComponentType::UnsignedShort);
+		const auto* min = std::get_if<FASTGLTF_STD_PMR_NS::vector<std::int64_t>>(&accessor.min);
+		const auto* max = std::get_if<FASTGLTF_STD_PMR_NS::vector<std::int64_t>>(&accessor.max);
+		REQUIRE(min != nullptr);
+		REQUIRE(max != nullptr);
+		REQUIRE(*min == FASTGLTF_STD_PMR_NS::vector<std::int64_t> { 0, 1 });
+		REQUIRE(*max == FASTGLTF_STD_PMR_NS::vector<std::int64_t> { 2, 3 });
+	}
+	{
+		auto& accessor = asset->accessors[1];
+		const auto* min = std::get_if<FASTGLTF_STD_PMR_NS::vector<double>>(&accessor.min);
+		const auto* max = std::get_if<FASTGLTF_STD_PMR_NS::vector<double>>(&accessor.max);
+		REQUIRE(min != nullptr);
+		REQUIRE(max != nullptr);
+		REQUIRE(min->front() == 0.5);
+		REQUIRE(max->front() == 1.5);
+	}
+
+	// The texture transform is read even though the index only follows after it.
+	REQUIRE(asset->materials.size() == 1);
+	auto& material = asset->materials.front();
+	REQUIRE(material.pbrData.baseColorTexture.has_value());
+	REQUIRE(material.pbrData.baseColorTexture->textureIndex == 2);
+	REQUIRE(material.pbrData.baseColorTexture->texCoordIndex == 1);
+	REQUIRE(material.pbrData.baseColorTexture->transform != nullptr);
+	REQUIRE(material.pbrData.baseColorTexture->transform->rotation == 1.5f);
+	REQUIRE(material.normalTexture.has_value());
+	REQUIRE(material.normalTexture->textureIndex == 3);
+	REQUIRE(material.normalTexture->scale == 0.5f);
+
+	// The matrix takes precedence over the TRS fields, wherever it appears.
+	REQUIRE(asset->nodes.size() == 3);
+	for (std::size_t i = 0; i < 2; ++i) {
+		const auto* matrix = std::get_if<fastgltf::math::fmat4x4>(&asset->nodes[i].transform);
+		REQUIRE(matrix != nullptr);
+		REQUIRE((*matrix)[3] == fastgltf::math::fvec4(4.f, 5.f, 6.f, 1.f));
+	}
+	const auto* trs = std::get_if<fastgltf::TRS>(&asset->nodes[2].transform);
+	REQUIRE(trs != nullptr);
+	REQUIRE(trs->translation == fastgltf::math::fvec3(1.f, 2.f, 3.f));
+	REQUIRE(trs->scale == fastgltf::math::fvec3(1.f));
+}
+
 TEST_CASE("Test unicode characters", "[gltf-loader]") {
 #if FASTGLTF_CPP_20
 	auto unicodePath = sampleModels / "2.0" / std::filesystem::path(u8"Unicode❤♻Test") / "glTF";
@@ -585,6 +884,357 @@ TEST_CASE("Test extras callback", "[gltf-loader]") {
 	}
 }
 
+TEST_CASE("Test parsing categories in parallel", "[gltf-loader]") {
+	auto brainStem = sampleModels / "2.0" / "BrainStem" / "glTF";
+	fastgltf::Parser parser;
+
+	fastgltf::GltfFileStream serialData(brainStem / "BrainStem.gltf");
+	REQUIRE(serialData.isOpen());
+	auto serial = parser.loadGltfJson(serialData, brainStem, fastgltf::Options::GenerateMeshIndices);
+	REQUIRE(serial.error() == fastgltf::Error::None);
+
+	fastgltf::GltfFileStream jsonData(brainStem / "BrainStem.gltf");
+	REQUIRE(jsonData.isOpen());
+	auto asset = parser.loadGltfJson(jsonData, brainStem, fastgltf::Options::GenerateMeshIndices | fastgltf::Options::ParseCategoriesInParallel);
+	REQUIRE(asset.error() == fastgltf::Error::None);
+	REQUIRE(fastgltf::validate(asset.get()) == fastgltf::Error::None);
+
+	REQUIRE(asset->availableCategories == serial->availableCategories);
+	REQUIRE(asset->accessors.size() == serial->accessors.size());
+	REQUIRE(asset->animations.size() == serial->animations.size());
+	REQUIRE(asset->buffers.size() == serial->buffers.size());
+	REQUIRE(asset->bufferViews.size() == serial->bufferViews.size());
+	REQUIRE(asset->materials.size() == serial->materials.size());
+	REQUIRE(asset->meshes.size() == serial->meshes.size());
+	REQUIRE(asset->nodes.size() == serial->nodes.size());
+	REQUIRE(asset->skins.size() == serial->skins.size());
+	for (std::size_t i = 0; i < asset->nodes.size(); ++i) {
+		REQUIRE(asset->nodes[i].name == serial->nodes[i].name);
+	}
+	for (std::size_t i = 0; i < asset->accessors.size(); ++i) {
+		REQUIRE(asset->accessors[i].count == serial->accessors[i].count);
+		REQUIRE(asset->accessors[i].bufferViewIndex == serial->accessors[i].bufferViewIndex);
+	}
+}
+
+TEST_CASE("Test validating while parsing", "[gltf-loader]") {
+	auto load = [](std::string_view json, fastgltf::Options options) {
+		auto jsonData = fastgltf::GltfDataBuffer::FromBytes(reinterpret_cast<const std::byte*>(json.data()), json.size());
+		REQUIRE(jsonData.error() == fastgltf::Error::None);
+		fastgltf::Parser parser;
+		return parser.loadGltfJson(jsonData.get(), {}, options | fastgltf::Options::DontRequireValidAssetMember).error();
+	};
+
+	// The accessors are validated inline here, since their buffer views have already been parsed.
+	constexpr std::string_view validJson = R"({
+		"buffers": [{ "byteLength": 12, "uri": "data:application/octet-stream;base64,AAAAAAAAAAAAAAAA" }],
+		"bufferViews": [{ "buffer": 0, "byteLength": 12 }],
+		"accessors": [{ "bufferView": 0, "componentType": 5126, "count": 1, "type": "VEC3", "min": [0, 0, 0], "max": [1, 1, 1] }],
+		"meshes": [{ "primitives": [{ "attributes": { "POSITION": 0 } }] }],
+		"nodes": [{ "mesh": 0 }],
+		"scenes": [{ "nodes": [0] }]
+	})";
+	// The POSITION accessor lacks min and max, which is only detected with the mesh.
+	constexpr std::string_view invalidMeshJson = R"({
+		"meshes": [{ "primitives": [{ "attributes": { "POSITION": 0 } }] }],
+		"accessors": [{ "bufferView": 0, "componentType": 5126, "count": 1, "type": "VEC3" }],
+		"bufferViews": [{ "buffer": 0, "byteLength": 12 }],
+		"buffers": [{ "byteLength": 12, "uri": "data:application/octet-stream;base64,AAAAAAAAAAAAAAAA" }]
+	})";
+	// The buffer view of the accessor does not exist.
+	constexpr std::string_view invalidAccessorJson = R"({
+		"buffers": [{ "byteLength": 12, "uri": "data:application/octet-stream;base64,AAAAAAAAAAAAAAAA" }],
+		"bufferViews": [{ "buffer": 0, "byteLength": 12 }],
+		"accessors": [{ "bufferView": 1, "componentType": 5126, "count": 1, "type": "VEC3" }]
+	})";
+	// The node references a mesh which does not exist, and the scene a node which does not exist.
+	constexpr std::string_view invalidNodeJson = R"({
+		"nodes": [{ "mesh": 0 }]
+	})";
+	constexpr std::string_view invalidSceneJson = R"({
+		"scenes": [{ "nodes": [1] }],
+		"nodes": [{}]
+	})";
+
+	for (auto options : { fastgltf::Options::Validate, fastgltf::Options::Validate | fastgltf::Options::ParseCategoriesInParallel }) {
+		REQUIRE(load(validJson, options) == fastgltf::Error::None);
+		REQUIRE(load(invalidMeshJson, options) == fastgltf::Error::InvalidGltf);
+		REQUIRE(load(invalidAccessorJson, options) == fastgltf::Error::InvalidGltf);
+		REQUIRE(load(invalidNodeJson, options) == fastgltf::Error::InvalidGltf);
+		REQUIRE(load(invalidSceneJson, options) == fastgltf::Error::InvalidGltf);
+	}
+
+	// Without Options::Validate the invalid assets load, but are rejected by both validate functions.
+	for (auto json : { invalidMeshJson, invalidAccessorJson, invalidNodeJson, invalidSceneJson }) {
+		auto jsonData = fastgltf::GltfDataBuffer::FromBytes(reinterpret_cast<const std::byte*>(json.data()), json.size());
+		REQUIRE(jsonData.error() == fastgltf::Error::None);
+		fastgltf::Parser parser;
+		auto asset = parser.loadGltfJson(jsonData.get(), {}, fastgltf::Options::DontRequireValidAssetMember);
+		REQUIRE(asset.error() == fastgltf::Error::None);
+		REQUIRE(fastgltf::validate(asset.get()) == fastgltf::Error::InvalidGltf);
+		REQUIRE(fastgltf::validateInParallel(asset.get()) == fastgltf::Error::InvalidGltf);
+	}
+}
+
+TEST_CASE("Test parsing categories lazily", "[gltf-loader]") {
+	constexpr std::string_view json = R"({
+		"buffers": [{ "byteLength": 12, "uri": "data:application/octet-stream;base64,AAAAAAAAAAAAAAAA" }],
+		"bufferViews": [{ "buffer": 0, "byteLength": 12 }],
+		"accessors": [
+			{ "bufferView": 0, "componentType": 5126, "count": 1, "type": "VEC3", "min": [0, 0, 0], "max": [0, 0, 0] },
+			{ "bufferView": 0, "componentType": 5126, "count": 1, "type": "SCALAR" }
+		],
+		"materials": [{ "name": "material" }],
+		"meshes": [{ "primitives": [{ "attributes": { "POSITION": 0 }, "material": 0 }] }],
+		"animations": [{ "channels": [{ "sampler": 0, "target": { "node": 0, "path": "translation" } }], "samplers": [{ "input": 1, "output": 0 }] }],
+		"nodes": [{ "mesh": 0 }],
+		"scenes": [{ "nodes": [0] }]
+	})";
+	auto jsonData = fastgltf::GltfDataBuffer::FromBytes(reinterpret_cast<const std::byte*>(json.data()), json.size());
+	REQUIRE(jsonData.error() == fastgltf::Error::None);
+
+	fastgltf::Parser parser;
+	auto options = fastgltf::Options::DontRequireValidAssetMember | fastgltf::Options::LazyCategories | fastgltf::Options::GenerateMeshIndices;
+	auto loaded = parser.loadGltfJson(jsonData.get(), {}, options, fastgltf::Category::Buffers);
+	REQUIRE(loaded.error() == fastgltf::Error::None);
+	auto asset = std::move(loaded.get());
+	REQUIRE(asset.buffers.size() == 1);
+	REQUIRE(asset.accessors.empty());
+
+	// The parser can be reused in the meantime without invalidating the retained document.
+	auto other = parser.loadGltfJson(jsonData.get(), {}, fastgltf::Options::DontRequireValidAssetMember);
+	REQUIRE(other.error() == fastgltf::Error::None);
+
+	// Meshes also depend on accessors, buffer views, and materials, which should be parsed as well.
+	REQUIRE(fastgltf::ensureCategories(asset, fastgltf::Category::Meshes) == fastgltf::Error::None);
+	REQUIRE(asset.buffers.size() == 2);
+	REQUIRE(asset.bufferViews.size() == 2);
+	REQUIRE(asset.materials.size() == 1);
+	REQUIRE(asset.meshes.size() == 1);
+	REQUIRE(asset.meshes[0].primitives[0].indicesAccessor.has_value());
+	REQUIRE(asset.animations.empty());
+	REQUIRE(asset.nodes.empty());
+
+	// Parsing a category again does nothing.
+	REQUIRE(fastgltf::ensureCategories(asset, fastgltf::Category::Accessors) == fastgltf::Error::None);
+	REQUIRE(asset.accessors.size() == 3);
+
+	REQUIRE(fastgltf::ensureCategories(asset, fastgltf::Category::All) == fastgltf::Error::None);
+	REQUIRE(asset.animations.size() == 1);
+	REQUIRE(asset.nodes.size() == 1);
+	REQUIRE(asset.scenes.size() == 1);
+	REQUIRE(fastgltf::validate(asset) == fastgltf::Error::None);
+
+	// Assets which have not been loaded lazily are left untouched.
+	auto eager = parser.loadGltfJson(jsonData.get(), {}, fastgltf::Options::DontRequireValidAssetMember, fastgltf::Category::Buffers);
+	REQUIRE(eager.error() == fastgltf::Error::None);
+	REQUIRE(fastgltf::ensureCategories(eager.get(), fastgltf::Category::All) == fastgltf::Error::None);
+	REQUIRE(eager->accessors.empty());
+}
+
+TEST_CASE("Test On-Demand parsing", "[gltf-loader]") {
+	constexpr std::string_view json = R"({
+		"asset": { "version": "2.0" },
+		"extensionsUsed": [ "KHR_materials_emissive_strength" ],
+		"extras": { "large": [ 1, 2, 3, { "nested": "value" } ] },
+		"buffers": [{ "byteLength": 12, "uri": "data:application/octet-stream;base64,AAAAAAAAAAAAAAAA" }],
+		"bufferViews": [{ "buffer": 0, "byteLength": 12 }],
+		"accessors": [{ "bufferView": 0, "componentType": 5126, "count": 1, "type": "VEC3", "min": [0, 0, 0], "max": [0, 0, 0] }],
+		"materials": [{ "name": "m\u00e4terial", "extensions": { "KHR_materials_emissive_strength": { "emissiveStrength": 2 } } }],
+		"meshes": [{ "primitives": [{ "attributes": { "POSITION": 0 }, "material": 0 }] }],
+		"nodes": [{ "mesh": 0, "name": "node", "extras": { "id": 5 } }],
+		"scenes": [{ "nodes": [0] }],
+		"scene": 0
+	})";
+	auto jsonData = fastgltf::GltfDataBuffer::FromBytes(reinterpret_cast<const std::byte*>(json.data()), json.size());
+	REQUIRE(jsonData.error() == fastgltf::Error::None);
+
+	std::vector<std::uint64_t> nodeIds;
+	fastgltf::Parser parser(fastgltf::Extensions::KHR_materials_emissive_strength);
+	parser.setUserPointer(&nodeIds);
+	parser.setExtrasParseCallback([](simdjson::dom::object* extras, std::size_t, fastgltf::Category category, void* userPointer) {
+		std::uint64_t id;
+		if (category == fastgltf::Category::Nodes && (*extras)["id"].get_uint64().get(id) == simdjson::SUCCESS)
+			static_cast<std::vector<std::uint64_t>*>(userPointer)->push_back(id);
+	});
+
+	auto dom = parser.loadGltfJson(jsonData.get(), {});
+	REQUIRE(dom.error() == fastgltf::Error::None);
+	auto onDemand = parser.loadGltfJson(jsonData.get(), {}, fastgltf::Options::OnDemandParsing);
+	REQUIRE(onDemand.error() == fastgltf::Error::None);
+	REQUIRE(fastgltf::validate(onDemand.get()) == fastgltf::Error::None);
+
+	// The extras callback is called with the DOM of only a part of the JSON, which needs to behave just the same.
+	const std::vector<std::uint64_t> expectedIds = { 5, 5 };
+	REQUIRE(nodeIds == expectedIds);
+	REQUIRE(onDemand->assetInfo->gltfVersion == "2.0");
+	REQUIRE(onDemand->defaultScene.value() == dom->defaultScene.value());
+	REQUIRE(onDemand->availableCategories == dom->availableCategories);
+	REQUIRE(onDemand->extensionsUsed.size() == 1);
+	REQUIRE(onDemand->accessors.size() == dom->accessors.size());
+	REQUIRE(onDemand->materials.size() == 1);
+	REQUIRE(onDemand->materials[0].name == dom->materials[0].name);
+	REQUIRE(onDemand->materials[0].emissiveStrength == 2.0f);
+	REQUIRE(onDemand->meshes[0].primitives[0].findAttribute("POSITION")->accessorIndex == 0);
+	REQUIRE(onDemand->nodes[0].name == "node");
+	REQUIRE(onDemand->scenes[0].nodeIndices.size() == 1);
+
+	// The members of categories which are not requested are skipped entirely.
+	auto buffersOnly = parser.loadGltfJson(jsonData.get(), {}, fastgltf::Options::OnDemandParsing, fastgltf::Category::Buffers);
+	REQUIRE(buffersOnly.error() == fastgltf::Error::None);
+	REQUIRE(buffersOnly->buffers.size() == 1);
+	REQUIRE(buffersOnly->nodes.empty());
+
+	constexpr std::string_view invalidJson = R"({ "buffers": [{ "byteLength": 12 ] })";
+	auto invalidData = fastgltf::GltfDataBuffer::FromBytes(reinterpret_cast<const std::byte*>(invalidJson.data()), invalidJson.size());
+	REQUIRE(invalidData.error() == fastgltf::Error::None);
+	auto invalid = parser.loadGltfJson(invalidData.get(), {}, fastgltf::Options::OnDemandParsing | fastgltf::Options::DontRequireValidAssetMember);
+	REQUIRE(invalid.error() == fastgltf::Error::InvalidJson);
+}
+
+TEST_CASE("Test generating mesh indices", "[gltf-loader]") {
+	// Two triangles forming a quad, with two of the six vertices duplicated.
+	constexpr std::string_view json = R"({
+		"buffers": [{ "byteLength": 72, "uri": "data:application/octet-stream;base64,AAAAAAAAAAAAAAAAAACAPwAAAAAAAAAAAACAPwAAgD8AAAAAAAAAAAAAAAAAAAAAAACAPwAAgD8AAAAAAAAAAAAAgD8AAAAA" }],
+		"bufferViews": [{ "buffer": 0, "byteLength": 72 }],
+		"accessors": [{ "bufferView": 0, "componentType": 5126, "count": 6, "type": "VEC3", "min": [0, 0, 0], "max": [1, 1, 0] }],
+		"meshes": [{
+			"primitives": [
+				{ "attributes": { "POSITION": 0 } },
+				{ "attributes": { "POSITION": 0 }, "mode": 0 }
+			]
+		}]
+	})";
+	auto jsonData = fastgltf::GltfDataBuffer::FromBytes(
+			reinterpret_cast<const std::byte*>(json.data()), json.size());
+	REQUIRE(jsonData.error() == fastgltf::Error::None);
+
+	fastgltf::Parser parser;
+	SECTION("Sequential indices") {
+		auto asset = parser.loadGltfJson(jsonData.get(), {}, fastgltf::Options::DontRequireValidAssetMember | fastgltf::Options::GenerateMeshIndices);
+		REQUIRE(asset.error() == fastgltf::Error::None);
+		REQUIRE(fastgltf::validate(asset.get()) == fastgltf::Error::None);
+
+		// The indices of both primitives should share a single new buffer.
+		REQUIRE(asset->buffers.size() == 2);
+		for (auto& primitive : asset->meshes.front().primitives) {
+			REQUIRE(primitive.indicesAccessor.has_value());
+			auto& accessor = asset->accessors[*primitive.indicesAccessor];
+			REQUIRE(accessor.count == 6);
+			REQUIRE(accessor.componentType == fastgltf::ComponentType::UnsignedByte);
+			REQUIRE(asset->bufferViews[*accessor.bufferViewIndex].bufferIndex == 1);
+			REQUIRE(primitive.findAttribute("POSITION")->accessorIndex == 0);
+			fastgltf::iterateAccessorWithIndex<std::uint32_t>(asset.get(), accessor, [](std::uint32_t index, std::size_t i) {
+				REQUIRE(index == i);
+			});
+		}
+	}
+
+	SECTION("Welded vertices") {
+		auto asset = parser.loadGltfJson(jsonData.get(), {}, fastgltf::Options::DontRequireValidAssetMember | fastgltf::Options::GenerateMeshIndices | fastgltf::Options::WeldVertices);
+		REQUIRE(asset.error() == fastgltf::Error::None);
+		REQUIRE(fastgltf::validate(asset.get()) == fastgltf::Error::None);
+
+		REQUIRE(asset->buffers.size() == 2);
+		for (auto& primitive : asset->meshes.front().primitives) {
+			REQUIRE(primitive.indicesAccessor.has_value());
+			auto& indicesAccessor = asset->accessors[*primitive.indicesAccessor];
+			REQUIRE(indicesAccessor.count == 6);
+			REQUIRE(asset->bufferViews[*indicesAccessor.bufferViewIndex].bufferIndex == 1);
+
+			auto& positionAccessor = asset->accessors[primitive.findAttribute("POSITION")->accessorIndex];
+			REQUIRE(positionAccessor.count == 4);
+			REQUIRE(asset->bufferViews[*positionAccessor.bufferViewIndex].bufferIndex == 1);
+
+			// Every index should still reference the same position as the original vertex did.
+			std::vector<std::uint32_t> indices(indicesAccessor.count);
+			fastgltf::copyFromAccessor<std::uint32_t>(asset.get(), indicesAccessor, indices.data());
+			const std::vector<std::uint32_t> expectedIndices = { 0, 1, 2, 0, 2, 3 };
+			REQUIRE(indices == expectedIndices);
+
+			std::vector<fastgltf::math::fvec3> welded(positionAccessor.count);
+			fastgltf::copyFromAccessor<fastgltf::math::fvec3>(asset.get(), positionAccessor, welded.data());
+			fastgltf::iterateAccessorWithIndex<fastgltf::math::fvec3>(asset.get(), asset->accessors[0], [&](fastgltf::math::fvec3 position, std::size_t i) {
+				REQUIRE(welded[indices[i]] == position);
+			});
+		}
+	}
+}
+
+#if FASTGLTF_ENABLE_PROFILING
+TEST_CASE("Test profiling callback", "[gltf-loader]") {
+	constexpr std::string_view json = R"({
+		"buffers": [{ "byteLength": 4, "uri": "data:application/octet-stream;base64,AAECAw==" }],
+		"bufferViews": [{ "buffer": 0, "byteLength": 4 }],
+		"meshes": [{ "primitives": [] }, { "primitives": [] }]
+	})";
+	auto jsonData = fastgltf::GltfDataBuffer::FromBytes(
+			reinterpret_cast<const std::byte*>(json.data()), json.size());
+	REQUIRE(jsonData.error() == fastgltf::Error::None);
+
+	std::vector<fastgltf::ProfilingEvent> events;
+	fastgltf::Parser parser;
+	parser.setUserPointer(&events);
+	parser.setProfilingCallback([](const fastgltf::ProfilingEvent& event, void* userPointer) {
+		static_cast<std::vector<fastgltf::ProfilingEvent>*>(userPointer)->emplace_back(event);
+	});
+
+	auto asset = parser.loadGltfJson(jsonData.get(), {}, fastgltf::Options::DontRequireValidAssetMember);
+	REQUIRE(asset.error() == fastgltf::Error::None);
+
+	auto find = [&](fastgltf::ParseStage stage, fastgltf::Category category = fastgltf::Category::None) {
+		return std::find_if(events.begin(), events.end(), [&](const fastgltf::ProfilingEvent& event) {
+			return event.stage == stage && event.category == category;
+		});
+	};
+	for (const auto& event : events) {
+		REQUIRE(event.begin <= event.end);
+	}
+
+	// The load event spans everything else and is therefore reported last.
+	REQUIRE(events.back().stage == fastgltf::ParseStage::Load);
+	REQUIRE(events.back().byteCount == json.size());
+	REQUIRE(find(fastgltf::ParseStage::ReadJson) != events.end());
+	REQUIRE(find(fastgltf::ParseStage::ParseJson) != events.end());
+
+	auto meshes = find(fastgltf::ParseStage::ParseCategory, fastgltf::Category::Meshes);
+	REQUIRE(meshes != events.end());
+	REQUIRE(meshes->elementCount == 2);
+
+	auto dataUri = find(fastgltf::ParseStage::DecodeDataUri);
+	REQUIRE(dataUri != events.end());
+	REQUIRE(dataUri->byteCount == 4);
+}
+#endif
+
+TEST_CASE("Test memory mapped external buffers", "[gltf-loader]") {
+	auto boxPath = sampleModels / "2.0" / "Box" / "glTF";
+	fastgltf::Parser parser;
+
+	fastgltf::GltfFileStream loadedData(boxPath / "Box.gltf");
+	REQUIRE(loadedData.isOpen());
+	auto loaded = parser.loadGltfJson(loadedData, boxPath, fastgltf::Options::LoadExternalBuffers, fastgltf::Category::Buffers);
+	REQUIRE(loaded.error() == fastgltf::Error::None);
+
+	fastgltf::GltfFileStream mappedData(boxPath / "Box.gltf");
+	REQUIRE(mappedData.isOpen());
+	auto mapped = parser.loadGltfJson(mappedData, boxPath, fastgltf::Options::MapExternalBuffers, fastgltf::Category::Buffers);
+	REQUIRE(mapped.error() == fastgltf::Error::None);
+	REQUIRE(fastgltf::validate(mapped.get()) == fastgltf::Error::None);
+
+	REQUIRE(mapped->buffers.size() == 1);
+	auto* array = std::get_if<fastgltf::sources::Array>(&loaded->buffers.front().data);
+	REQUIRE(array != nullptr);
+#if defined(FASTGLTF_HAS_MEMORY_MAPPED_FILE)
+	auto* byteView = std::get_if<fastgltf::sources::ByteView>(&mapped->buffers.front().data);
+	REQUIRE(byteView != nullptr);
+	REQUIRE(byteView->bytes.size() == array->bytes.size());
+	REQUIRE(std::memcmp(byteView->bytes.data(), array->bytes.data(), array->bytes.size()) == 0);
+#else
+	REQUIRE(std::holds_alternative<fastgltf::sources::Array>(mapped->buffers.front().data));
+#endif
+}
+
 #if defined(FASTGLTF_HAS_MEMORY_MAPPED_FILE)
 TEST_CASE("Test glTF file loading", "[gltf-loader]") {
 	SECTION("Mapped files") {
@@ -1,17 +1,273 @@
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
 #include <fstream>
+#include <iostream>
+#include <new>
 #include <random>
+#include <unordered_map>
 
 #include <catch2/benchmark/catch_benchmark.hpp>
 #include <catch2/catch_test_macros.hpp>
+#include <catch2/reporters/catch_reporter_event_listener.hpp>
+#include <catch2/reporters/catch_reporter_registrars.hpp>
 
 #include <simdjson.h>
 
 #include <fastgltf/core.hpp>
 #include <fastgltf/base64.hpp>
+#include <fastgltf/tools.hpp>
 #include "gltf_path.hpp"
 
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#include <psapi.h>
+#elif defined(__APPLE__) || defined(__unix__)
+#include <sys/resource.h>
+#endif
+
 constexpr auto benchmarkOptions = fastgltf::Options::DontRequireValidAssetMember;
 
+/**
+ * Collects the results of all benchmarks and the memory metrics, and writes them as JSON to the file named by the
+ * FASTGLTF_BENCHMARK_REPORT environment variable, so that regressions can be tracked between versions.
+ */
+class BenchmarkReport {
+	struct Result {
+		std::string name;
+		double meanNanoseconds;
+		double standardDeviationNanoseconds;
+		std::size_t processedBytes;
+	};
+
+	struct Metric {
+		std::string name;
+		double value;
+		std::string unit;
+	};
+
+	std::vector<Result> results;
+	std::vector<Metric> metrics;
+	std::unordered_map<std::string, std::size_t> processedBytes;
+
+	static void writeString(std::ostream& output, std::string_view string) {
+		output << '"';
+		for (auto c : string) {
+			if (c == '"' || c == '\\')
+				output << '\\';
+			output << c;
+		}
+		output << '"';
+	}
+
+public:
+	static BenchmarkReport& get() {
+		static BenchmarkReport report;
+		return report;
+	}
+
+	void setProcessedBytes(const std::string& name, std::size_t bytes) {
+		processedBytes[name] = bytes;
+	}
+
+	void addResult(const std::string& name, double meanNanoseconds, double standardDeviationNanoseconds) {
+		auto it = processedBytes.find(name);
+		results.push_back({ name, meanNanoseconds, standardDeviationNanoseconds, it != processedBytes.end() ? it->second : 0 });
+		if (it != processedBytes.end() && meanNanoseconds > 0) {
+			std::cout << name << ": " << static_cast<double>(it->second) / meanNanoseconds * 1e9 / (1024 * 1024) << " MiB/s\n";
+		}
+	}
+
+	void addMetric(std::string name, double value, std::string unit) {
+		std::cout << name << ": " << value << ' ' << unit << '\n';
+		metrics.push_back({ std::move(name), value, std::move(unit) });
+	}
+
+	void write() const {
+		const auto* path = std::getenv("FASTGLTF_BENCHMARK_REPORT");
+		if (path == nullptr || (results.empty() && metrics.empty()))
+			return;
+
+		std::ofstream output(path);
+		output.precision(12);
+		output << "{\n\t\"benchmarks\": [";
+		for (std::size_t i = 0; i < results.size(); ++i) {
+			const auto& result = results[i];
+			output << (i == 0 ? "\n" : ",\n") << "\t\t{ \"name\": ";
+			writeString(output, result.name);
+			output << ", \"mean_ns\": " << result.meanNanoseconds << ", \"stddev_ns\": " << result.standardDeviationNanoseconds;
+			if (result.processedBytes != 0 && result.meanNanoseconds > 0) {
+				output << ", \"bytes\": " << result.processedBytes
+					<< ", \"bytes_per_second\": " << static_cast<double>(result.processedBytes) / result.meanNanoseconds * 1e9;
+			}
+			output << " }";
+		}
+		output << "\n\t],\n\t\"metrics\": [";
+		for (std::size_t i = 0; i < metrics.size(); ++i) {
+			output << (i == 0 ? "\n" : ",\n") << "\t\t{ \"name\": ";
+			writeString(output, metrics[i].name);
+			output << ", \"value\": " << metrics[i].value << ", \"unit\": ";
+			writeString(output, metrics[i].unit);
+			output << " }";
+		}
+		output << "\n\t]\n}\n";
+	}
+};
+
+class BenchmarkReportListener : public Catch::EventListenerBase {
+public:
+	using Catch::EventListenerBase::EventListenerBase;
+
+	void benchmarkEnded(const Catch::BenchmarkStats<>& stats) override {
+		BenchmarkReport::get().addResult(stats.info.name, stats.mean.point.count(), stats.standardDeviation.point.count());
+	}
+
+	void testRunEnded(const Catch::TestRunStats&) override {
+		BenchmarkReport::get().write();
+	}
+};
+
+CATCH_REGISTER_LISTENER(BenchmarkReportListener)
+
+/** Registers how many bytes a benchmark processes per run, so that its throughput is reported. */
+std::string withThroughput(std::string name, std::size_t bytes) {
+	BenchmarkReport::get().setProcessedBytes(name, bytes);
+	return name;
+}
+
+std::size_t getPeakResidentSetSize() {
+#if defined(_WIN32)
+	PROCESS_MEMORY_COUNTERS counters = {};
+	if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof counters))
+		return counters.PeakWorkingSetSize;
+	return 0;
+#elif defined(__APPLE__) || defined(__unix__)
+	rusage usage = {};
+	getrusage(RUSAGE_SELF, &usage);
+#if defined(__APPLE__)
+	return static_cast<std::size_t>(usage.ru_maxrss);
+#else
+	return static_cast<std::size_t>(usage.ru_maxrss) * 1024; // Linux reports kilobytes.
+#endif
+#else
+	return 0;
+#endif
+}
+
+#if !FASTGLTF_DISABLE_CUSTOM_MEMORY_POOL
+/** Counts all allocations made through it, and the largest amount of memory in use at once. */
+class CountingMemoryResource final : public std::pmr::memory_resource {
+	std::pmr::memory_resource* upstream = std::pmr::new_delete_resource();
+
+public:
+	std::size_t allocations = 0;
+	std::size_t allocatedBytes = 0;
+	std::size_t usedBytes = 0;
+	std::size_t peakUsedBytes = 0;
+
+	void resetCounters() noexcept {
+		allocations = allocatedBytes = 0;
+		peakUsedBytes = usedBytes;
+	}
+
+protected:
+	void* do_allocate(std::size_t bytes, std::size_t alignment) override {
+		++allocations;
+		allocatedBytes += bytes;
+		usedBytes += bytes;
+		if (usedBytes > peakUsedBytes)
+			peakUsedBytes = usedBytes;
+		return upstream->allocate(bytes, alignment);
+	}
+
+	void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override {
+		usedBytes -= bytes;
+		upstream->deallocate(p, bytes, alignment);
+	}
+
+	[[nodiscard]] bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+		return this == &other;
+	}
+};
+#endif
+
+/**
+ * Tracks the heap memory in use through the global operator new. simdjson allocates its tape, structural indexes
+ * and string buffers with new, which the memory resource above never sees. This replacement only exists in the
+ * benchmark binary.
+ */
+namespace heap {
+	std::atomic<std::size_t> usedBytes = 0;
+	std::atomic<std::size_t> peakUsedBytes = 0;
+
+	// Keeps the alignment of malloc for the memory returned after the size.
+	constexpr std::size_t headerSize = 16;
+
+	void resetPeak() noexcept {
+		peakUsedBytes = usedBytes.load();
+	}
+} // namespace heap
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+	auto* memory = static_cast<unsigned char*>(std::malloc(size + heap::headerSize));
+	if (memory == nullptr)
+		return nullptr;
+	std::memcpy(memory, &size, sizeof size);
+	auto used = heap::usedBytes += size;
+	auto peak = heap::peakUsedBytes.load();
+	while (used > peak && !heap::peakUsedBytes.compare_exchange_weak(peak, used)) {}
+	return memory + heap::headerSize;
+}
+
+void operator delete(void* pointer) noexcept {
+	if (pointer == nullptr)
+		return;
+	auto* memory = static_cast<unsigned char*>(pointer) - heap::headerSize;
+	std::size_t size;
+	std::memcpy(&size, memory, sizeof size);
+	heap::usedBytes -= size;
+	std::free(memory);
+}
+
+// All remaining forms are replaced as well, as some runtimes do not forward them to the two above.
+void* operator new(std::size_t size) {
+	auto* memory = operator new(size, std::nothrow);
+	if (memory == nullptr)
+		throw std::bad_alloc();
+	return memory;
+}
+
+void* operator new[](std::size_t size) {
+	return operator new(size);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept {
+	return operator new(size, std::nothrow);
+}
+
+void operator delete(void* pointer, std::size_t) noexcept {
+	operator delete(pointer);
+}
+
+void operator delete(void* pointer, const std::nothrow_t&) noexcept {
+	operator delete(pointer);
+}
+
+void operator delete[](void* pointer) noexcept {
+	operator delete(pointer);
+}
+
+void operator delete[](void* pointer, std::size_t) noexcept {
+	operator delete(pointer);
+}
+
+void operator delete[](void* pointer, const std::nothrow_t&) noexcept {
+	operator delete(pointer);
+}
+
 #ifdef HAS_RAPIDJSON
 #include "rapidjson/document.h"
 #include "rapidjson/prettywriter.h"
@@ -418,6 +674,12 @@ TEST_CASE("Compare base64 decoding performance", "[gltf-benchmark]") {
 			return fastgltf::base64::avx2_decode(generatedData);
 		};
 	}
+
+	if (fastgltf::base64::avx512_vbmi_supported()) {
+		BENCHMARK("Run fastgltf's AVX-512 base64 decoder") {
+			return fastgltf::base64::avx512_decode(generatedData);
+		};
+	}
 #elif defined(FASTGLTF_IS_A64)
 	const auto& impls = simdjson::get_available_implementations();
 	if (const auto* neon = impls["arm64"]; neon != nullptr && neon->supported_by_runtime_system()) {
@@ -426,4 +688,244 @@ TEST_CASE("Compare base64 decoding performance", "[gltf-benchmark]") {
 		};
 	}
 #endif
+
+	// The parallel decoder only splits data above its threshold, so it is compared using a much larger buffer.
+	std::string largeData;
+	largeData.reserve(64 * bufferSize);
+	for (std::size_t i = 0; i < 64; ++i) {
+		largeData += generatedData;
+	}
+	std::vector<std::uint8_t> largeOutput(fastgltf::base64::getOutputSize(largeData.size(), 0));
+	BENCHMARK(withThroughput("Run fastgltf's base64 decoder on 128 MiB", largeData.size())) {
+		fastgltf::base64::decode_inplace(largeData, largeOutput.data(), 0);
+		return largeOutput.back();
+	};
+	BENCHMARK(withThroughput("Run fastgltf's parallel base64 decoder on 128 MiB", largeData.size())) {
+		fastgltf::base64::decode_inplace_parallel(largeData, largeOutput.data(), 0);
+		return largeOutput.back();
+	};
+}
+
+TEST_CASE("Benchmark individual parsing stages", "[gltf-benchmark]") {
+	auto buggyPath = sampleModels / "2.0" / "Buggy" / "glTF";
+	auto bytes = readFileAsBytes(buggyPath / "Buggy.gltf");
+	auto jsonData = fastgltf::GltfDataBuffer::FromBytes(
+			reinterpret_cast<const std::byte*>(bytes.data()), bytes.size());
+	REQUIRE(jsonData.error() == fastgltf::Error::None);
+
+	fastgltf::Parser parser;
+	BENCHMARK(withThroughput("Parse Buggy.gltf JSON only", bytes.size())) {
+		return parser.loadGltfJson(jsonData.get(), buggyPath, benchmarkOptions, fastgltf::Category::None);
+	};
+
+	// The parser always includes the categories a category references, e.g. buffer views for accessors.
+	static constexpr std::array<std::pair<fastgltf::Category, std::string_view>, 14> categories = {{
+		{ fastgltf::Category::Buffers, "buffers" },
+		{ fastgltf::Category::BufferViews, "buffer views" },
+		{ fastgltf::Category::Accessors, "accessors" },
+		{ fastgltf::Category::Images, "images" },
+		{ fastgltf::Category::Samplers, "samplers" },
+		{ fastgltf::Category::Textures, "textures" },
+		{ fastgltf::Category::Animations, "animations" },
+		{ fastgltf::Category::Cameras, "cameras" },
+		{ fastgltf::Category::Materials, "materials" },
+		{ fastgltf::Category::Meshes, "meshes" },
+		{ fastgltf::Category::Skins, "skins" },
+		{ fastgltf::Category::Nodes, "nodes" },
+		{ fastgltf::Category::Scenes, "scenes" },
+		{ fastgltf::Category::Asset, "asset" },
+	}};
+	for (const auto& stage : categories) {
+		BENCHMARK("Parse Buggy.gltf " + std::string(stage.second)) {
+			return parser.loadGltfJson(jsonData.get(), buggyPath, benchmarkOptions, stage.first);
+		};
+	}
+
+	BENCHMARK("Parse Buggy.gltf and generate mesh indices") {
+		return parser.loadGltfJson(jsonData.get(), buggyPath, benchmarkOptions | fastgltf::Options::GenerateMeshIndices);
+	};
+
+	auto boomBoxPath = sampleModels / "2.0" / "BoomBox" / "glTF-Binary";
+	auto boomBox = fastgltf::GltfDataBuffer::FromPath(boomBoxPath / "BoomBox.glb");
+	REQUIRE(boomBox.error() == fastgltf::Error::None);
+	auto glbData = std::make_shared<fastgltf::GltfDataBuffer>(std::move(boomBox.get()));
+	BENCHMARK(withThroughput("Read BoomBox.glb chunks", glbData->totalSize())) {
+		return parser.loadGltfBinary(*glbData, boomBoxPath, benchmarkOptions, fastgltf::Category::None);
+	};
+
+	BENCHMARK(withThroughput("Read BoomBox.glb chunks without copying", glbData->totalSize())) {
+		return parser.loadGltfBinary(glbData, boomBoxPath, benchmarkOptions | fastgltf::Options::ReferenceGLBBuffer, fastgltf::Category::None);
+	};
+}
+
+TEST_CASE("Benchmark accessor tools", "[gltf-benchmark]") {
+	constexpr std::size_t elementCount = 1024 * 1024;
+	struct ComponentFormat {
+		fastgltf::ComponentType componentType;
+		bool normalized;
+		std::string_view name;
+	};
+	static constexpr std::array<ComponentFormat, 5> formats = {{
+		{ fastgltf::ComponentType::Float, false, "float" },
+		{ fastgltf::ComponentType::UnsignedShort, true, "normalized unsigned short" },
+		{ fastgltf::ComponentType::Short, true, "normalized short" },
+		{ fastgltf::ComponentType::UnsignedByte, true, "normalized unsigned byte" },
+		{ fastgltf::ComponentType::Byte, true, "normalized byte" },
+	}};
+
+	// One VEC3 accessor for each format, each with its own buffer.
+	fastgltf::Asset asset;
+	for (const auto& format : formats) {
+		const auto byteLength = elementCount * 3 * fastgltf::getComponentByteSize(format.componentType);
+		std::vector<std::byte> bytes(byteLength);
+		if (format.componentType == fastgltf::ComponentType::Float) {
+			for (std::size_t i = 0; i < elementCount * 3; ++i) {
+				auto value = static_cast<float>(i % 4096) * 0.25f;
+				std::memcpy(bytes.data() + i * sizeof(float), &value, sizeof(float));
+			}
+		} else {
+			for (std::size_t i = 0; i < byteLength; ++i)
+				bytes[i] = static_cast<std::byte>(i * 31);
+		}
+
+		const auto index = asset.buffers.size();
+		asset.buffers.emplace_back(fastgltf::Buffer {
+			byteLength, fastgltf::sources::Vector { std::move(bytes), fastgltf::MimeType::None }, {} });
+		asset.bufferViews.emplace_back(fastgltf::BufferView { index, 0, byteLength, {}, {}, {}, {} });
+
+		auto& accessor = asset.accessors.emplace_back();
+		accessor.count = elementCount;
+		accessor.type = fastgltf::AccessorType::Vec3;
+		accessor.componentType = format.componentType;
+		accessor.normalized = format.normalized;
+		accessor.bufferViewIndex = index;
+	}
+
+	std::vector<fastgltf::math::fvec3> positions(elementCount);
+	for (std::size_t i = 0; i < formats.size(); ++i) {
+		const auto& accessor = asset.accessors[i];
+		const auto byteLength = asset.bufferViews[i].byteLength;
+
+		BENCHMARK(withThroughput("copyFromAccessor with " + std::string(formats[i].name), byteLength)) {
+			fastgltf::copyFromAccessor<fastgltf::math::fvec3>(asset, accessor, positions.data());
+			return positions.back();
+		};
+
+		BENCHMARK(withThroughput("iterateAccessor with " + std::string(formats[i].name), byteLength)) {
+			fastgltf::math::fvec3 sum(0.f);
+			fastgltf::iterateAccessor<fastgltf::math::fvec3>(asset, accessor, [&](fastgltf::math::fvec3 position) {
+				sum += position;
+			});
+			return sum;
+		};
+	}
+}
+
+TEST_CASE("Benchmark exporting", "[gltf-benchmark]") {
+	auto buggyPath = sampleModels / "2.0" / "Buggy" / "glTF";
+	auto jsonData = fastgltf::GltfDataBuffer::FromPath(buggyPath / "Buggy.gltf");
+	REQUIRE(jsonData.error() == fastgltf::Error::None);
+
+	fastgltf::Parser parser;
+	auto asset = parser.loadGltfJson(jsonData.get(), buggyPath, benchmarkOptions | fastgltf::Options::LoadExternalBuffers);
+	REQUIRE(asset.error() == fastgltf::Error::None);
+
+	fastgltf::Exporter exporter;
+	auto json = exporter.writeGltfJson(asset.get());
+	REQUIRE(json.error() == fastgltf::Error::None);
+	BENCHMARK(withThroughput("Write Buggy.gltf as JSON", json.get().output.size())) {
+		return exporter.writeGltfJson(asset.get());
+	};
+
+	auto glb = exporter.writeGltfBinary(asset.get());
+	REQUIRE(glb.error() == fastgltf::Error::None);
+	BENCHMARK(withThroughput("Write Buggy.gltf as GLB", glb.get().output.size())) {
+		return exporter.writeGltfBinary(asset.get());
+	};
+}
+
+#if !FASTGLTF_DISABLE_CUSTOM_MEMORY_POOL
+TEST_CASE("Measure memory usage of parsing", "[gltf-benchmark]") {
+	std::vector<std::pair<std::string, std::filesystem::path>> models = {
+		{ "Buggy", sampleModels / "2.0" / "Buggy" / "glTF" / "Buggy.gltf" },
+		{ "2CylinderEngine", sampleModels / "2.0" / "2CylinderEngine" / "glTF-Embedded" / "2CylinderEngine.gltf" },
+	};
+	// NewSponza and Bistro are not part of glTF-Sample-Models, and therefore not always available.
+	if (std::filesystem::exists(intelSponza / "NewSponza_Main_glTF_002.gltf"))
+		models.emplace_back("NewSponza", intelSponza / "NewSponza_Main_glTF_002.gltf");
+	if (std::filesystem::exists(bistroPath / "bistro.gltf"))
+		models.emplace_back("Bistro", bistroPath / "bistro.gltf");
+
+	// This counts the parser's arena and all pmr containers, which use the default resource. Members like
+	// std::vector or std::unique_ptr, for example materialVariants or the material extensions, bypass it
+	// and are therefore not included in these numbers.
+	CountingMemoryResource counter;
+	auto* previousResource = std::pmr::set_default_resource(&counter);
+	for (const auto& [name, path] : models) {
+		auto jsonData = fastgltf::GltfDataBuffer::FromPath(path);
+		REQUIRE(jsonData.error() == fastgltf::Error::None);
+
+		fastgltf::Parser parser(fastgltf::Extensions::KHR_mesh_quantization);
+		counter.resetCounters();
+		{
+			auto asset = parser.loadGltfJson(jsonData.get(), path.parent_path(), benchmarkOptions);
+			REQUIRE(asset.error() == fastgltf::Error::None);
+		}
+		BenchmarkReport::get().addMetric(name + " allocations", static_cast<double>(counter.allocations), "allocations");
+		BenchmarkReport::get().addMetric(name + " allocated bytes", static_cast<double>(counter.allocatedBytes), "bytes");
+		BenchmarkReport::get().addMetric(name + " peak bytes", static_cast<double>(counter.peakUsedBytes), "bytes");
+
+		// The second load reuses the memory of the first asset.
+		counter.resetCounters();
+		{
+			auto asset = parser.loadGltfJson(jsonData.get(), path.parent_path(), benchmarkOptions);
+			REQUIRE(asset.error() == fastgltf::Error::None);
+		}
+		BenchmarkReport::get().addMetric(name + " allocations when reloading", static_cast<double>(counter.allocations), "allocations");
+	}
+	std::pmr::set_default_resource(previousResource);
+
+	BenchmarkReport::get().addMetric("Peak resident set size", static_cast<double>(getPeakResidentSetSize()), "bytes");
+}
+#endif
+
+TEST_CASE("Compare DOM and On-Demand parsing", "[gltf-benchmark]") {
+	std::vector<std::pair<std::string, std::filesystem::path>> models = {
+		{ "Buggy", sampleModels / "2.0" / "Buggy" / "glTF" / "Buggy.gltf" },
+		{ "2CylinderEngine", sampleModels / "2.0" / "2CylinderEngine" / "glTF-Embedded" / "2CylinderEngine.gltf" },
+	};
+	if (std::filesystem::exists(intelSponza / "NewSponza_Main_glTF_002.gltf"))
+		models.emplace_back("NewSponza", intelSponza / "NewSponza_Main_glTF_002.gltf");
+	if (std::filesystem::exists(bistroPath / "bistro.gltf"))
+		models.emplace_back("Bistro", bistroPath / "bistro.gltf");
+
+	constexpr auto onDemandOptions = benchmarkOptions | fastgltf::Options::OnDemandParsing;
+	for (const auto& model : models) {
+		const auto& name = model.first;
+		const auto directory = model.second.parent_path();
+		auto jsonData = fastgltf::GltfDataBuffer::FromPath(model.second);
+		REQUIRE(jsonData.error() == fastgltf::Error::None);
+		const auto size = jsonData->totalSize();
+
+		fastgltf::Parser parser(fastgltf::Extensions::KHR_mesh_quantization);
+		BENCHMARK(withThroughput("Parse " + name + " with DOM", size)) {
+			return parser.loadGltfJson(jsonData.get(), directory, benchmarkOptions);
+		};
+		BENCHMARK(withThroughput("Parse " + name + " with On-Demand", size)) {
+			return parser.loadGltfJson(jsonData.get(), directory, onDemandOptions);
+		};
+
+		// A new parser for each measurement, so that the simdjson buffers are allocated as part of it.
+		for (const auto& [suffix, options] : { std::pair { " DOM", benchmarkOptions }, std::pair { " On-Demand", onDemandOptions } }) {
+			heap::resetPeak();
+			const auto usedBefore = heap::usedBytes.load();
+			{
+				fastgltf::Parser measuredParser(fastgltf::Extensions::KHR_mesh_quantization);
+				auto asset = measuredParser.loadGltfJson(jsonData.get(), directory, options);
+				REQUIRE(asset.error() == fastgltf::Error::None);
+			}
+			BenchmarkReport::get().addMetric(name + suffix + " peak heap bytes",
+				static_cast<double>(heap::peakUsedBytes.load() - usedBefore), "bytes");
+		}
+	}
 }
@@ -3,6 +3,7 @@
 #include <catch2/benchmark/catch_benchmark.hpp>
 
 #include <fastgltf/core.hpp>
+#include <fastgltf/tools.hpp>
 #include "gltf_path.hpp"
 
 // Tests for extension functionality, declared in the same order as the fastgltf::Extensions enum.
@@ -101,6 +102,35 @@ TEST_CASE("Extension EXT_meshopt_compression", "[gltf-loader]") {
 	}
 }
 
+TEST_CASE("Extension EXT_meshopt_compression decoding", "[gltf-loader]") {
+	auto brainStem = sampleModels / "2.0" / "BrainStem" / "glTF-Meshopt";
+	fastgltf::GltfFileStream jsonData(brainStem / "BrainStem.gltf");
+	REQUIRE(jsonData.isOpen());
+
+	fastgltf::Parser parser(fastgltf::Extensions::EXT_meshopt_compression | fastgltf::Extensions::KHR_mesh_quantization);
+	auto asset = parser.loadGltfJson(jsonData, brainStem, fastgltf::Options::LoadExternalBuffers | fastgltf::Options::DecompressMeshopt);
+#if FASTGLTF_ENABLE_MESHOPT
+	REQUIRE(asset.error() == fastgltf::Error::None);
+	REQUIRE(fastgltf::validate(asset.get()) == fastgltf::Error::None);
+
+	// The decoded data is appended as a new buffer, and no view should be compressed anymore.
+	REQUIRE(std::holds_alternative<fastgltf::sources::Array>(asset->buffers.back().data));
+	for (auto& view : asset->bufferViews) {
+		REQUIRE(!view.meshoptCompression);
+	}
+
+	// The decoded indices need to be valid vertex indices.
+	auto& primitive = asset->meshes.front().primitives.front();
+	REQUIRE(primitive.indicesAccessor.has_value());
+	auto& positionAccessor = asset->accessors[primitive.findAttribute("POSITION")->accessorIndex];
+	fastgltf::iterateAccessor<std::uint32_t>(asset.get(), asset->accessors[*primitive.indicesAccessor], [&](std::uint32_t index) {
+		REQUIRE(index < positionAccessor.count);
+	});
+#else
+	REQUIRE(asset.error() == fastgltf::Error::DecompressionFailed);
+#endif
+}
+
 TEST_CASE("Extension KHR_draco_mesh_compression", "[gltf-loader]") {
 	auto brainStem = sampleModels / "2.0" / "BrainStem" / "glTF-Draco";
 	fastgltf::GltfFileStream jsonData(brainStem / "BrainStem.gltf");
@@ -150,6 +180,87 @@ TEST_CASE("Extension KHR_draco_mesh_compression", "[gltf-loader]") {
 	}
 }
 
+TEST_CASE("Extension KHR_draco_mesh_compression decoding", "[gltf-loader]") {
+	constexpr std::string_view json = R"({
+		"extensionsUsed": ["KHR_draco_mesh_compression"],
+		"buffers": [{ "byteLength": 4, "uri": "data:application/octet-stream;base64,AQIDBA==" }],
+		"bufferViews": [{ "buffer": 0, "byteLength": 4 }],
+		"accessors": [
+			{ "componentType": 5126, "count": 3, "type": "VEC3", "min": [0, 0.5, 1], "max": [2, 2.5, 3] },
+			{ "componentType": 5123, "count": 3, "type": "SCALAR" }
+		],
+		"meshes": [{
+			"primitives": [{
+				"attributes": { "POSITION": 0 },
+				"indices": 1,
+				"extensions": {
+					"KHR_draco_mesh_compression": { "bufferView": 0, "attributes": { "POSITION": 7 } }
+				}
+			}]
+		}]
+	})";
+	auto jsonData = fastgltf::GltfDataBuffer::FromBytes(
+			reinterpret_cast<const std::byte*>(json.data()), json.size());
+	REQUIRE(jsonData.error() == fastgltf::Error::None);
+
+	// The "decoder" checks the compressed bytes and writes some known values into the targets.
+	fastgltf::Parser parser(fastgltf::Extensions::KHR_draco_mesh_compression);
+	parser.setDracoDecodeCallback([](const fastgltf::DracoDecodeInfo& info, void*) {
+		if (info.compressedData.size() != 4 || info.compressedData[3] != std::byte(4))
+			return false;
+		if (info.indices == nullptr || info.indices->data.size_bytes() != 3 * sizeof(std::uint16_t))
+			return false;
+		if (info.attributes.size() != 1 || info.attributes[0].name != "POSITION" || info.attributes[0].dracoAttributeId != 7)
+			return false;
+
+		auto* indices = reinterpret_cast<std::uint16_t*>(info.indices->data.data());
+		auto* positions = reinterpret_cast<float*>(info.attributes[0].data.data());
+		for (std::uint16_t i = 0; i < 3; ++i) {
+			indices[i] = 2 - i;
+			positions[i * 3 + 0] = float(i);
+			positions[i * 3 + 1] = float(i) + 0.5f;
+			positions[i * 3 + 2] = float(i) + 1.0f;
+		}
+		return true;
+	});
+	auto asset = parser.loadGltfJson(jsonData.get(), {}, fastgltf::Options::DontRequireValidAssetMember);
+	REQUIRE(asset.error() == fastgltf::Error::None);
+	REQUIRE(fastgltf::validate(asset.get()) == fastgltf::Error::None);
+
+	auto& primitive = asset->meshes.front().primitives.front();
+	REQUIRE(!primitive.dracoCompression);
+
+	auto& positionAccessor = asset->accessors[primitive.findAttribute("POSITION")->accessorIndex];
+	REQUIRE(positionAccessor.bufferViewIndex.has_value());
+	fastgltf::iterateAccessorWithIndex<fastgltf::math::fvec3>(asset.get(), positionAccessor, [](fastgltf::math::fvec3 position, std::size_t i) {
+		REQUIRE(position == fastgltf::math::fvec3(float(i), float(i) + 0.5f, float(i) + 1.0f));
+	});
+	fastgltf::iterateAccessorWithIndex<std::uint32_t>(asset.get(), asset->accessors[*primitive.indicesAccessor], [](std::uint32_t index, std::size_t i) {
+		REQUIRE(index == 2 - i);
+	});
+
+	SECTION("Failed decoding") {
+		parser.setDracoDecodeCallback([](const fastgltf::DracoDecodeInfo&, void*) {
+			return false;
+		});
+		auto failedAsset = parser.loadGltfJson(jsonData.get(), {}, fastgltf::Options::DontRequireValidAssetMember);
+		REQUIRE(failedAsset.error() == fastgltf::Error::DecompressionFailed);
+	}
+
+	SECTION("Mapped buffer") {
+		// Buffers written through the map callback cannot be read back by the parser.
+		std::vector<std::byte> mapped;
+		parser.setUserPointer(&mapped);
+		parser.setBufferAllocationCallback([](std::uint64_t bufferSize, void* userPointer) -> fastgltf::BufferInfo {
+			auto* memory = static_cast<std::vector<std::byte>*>(userPointer);
+			memory->resize(bufferSize);
+			return fastgltf::BufferInfo { memory->data(), 0 };
+		}, nullptr);
+		auto mappedAsset = parser.loadGltfJson(jsonData.get(), {}, fastgltf::Options::DontRequireValidAssetMember);
+		REQUIRE(mappedAsset.error() == fastgltf::Error::UnreadableMappedBuffer);
+	}
+}
+
 TEST_CASE("Extension KHR_lights_punctual", "[gltf-loader]") {
 	SECTION("Point light") {
 		auto lightsLamp = sampleModels / "2.0" / "LightsPunctualLamp" / "glTF";
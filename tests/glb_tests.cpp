@@ -54,3 +54,76 @@ TEST_CASE("Load basic GLB file", "[gltf-loader]") {
         REQUIRE(asset.error() == fastgltf::Error::None);
     }
 }
+
+TEST_CASE("Load GLB buffer without copying", "[gltf-loader]") {
+	auto folder = sampleModels / "2.0" / "Box" / "glTF-Binary";
+	fastgltf::Parser parser;
+
+	SECTION("Reference the GLB buffer") {
+		auto jsonData = fastgltf::GltfDataBuffer::FromPath(folder / "Box.glb");
+		REQUIRE(jsonData.error() == fastgltf::Error::None);
+		auto dataBuffer = std::make_shared<fastgltf::GltfDataBuffer>(std::move(jsonData.get()));
+
+		auto asset = parser.loadGltfBinary(dataBuffer, folder, fastgltf::Options::ReferenceGLBBuffer, fastgltf::Category::Buffers);
+		REQUIRE(asset.error() == fastgltf::Error::None);
+		REQUIRE(fastgltf::validate(asset.get()) == fastgltf::Error::None);
+
+		// The asset keeps the data buffer alive.
+		REQUIRE(dataBuffer.use_count() == 2);
+		dataBuffer.reset();
+
+		REQUIRE(asset->buffers.size() == 1);
+		auto* byteView = std::get_if<fastgltf::sources::ByteView>(&asset->buffers.front().data);
+		REQUIRE(byteView != nullptr);
+		REQUIRE(byteView->bytes.size() == 1664 - 1016);
+		REQUIRE(byteView->mimeType == fastgltf::MimeType::GltfBuffer);
+	}
+
+#if defined(FASTGLTF_HAS_MEMORY_MAPPED_FILE)
+	SECTION("Reference the mapped GLB buffer") {
+		auto mappedFile = fastgltf::MappedGltfFile::FromPath(folder / "Box.glb");
+		REQUIRE(mappedFile.error() == fastgltf::Error::None);
+		auto mapped = std::make_shared<fastgltf::MappedGltfFile>(std::move(mappedFile.get()));
+
+		auto asset = parser.loadGltf(mapped, folder, fastgltf::Options::ReferenceGLBBuffer, fastgltf::Category::Buffers);
+		REQUIRE(asset.error() == fastgltf::Error::None);
+
+		auto* byteView = std::get_if<fastgltf::sources::ByteView>(&asset->buffers.front().data);
+		REQUIRE(byteView != nullptr);
+		REQUIRE(byteView->bytes.data() == mapped->persistentBytes().data() + 1016);
+	}
+#endif
+
+	SECTION("Skip the GLB buffer") {
+		auto jsonData = fastgltf::GltfDataBuffer::FromPath(folder / "Box.glb");
+		REQUIRE(jsonData.error() == fastgltf::Error::None);
+
+		auto asset = parser.loadGltfBinary(jsonData.get(), folder, fastgltf::Options::SkipGLBBuffer, fastgltf::Category::Buffers);
+		REQUIRE(asset.error() == fastgltf::Error::None);
+
+		REQUIRE(asset->buffers.size() == 1);
+		auto* uri = std::get_if<fastgltf::sources::URI>(&asset->buffers.front().data);
+		REQUIRE(uri != nullptr);
+		REQUIRE(uri->fileByteOffset == 1016);
+		REQUIRE(uri->mimeType == fastgltf::MimeType::GltfBuffer);
+	}
+}
+
+TEST_CASE("Load GLB file asynchronously", "[gltf-loader]") {
+	auto folder = sampleModels / "2.0" / "Box" / "glTF-Binary";
+	auto file = fastgltf::AsyncGltfFile::FromPath(folder / "Box.glb");
+	REQUIRE(file.error() == fastgltf::Error::None);
+	auto asyncFile = std::make_shared<fastgltf::AsyncGltfFile>(std::move(file.get()));
+
+	fastgltf::Parser parser;
+	auto future = parser.loadGltfAsync(asyncFile, folder, fastgltf::Options::None, fastgltf::Category::Buffers);
+	auto asset = future.get();
+	REQUIRE(asset.error() == fastgltf::Error::None);
+	REQUIRE(fastgltf::validate(asset.get()) == fastgltf::Error::None);
+	REQUIRE(asyncFile->wait() == fastgltf::Error::None);
+
+	REQUIRE(asset->buffers.size() == 1);
+	auto* array = std::get_if<fastgltf::sources::Array>(&asset->buffers.front().data);
+	REQUIRE(array != nullptr);
+	REQUIRE(array->bytes.size() == 1664 - 1016);
+}
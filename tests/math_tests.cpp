@@ -1,3 +1,4 @@
+#include <cstring>
 #include <random>
 
 #include <fastgltf/math.hpp>
@@ -221,6 +222,34 @@ TEST_CASE("Matrix operations", "[maths]") {
 			fastgltf::math::fvec3(1, -1, -2));
 		REQUIRE(determinant(m) == 1);
 	}
+
+	SECTION("SIMD kernels match the scalar code") {
+		// Products evaluated at compile time always use the scalar code, which the SIMD kernels need to match exactly.
+		static constexpr fastgltf::math::fmat4x4 a(
+			fastgltf::math::fvec4(0.1f, -2.3f, 4.7f, 0.f),
+			fastgltf::math::fvec4(1.3f, 0.7f, -0.2f, 0.f),
+			fastgltf::math::fvec4(-0.9f, 3.1f, 0.4f, 0.f),
+			fastgltf::math::fvec4(5.5f, -6.1f, 7.3f, 1.f));
+		static constexpr fastgltf::math::fmat4x4 b(
+			fastgltf::math::fvec4(0.3f, 1.1f, -0.5f, 0.f),
+			fastgltf::math::fvec4(-1.7f, 0.2f, 0.9f, 0.f),
+			fastgltf::math::fvec4(0.6f, -0.8f, 1.9f, 0.f),
+			fastgltf::math::fvec4(-2.5f, 3.5f, 0.25f, 1.f));
+		constexpr auto expected = a * b;
+		auto product = a * b;
+		REQUIRE(std::memcmp(expected.data(), product.data(), sizeof(product)) == 0);
+
+		const fastgltf::math::fvec3 translation(1.5f, -0.3f, 2.7f);
+		auto translated = translate(a, translation);
+		auto expectedColumn = a.col(0) * translation.x() + a.col(1) * translation.y() + a.col(2) * translation.z() + a.col(3);
+		REQUIRE(std::memcmp(translated.col(3).data(), expectedColumn.data(), sizeof(expectedColumn)) == 0);
+
+		const auto rotation = normalize(fastgltf::math::fquat(0.2f, -0.4f, 0.1f, 0.9f));
+		const fastgltf::math::fvec3 scaling(2.f, 0.5f, 1.25f);
+		auto composed = composeTransformMatrix(translation, rotation, scaling);
+		auto chained = scale(rotate(translate(fastgltf::math::fmat4x4(), translation), rotation), scaling);
+		REQUIRE(composed == chained);
+	}
 }
 
 TEST_CASE("Test TRS parsing and optional decomposition", "[maths]") {
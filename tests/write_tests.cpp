@@ -1,7 +1,9 @@
 #include <algorithm>
 #include <cinttypes>
 #include <cstdint>
+#include <cstring>
 #include <fstream>
+#include <sstream>
 
 #include <catch2/catch_test_macros.hpp>
 
@@ -155,6 +157,123 @@ TEST_CASE("Try writing a GLB with all buffers and images", "[write-tests]") {
 	REQUIRE(binType[3] == 0);
 }
 
+TEST_CASE("Test that a failed GLB export keeps the existing file", "[write-tests]") {
+	auto exportedFolder = path / "export_glb_failed";
+	std::error_code ec;
+	std::filesystem::create_directories(exportedFolder, ec);
+	REQUIRE(!ec);
+
+	auto exportedPath = exportedFolder / "existing.glb";
+	constexpr std::string_view existingContent = "existing file";
+	{
+		std::ofstream existing(exportedPath, std::ios::binary | std::ios::trunc);
+		REQUIRE(existing.is_open());
+		existing << existingContent;
+	}
+
+	// Custom buffers cannot be exported, which makes the export fail.
+	fastgltf::Asset asset;
+	auto& buffer = asset.buffers.emplace_back();
+	buffer.byteLength = 4;
+	buffer.data = fastgltf::sources::CustomBuffer { 0, fastgltf::MimeType::None };
+
+	fastgltf::FileExporter exporter;
+	REQUIRE(exporter.writeGltfBinary(asset, exportedPath) == fastgltf::Error::InvalidGltf);
+
+	std::ifstream file(exportedPath, std::ios::binary);
+	REQUIRE(file.is_open());
+	std::stringstream content;
+	content << file.rdbuf();
+	REQUIRE(content.str() == existingContent);
+}
+
+TEST_CASE("Test writing buffers and images as data URIs", "[write-tests]") {
+	std::vector<std::byte> bufferBytes(100);
+	for (std::size_t i = 0; i < bufferBytes.size(); ++i)
+		bufferBytes[i] = static_cast<std::byte>(i * 7 + 3);
+
+	fastgltf::Asset asset;
+	asset.buffers.emplace_back(fastgltf::Buffer {
+		bufferBytes.size(), fastgltf::sources::Vector { bufferBytes, fastgltf::MimeType::None }, {} });
+	auto& image = asset.images.emplace_back();
+	image.data = fastgltf::sources::Vector { { std::byte(0x89), std::byte('P'), std::byte('N'), std::byte('G') }, fastgltf::MimeType::PNG };
+
+	fastgltf::Exporter exporter;
+	auto exported = exporter.writeGltfJson(asset, fastgltf::ExportOptions::EmbedDataUris);
+	REQUIRE(exported.error() == fastgltf::Error::None);
+	REQUIRE(exported.get().output.find("data:image/png;base64,iVBORw==") != std::string::npos);
+	REQUIRE(!exported.get().bufferPaths.front().has_value());
+	REQUIRE(!exported.get().imagePaths.front().has_value());
+
+	// Data URIs are always decoded by the parser, so the asset can be loaded back without any files.
+	auto jsonData = fastgltf::GltfDataBuffer::FromBytes(
+			reinterpret_cast<const std::byte*>(exported.get().output.data()), exported.get().output.size());
+	REQUIRE(jsonData.error() == fastgltf::Error::None);
+	fastgltf::Parser parser;
+	auto reloaded = parser.loadGltfJson(jsonData.get(), {});
+	REQUIRE(reloaded.error() == fastgltf::Error::None);
+	REQUIRE(reloaded->buffers.size() == 1);
+	const auto* array = std::get_if<fastgltf::sources::Array>(&reloaded->buffers.front().data);
+	REQUIRE(array != nullptr);
+	REQUIRE(std::equal(array->bytes.begin(), array->bytes.end(), bufferBytes.begin(), bufferBytes.end()));
+}
+
+TEST_CASE("Test streaming a GLB with merged buffers", "[write-tests]") {
+	// Two buffers in memory around one which is referenced by URI, and which cannot be merged.
+	fastgltf::Asset asset;
+	std::vector<std::vector<std::byte>> bufferBytes(2);
+	for (std::size_t i = 0; i < bufferBytes.size(); ++i) {
+		bufferBytes[i].resize(10 + i * 13);
+		for (std::size_t j = 0; j < bufferBytes[i].size(); ++j)
+			bufferBytes[i][j] = static_cast<std::byte>(i * 100 + j);
+	}
+	asset.buffers.emplace_back(fastgltf::Buffer {
+		bufferBytes[0].size(), fastgltf::sources::Vector { bufferBytes[0], fastgltf::MimeType::None }, {} });
+	asset.buffers.emplace_back(fastgltf::Buffer {
+		16, fastgltf::sources::URI { 0, fastgltf::URI(std::string_view("external.bin")), fastgltf::MimeType::None }, {} });
+	asset.buffers.emplace_back(fastgltf::Buffer {
+		bufferBytes[1].size(), fastgltf::sources::Vector { bufferBytes[1], fastgltf::MimeType::None }, {} });
+	asset.bufferViews.emplace_back(fastgltf::BufferView { 0, 2, 8, {}, {}, {}, {} });
+	asset.bufferViews.emplace_back(fastgltf::BufferView { 1, 0, 16, {}, {}, {}, {} });
+	asset.bufferViews.emplace_back(fastgltf::BufferView { 2, 3, 20, {}, {}, {}, {} });
+
+	fastgltf::Exporter exporter;
+	auto exported = exporter.writeGltfBinary(asset, fastgltf::ExportOptions::MergeBuffersIntoBinaryChunk);
+	REQUIRE(exported.error() == fastgltf::Error::None);
+	const auto& glb = exported.get().output;
+	REQUIRE(glb.size() % 4 == 0);
+
+	// Streaming has to produce exactly the same bytes.
+	std::ostringstream stream(std::ios::binary);
+	auto streamed = exporter.writeGltfBinary(asset, stream, fastgltf::ExportOptions::MergeBuffersIntoBinaryChunk);
+	REQUIRE(streamed.error() == fastgltf::Error::None);
+	REQUIRE(streamed.get().output == glb.size());
+	const auto streamedBytes = stream.str();
+	REQUIRE(streamedBytes.size() == glb.size());
+	REQUIRE(std::memcmp(streamedBytes.data(), glb.data(), glb.size()) == 0);
+
+	auto glbData = fastgltf::GltfDataBuffer::FromBytes(glb.data(), glb.size());
+	REQUIRE(glbData.error() == fastgltf::Error::None);
+	fastgltf::Parser parser;
+	auto reloaded = parser.loadGltfBinary(glbData.get(), {});
+	REQUIRE(reloaded.error() == fastgltf::Error::None);
+	REQUIRE(reloaded->buffers.size() == 2);
+	REQUIRE(std::holds_alternative<fastgltf::sources::URI>(reloaded->buffers[1].data));
+	REQUIRE(reloaded->bufferViews[1].bufferIndex == 1);
+
+	// Both merged buffer views need to point at the same bytes as before.
+	const auto* binary = std::get_if<fastgltf::sources::Array>(&reloaded->buffers[0].data);
+	REQUIRE(binary != nullptr);
+	for (std::size_t i : { 0, 2 }) {
+		const auto& view = reloaded->bufferViews[i];
+		const auto& original = asset.bufferViews[i];
+		REQUIRE(view.bufferIndex == 0);
+		REQUIRE(view.byteOffset % 16 == original.byteOffset % 16);
+		const auto& source = bufferBytes[i / 2];
+		REQUIRE(std::memcmp(binary->bytes.data() + view.byteOffset, source.data() + original.byteOffset, original.byteLength) == 0);
+	}
+}
+
 TEST_CASE("Test string escape", "[write-tests]") {
     std::string x = "\"stuff\\";
     std::string escaped = fastgltf::escapeString(x);
@@ -167,6 +286,120 @@ TEST_CASE("Test pretty-print", "[write-tests]") {
 	REQUIRE(json == "{\n\t\"value\":5,\n\t\"thing\":{\n\t\t\n\t}\n}");
 }
 
+TEST_CASE("Test writing categories in parallel", "[write-tests]") {
+	fastgltf::Asset asset;
+	for (std::size_t i = 0; i < 16; ++i) {
+		fastgltf::Node node;
+		node.name = "node \"" + std::to_string(i) + '"';
+		node.transform = fastgltf::TRS { fastgltf::math::fvec3(0.1f, static_cast<float>(i), -2.5f) };
+		asset.nodes.emplace_back(std::move(node));
+
+		fastgltf::Material material;
+		material.pbrData.baseColorFactor = fastgltf::math::nvec4(0.25f, 0.5f, 1.f / 3.f, 1.f);
+		asset.materials.emplace_back(std::move(material));
+
+		fastgltf::BufferView bufferView = {};
+		bufferView.bufferIndex = 0;
+		bufferView.byteOffset = i * 16;
+		bufferView.byteLength = 16;
+		asset.bufferViews.emplace_back(std::move(bufferView));
+	}
+	fastgltf::Scene scene;
+	scene.nodeIndices = { 0, 1, 2 };
+	asset.scenes.emplace_back(std::move(scene));
+
+	fastgltf::Exporter exporter;
+	for (auto options : { fastgltf::ExportOptions::None, fastgltf::ExportOptions::PrettyPrintJson }) {
+		auto sequential = exporter.writeGltfJson(asset, options);
+		REQUIRE(sequential.error() == fastgltf::Error::None);
+		auto parallel = exporter.writeGltfJson(asset, options | fastgltf::ExportOptions::WriteCategoriesInParallel);
+		REQUIRE(parallel.error() == fastgltf::Error::None);
+		REQUIRE(sequential.get().output == parallel.get().output);
+	}
+
+	// The pretty-printed output matches pretty-printing the compact JSON, and floats are written so that they round-trip.
+	auto compact = exporter.writeGltfJson(asset);
+	REQUIRE(compact.error() == fastgltf::Error::None);
+	std::string json = compact.get().output;
+	REQUIRE(json.find("[0.1,3,-2.5]") != std::string::npos);
+	fastgltf::prettyPrintJson(json);
+	auto pretty = exporter.writeGltfJson(asset, fastgltf::ExportOptions::PrettyPrintJson);
+	REQUIRE(pretty.error() == fastgltf::Error::None);
+	REQUIRE(json == pretty.get().output);
+}
+
+TEST_CASE("Test writing and loading an asset cache", "[write-tests]") {
+	constexpr std::string_view json = R"({
+		"asset": { "version": "2.0", "generator": "cache test" },
+		"extensionsUsed": [ "KHR_materials_clearcoat", "KHR_texture_transform" ],
+		"buffers": [
+			{ "byteLength": 8, "uri": "data:application/octet-stream;base64,AAECAwQFBgc=" },
+			{ "byteLength": 16, "uri": "external%2520file.bin" }
+		],
+		"bufferViews": [ { "buffer": 0, "byteOffset": 4, "byteLength": 4, "name": "view" } ],
+		"accessors": [ { "bufferView": 0, "count": 1, "type": "SCALAR", "componentType": 5125, "min": [ 1 ], "max": [ 2.5 ] } ],
+		"meshes": [ { "primitives": [ { "attributes": { "POSITION": 0 }, "targets": [ { "NORMAL": 0 } ] } ] } ],
+		"materials": [ { "name": "material", "normalTexture": { "index": 0, "scale": 0.5 },
+			"extensions": { "KHR_materials_clearcoat": { "clearcoatFactor": 0.75,
+				"clearcoatTexture": { "index": 0, "extensions": { "KHR_texture_transform": { "rotation": 1.5 } } } } } } ],
+		"images": [ { "uri": "image.png" } ],
+		"textures": [ { "source": 0 } ],
+		"nodes": [ { "translation": [ 1, 2, 3 ], "mesh": 0 }, { "matrix": [ 2,0,0,0, 0,2,0,0, 0,0,2,0, 0,0,0,1 ], "children": [ 0 ] } ],
+		"scenes": [ { "nodes": [ 1 ] } ],
+		"scene": 0
+	})";
+	auto jsonData = fastgltf::GltfDataBuffer::FromBytes(reinterpret_cast<const std::byte*>(json.data()), json.size());
+	REQUIRE(jsonData.error() == fastgltf::Error::None);
+	const auto sourceHash = fastgltf::hashGltfData(jsonData.get());
+
+	fastgltf::Parser parser(fastgltf::Extensions::KHR_materials_clearcoat | fastgltf::Extensions::KHR_texture_transform);
+	auto asset = parser.loadGltfJson(jsonData.get(), {});
+	REQUIRE(asset.error() == fastgltf::Error::None);
+
+	const auto cache = fastgltf::writeAssetCache(asset.get(), sourceHash);
+	auto cacheData = fastgltf::GltfDataBuffer::FromBytes(cache.data(), cache.size());
+	REQUIRE(cacheData.error() == fastgltf::Error::None);
+	auto cached = parser.loadAssetCache(cacheData.get(), sourceHash);
+	REQUIRE(cached.error() == fastgltf::Error::None);
+
+	// Exporting both assets has to produce the same JSON.
+	fastgltf::Exporter exporter;
+	auto exported = exporter.writeGltfJson(asset.get());
+	REQUIRE(exported.error() == fastgltf::Error::None);
+	auto exportedCache = exporter.writeGltfJson(cached.get());
+	REQUIRE(exportedCache.error() == fastgltf::Error::None);
+	REQUIRE(exported.get().output == exportedCache.get().output);
+
+	REQUIRE(cached->materials.size() == 1);
+	REQUIRE(cached->materials[0].clearcoat != nullptr);
+	REQUIRE(cached->materials[0].clearcoat->clearcoatTexture->transform->rotation == 1.5f);
+	REQUIRE(cached->meshes[0].primitives[0].targets.size() == 1);
+	const auto* uri = std::get_if<fastgltf::sources::URI>(&cached->buffers[1].data);
+	REQUIRE(uri != nullptr);
+	REQUIRE(uri->uri.string() == std::get<fastgltf::sources::URI>(asset->buffers[1].data).uri.string());
+	const auto* array = std::get_if<fastgltf::sources::Array>(&cached->buffers[0].data);
+	REQUIRE(array != nullptr);
+	REQUIRE(array->bytes.size() == 8);
+	REQUIRE(array->bytes[7] == std::byte(7));
+
+	// When the cache is kept in memory, the embedded buffers point into it.
+	auto sharedCacheData = std::make_shared<fastgltf::GltfDataBuffer>(std::move(cacheData.get()));
+	auto referenced = parser.loadAssetCache(sharedCacheData, sourceHash);
+	REQUIRE(referenced.error() == fastgltf::Error::None);
+	const auto* view = std::get_if<fastgltf::sources::ByteView>(&referenced->buffers[0].data);
+	REQUIRE(view != nullptr);
+	REQUIRE((view->bytes.data() - sharedCacheData->persistentBytes().data()) % 16 == 0);
+	REQUIRE(view->bytes[3] == std::byte(3));
+
+	// Caches of a different source, or damaged caches, are rejected.
+	REQUIRE(parser.loadAssetCache(*sharedCacheData, sourceHash + 1).error() == fastgltf::Error::InvalidCache);
+	auto damaged = cache;
+	damaged.back() ^= std::byte(1);
+	auto damagedData = fastgltf::GltfDataBuffer::FromBytes(damaged.data(), damaged.size());
+	REQUIRE(damagedData.error() == fastgltf::Error::None);
+	REQUIRE(parser.loadAssetCache(damagedData.get(), sourceHash).error() == fastgltf::Error::InvalidCache);
+}
+
 TEST_CASE("Test all local models and re-export them", "[write-tests]") {
 	// Enable all extensions
 	static constexpr auto requiredExtensions = static_cast<fastgltf::Extensions>(~0U);